@@ -0,0 +1,99 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace ZeroUI::Benchmark
+{
+	/* a single measure of a benchmark, e.g. "Dispatch/Workers:4" 85.2 "ns/task" */
+	struct FBenchmarkResult
+	{
+		std::string Name;
+		double Value;
+		std::string Unit;
+	};
+
+	/* passed to every benchmark, collects its results */
+	class FBenchmarkContext
+	{
+	public:
+		void Report(const std::string& Name, double Value, const std::string& Unit)
+		{
+			m_Results.push_back(FBenchmarkResult{ Name, Value, Unit });
+		}
+
+		const std::vector<FBenchmarkResult>& GetResults() const { return m_Results; }
+
+	private:
+		std::vector<FBenchmarkResult> m_Results;
+	};
+
+	using FBenchmarkFunction = void(*)(FBenchmarkContext&);
+
+	class FBenchmarkRegistry
+	{
+	public:
+		static FBenchmarkRegistry& Get()
+		{
+			static FBenchmarkRegistry Instance;
+			return Instance;
+		}
+
+		void Register(const char* Name, FBenchmarkFunction Function)
+		{
+			m_Benchmarks.emplace_back(Name, Function);
+		}
+
+		const std::vector<std::pair<std::string, FBenchmarkFunction>>& GetBenchmarks() const { return m_Benchmarks; }
+
+	private:
+		std::vector<std::pair<std::string, FBenchmarkFunction>> m_Benchmarks;
+	};
+
+	struct FBenchmarkRegistration
+	{
+		FBenchmarkRegistration(const char* Name, FBenchmarkFunction Function)
+		{
+			FBenchmarkRegistry::Get().Register(Name, Function);
+		}
+	};
+
+	/* usage: ZERO_BENCHMARK(MyBenchmark) { ... Context.Report("Case", Value, "ns/op"); } */
+#define ZERO_BENCHMARK(Name) \
+	static void Benchmark_##Name(::ZeroUI::Benchmark::FBenchmarkContext& Context);\
+	static ::ZeroUI::Benchmark::FBenchmarkRegistration BenchmarkRegistration_##Name(#Name, &Benchmark_##Name);\
+	static void Benchmark_##Name(::ZeroUI::Benchmark::FBenchmarkContext& Context)
+
+	inline double NowNanoseconds()
+	{
+		using namespace std::chrono;
+		return static_cast<double>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+	}
+
+	/* runs the function Repeat times and returns the fastest run in nanoseconds, the fastest run is the least noisy */
+	template<typename FunctionType>
+	double MeasureMinNanoseconds(int32_t Repeat, FunctionType&& Function)
+	{
+		double Best = 0.0;
+		for (int32_t Run = 0; Run < Repeat; ++Run)
+		{
+			const double Start = NowNanoseconds();
+			Function();
+			const double Elapsed = NowNanoseconds() - Start;
+			Best = Run == 0 ? Elapsed : std::min(Best, Elapsed);
+		}
+		return Best;
+	}
+
+	/* prevents the compiler from removing a computation whose result is unused */
+	template<typename T>
+	inline void DoNotOptimize(const T& Value)
+	{
+		static volatile const void* Sink;
+		Sink = &Value;
+	}
+}
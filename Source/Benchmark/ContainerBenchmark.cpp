@@ -0,0 +1,64 @@
+#include "Benchmark.h"
+#include "MemoryStats.h"
+#include "Core/Containers/InlineVector.h"
+#include "Core/Containers/FixedVector.h"
+#include <memory>
+
+/*
+ * the temporary arrays of a frame in std::vector, TInlineVector and TFixedVector
+ * every panel arranges its children in a new array, as SWidget::Paint does. the allocations per frame are reported
+ * with the time.
+ */
+namespace ZeroUI::Benchmark
+{
+	namespace
+	{
+		constexpr int32_t NumPanels = 2000;
+		constexpr int32_t Repeat = 20;
+
+		/* the size of an FArrangedWidget, a geometry and a shared widget pointer */
+		struct FBenchArrangedWidget
+		{
+			float Geometry[14];
+			std::shared_ptr<int32_t> Widget;
+		};
+
+		/* most panels have a few children, some lists have many */
+		int32_t GetNumChildren(int32_t PanelIndex)
+		{
+			return PanelIndex % 50 == 0 ? 40 : 1 + PanelIndex % 6;
+		}
+
+		template<typename ArrayType>
+		void MeasureArrange(FBenchmarkContext& Context, const std::string& Name)
+		{
+			const std::shared_ptr<int32_t> Widget = std::make_shared<int32_t>(0);
+
+			const uint64_t AllocationsBefore = GetAllocationCount();
+			const double Elapsed = MeasureMinNanoseconds(Repeat, [&Widget]()
+			{
+				for (int32_t PanelIndex = 0; PanelIndex < NumPanels; ++PanelIndex)
+				{
+					ArrayType ArrangedChildren;
+					const int32_t NumChildren = GetNumChildren(PanelIndex);
+					for (int32_t ChildIndex = 0; ChildIndex < NumChildren; ++ChildIndex)
+					{
+						ArrangedChildren.push_back(FBenchArrangedWidget{ { static_cast<float>(ChildIndex) }, Widget });
+					}
+					DoNotOptimize(ArrangedChildren);
+				}
+			});
+			const uint64_t Allocations = GetAllocationCount() - AllocationsBefore;
+
+			Context.Report(Name, Elapsed, "ns/frame");
+			Context.Report(Name + "/Allocations", static_cast<double>(Allocations) / Repeat, "allocs/frame");
+		}
+	}
+
+	ZERO_BENCHMARK(Containers)
+	{
+		MeasureArrange<std::vector<FBenchArrangedWidget>>(Context, "Arrange/Vector");
+		MeasureArrange<TInlineVector<FBenchArrangedWidget, 8>>(Context, "Arrange/InlineVector:8");
+		MeasureArrange<TFixedVector<FBenchArrangedWidget, 64>>(Context, "Arrange/FixedVector:64");
+	}
+}
@@ -0,0 +1,139 @@
+#include "Benchmark.h"
+#include "Core/Async/JobSystem.h"
+
+/*
+ * scheduling overhead of the job system, the jobs do (almost) nothing so the measures are the cost of
+ * dispatching, stealing and joining a task
+ */
+namespace ZeroUI::Benchmark
+{
+	namespace
+	{
+		constexpr int32_t RepeatCount = 5;
+
+		/* 1, 2, 4, ... up to the number of hardware threads */
+		std::vector<uint32_t> GetWorkerCounts()
+		{
+			const uint32_t HardwareThreads = std::max(std::thread::hardware_concurrency(), 2u);
+			std::vector<uint32_t> WorkerCounts;
+			for (uint32_t Count = 1; Count < HardwareThreads; Count *= 2)
+			{
+				WorkerCounts.push_back(Count);
+			}
+			WorkerCounts.push_back(HardwareThreads - 1);
+			WorkerCounts.erase(std::unique(WorkerCounts.begin(), WorkerCounts.end()), WorkerCounts.end());
+			return WorkerCounts;
+		}
+
+		std::string WithWorkers(const std::string& Name, uint32_t NumWorkers)
+		{
+			return Name + "/Workers:" + std::to_string(NumWorkers);
+		}
+
+		void ForkJoin(int32_t Depth, std::atomic<int32_t>& Leaves)
+		{
+			if (Depth == 0)
+			{
+				Leaves.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			FJobCounter Counter;
+			for (int32_t Child = 0; Child < 4; ++Child)
+			{
+				FJobSystem::Get().Dispatch(Counter, [Depth, &Leaves]() { ForkJoin(Depth - 1, Leaves); });
+			}
+			FJobSystem::Get().Wait(Counter);
+		}
+	}
+
+	ZERO_BENCHMARK(JobSystem_Dispatch)
+	{
+		constexpr int32_t NumJobs = 100000;
+		for (uint32_t NumWorkers : GetWorkerCounts())
+		{
+			FJobSystem::Get().Initialize(NumWorkers);
+
+			std::atomic<int32_t> Executed = 0;
+			const double Elapsed = MeasureMinNanoseconds(RepeatCount, [&Executed]()
+			{
+				FJobCounter Counter;
+				for (int32_t JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+				{
+					FJobSystem::Get().Dispatch(Counter, [&Executed]() { Executed.fetch_add(1, std::memory_order_relaxed); });
+				}
+				FJobSystem::Get().Wait(Counter);
+			});
+			Context.Report(WithWorkers("EmptyJob", NumWorkers), Elapsed / NumJobs, "ns/task");
+
+			FJobSystem::Get().Shutdown();
+		}
+	}
+
+	ZERO_BENCHMARK(JobSystem_ForkJoin)
+	{
+		// 4^7 leaves, 21845 tasks
+		constexpr int32_t Depth = 7;
+		constexpr int32_t NumTasks = (1 << (2 * (Depth + 1))) / 3;
+		for (uint32_t NumWorkers : GetWorkerCounts())
+		{
+			FJobSystem::Get().Initialize(NumWorkers);
+
+			std::atomic<int32_t> Leaves = 0;
+			const double Elapsed = MeasureMinNanoseconds(RepeatCount, [&Leaves]() { ForkJoin(Depth, Leaves); });
+			Context.Report(WithWorkers("NestedTree", NumWorkers), Elapsed / NumTasks, "ns/task");
+
+			FJobSystem::Get().Shutdown();
+		}
+	}
+
+	ZERO_BENCHMARK(JobSystem_ParallelFor)
+	{
+		constexpr int32_t Num = 1000000;
+		std::vector<float> Values(Num, 1.0f);
+		for (uint32_t NumWorkers : GetWorkerCounts())
+		{
+			FJobSystem::Get().Initialize(NumWorkers);
+
+			for (int32_t MinBatchSize : { 1, 64, 4096 })
+			{
+				const double Elapsed = MeasureMinNanoseconds(RepeatCount, [&Values, MinBatchSize]()
+				{
+					FJobSystem::Get().ParallelFor(Num, [&Values](int32_t Index) { Values[Index] = Values[Index] * 0.5f + 1.0f; }, MinBatchSize);
+				});
+				Context.Report(WithWorkers("Batch:" + std::to_string(MinBatchSize), NumWorkers), Elapsed / Num, "ns/index");
+			}
+
+			FJobSystem::Get().Shutdown();
+		}
+		DoNotOptimize(Values);
+	}
+
+	ZERO_BENCHMARK(JobSystem_Dependencies)
+	{
+		// every job depends on the previous one, measures the latency of releasing a continuation
+		constexpr int32_t ChainLength = 10000;
+		for (uint32_t NumWorkers : GetWorkerCounts())
+		{
+			FJobSystem::Get().Initialize(NumWorkers);
+
+			const double Elapsed = MeasureMinNanoseconds(RepeatCount, []()
+			{
+				std::vector<Scope<FJobCounter>> Counters;
+				Counters.reserve(ChainLength);
+				Counters.push_back(CreateScope<FJobCounter>());
+				FJobSystem::Get().Dispatch(*Counters.back(), []() {});
+				for (int32_t JobIndex = 1; JobIndex < ChainLength; ++JobIndex)
+				{
+					FJobCounter& Prerequisite = *Counters.back();
+					Counters.push_back(CreateScope<FJobCounter>());
+					FJobSystem::Get().Dispatch(*Counters.back(), []() {}, Prerequisite);
+				}
+				FJobSystem::Get().Wait(*Counters.back());
+			});
+			Context.Report(WithWorkers("Chain", NumWorkers), Elapsed / ChainLength, "ns/task");
+
+			FJobSystem::Get().Shutdown();
+		}
+	}
+}
@@ -0,0 +1,95 @@
+#include "Benchmark.h"
+#include "MemoryStats.h"
+#include <iostream>
+#include <cstring>
+
+using namespace ZeroUI::Benchmark;
+
+namespace
+{
+	/* names are plain ascii identifiers, only the quotes and backslashes need escaping */
+	std::string EscapeJson(const std::string& Text)
+	{
+		std::string Escaped;
+		Escaped.reserve(Text.size());
+		for (char Character : Text)
+		{
+			if (Character == '"' || Character == '\\')
+			{
+				Escaped.push_back('\\');
+			}
+			Escaped.push_back(Character);
+		}
+		return Escaped;
+	}
+}
+
+/*
+ * usage: Benchmark [--json] [filter]
+ * runs the benchmarks whose name contains the filter, all of them without filter
+ * --json prints a single json document on stdout, to be compared between builds
+ */
+int main(int Argc, char** Argv)
+{
+	bool bJson = false;
+	const char* Filter = "";
+	for (int ArgIndex = 1; ArgIndex < Argc; ++ArgIndex)
+	{
+		if (std::strcmp(Argv[ArgIndex], "--json") == 0)
+		{
+			bJson = true;
+		}
+		else
+		{
+			Filter = Argv[ArgIndex];
+		}
+	}
+
+	bool bFirstBenchmark = true;
+	if (bJson)
+	{
+		std::cout << "{\n  \"benchmarks\": [";
+	}
+
+	for (const auto& [Name, Function] : FBenchmarkRegistry::Get().GetBenchmarks())
+	{
+		if (Name.find(Filter) == std::string::npos)
+		{
+			continue;
+		}
+
+		FBenchmarkContext Context;
+		Function(Context);
+
+		if (bJson)
+		{
+			for (const FBenchmarkResult& Result : Context.GetResults())
+			{
+				std::cout << (bFirstBenchmark ? "\n" : ",\n")
+					<< "    { \"benchmark\": \"" << EscapeJson(Name)
+					<< "\", \"name\": \"" << EscapeJson(Result.Name)
+					<< "\", \"value\": " << Result.Value
+					<< ", \"unit\": \"" << EscapeJson(Result.Unit) << "\" }";
+				bFirstBenchmark = false;
+			}
+		}
+		else
+		{
+			std::cout << Name << std::endl;
+			for (const FBenchmarkResult& Result : Context.GetResults())
+			{
+				std::cout << "    " << Result.Name << ": " << Result.Value << " " << Result.Unit << std::endl;
+			}
+		}
+	}
+
+	if (bJson)
+	{
+		std::cout << "\n  ],\n  \"peak_rss_bytes\": " << GetPeakResidentBytes() << "\n}" << std::endl;
+	}
+	else
+	{
+		std::cout << "peak rss: " << GetPeakResidentBytes() / (1024 * 1024) << " MB" << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,71 @@
+#include "MemoryStats.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+	std::atomic<uint64_t> GAllocationCount = 0;
+
+	void* CountedAllocate(std::size_t Size)
+	{
+		GAllocationCount.fetch_add(1, std::memory_order_relaxed);
+		if (void* Pointer = std::malloc(Size == 0 ? 1 : Size))
+		{
+			return Pointer;
+		}
+		throw std::bad_alloc();
+	}
+}
+
+void* operator new(std::size_t Size) { return CountedAllocate(Size); }
+void* operator new[](std::size_t Size) { return CountedAllocate(Size); }
+void* operator new(std::size_t Size, const std::nothrow_t&) noexcept
+{
+	GAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	return std::malloc(Size == 0 ? 1 : Size);
+}
+void* operator new[](std::size_t Size, const std::nothrow_t&) noexcept
+{
+	GAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	return std::malloc(Size == 0 ? 1 : Size);
+}
+void operator delete(void* Pointer) noexcept { std::free(Pointer); }
+void operator delete[](void* Pointer) noexcept { std::free(Pointer); }
+void operator delete(void* Pointer, std::size_t) noexcept { std::free(Pointer); }
+void operator delete[](void* Pointer, std::size_t) noexcept { std::free(Pointer); }
+
+namespace ZeroUI::Benchmark
+{
+	uint64_t GetAllocationCount()
+	{
+		return GAllocationCount.load(std::memory_order_relaxed);
+	}
+
+	uint64_t GetPeakResidentBytes()
+	{
+#if defined(_WIN32)
+		PROCESS_MEMORY_COUNTERS Counters;
+		if (::GetProcessMemoryInfo(::GetCurrentProcess(), &Counters, sizeof(Counters)))
+		{
+			return Counters.PeakWorkingSetSize;
+		}
+		return 0;
+#else
+		struct rusage Usage;
+		if (::getrusage(RUSAGE_SELF, &Usage) == 0)
+		{
+			// linux reports kilobytes
+			return static_cast<uint64_t>(Usage.ru_maxrss) * 1024;
+		}
+		return 0;
+#endif
+	}
+}
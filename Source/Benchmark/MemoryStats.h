@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ZeroUI::Benchmark
+{
+	/* number of calls to operator new since the start of the process, the benchmark target replaces the global operator new */
+	uint64_t GetAllocationCount();
+
+	/* the highest resident memory of the process, in bytes */
+	uint64_t GetPeakResidentBytes();
+}
@@ -0,0 +1,109 @@
+#include "Benchmark.h"
+#include "MemoryStats.h"
+#include "Core/StringUtils.h"
+#include "Core/StringFormat.h"
+#include <iostream>
+
+/*
+ * StringUtils::Format against StringUtils::FormatTo on the labels a ui reformats every frame
+ * the same texts are formatted by both, the allocations per call are reported with the time
+ * the texts of both are compared first, a benchmark of a FormatTo that writes another text is meaningless
+ */
+namespace ZeroUI::Benchmark
+{
+	namespace
+	{
+		constexpr int32_t NumLabels = 10000;
+		constexpr int32_t Repeat = 10;
+
+		template<typename FunctionType>
+		void MeasureFormat(FBenchmarkContext& Context, const std::string& Name, FunctionType&& Function)
+		{
+			const uint64_t AllocationsBefore = GetAllocationCount();
+			const double Elapsed = MeasureMinNanoseconds(Repeat, Function);
+			const uint64_t Allocations = GetAllocationCount() - AllocationsBefore;
+
+			Context.Report(Name, Elapsed / NumLabels, "ns/label");
+			Context.Report(Name + "/Allocations", static_cast<double>(Allocations) / (Repeat * NumLabels), "allocs/label");
+		}
+
+		/* returns 1 when FormatTo doesn't write the text of Format, the difference is printed */
+		template<typename... ArgTypes>
+		int32_t CheckSameText(Utils::StringUtils::FormatString<ArgTypes...> Format, const ArgTypes&... Args)
+		{
+			const std::string Expected = Utils::StringUtils::Format(Format.GetFormat(), Args...);
+
+			char Label[256];
+			Utils::StringUtils::FormatTo<ArgTypes...>(Label, sizeof(Label), Format, Args...);
+			if (Expected == Label)
+			{
+				return 0;
+			}
+
+			std::cerr << "StringFormat: \"" << Format.GetFormat() << "\" is \"" << Expected << "\" with Format and \"" << Label << "\" with FormatTo" << std::endl;
+			return 1;
+		}
+	}
+
+	ZERO_BENCHMARK(StringFormat)
+	{
+		const std::string Name = "Frame";
+
+		int32_t NumMismatches = 0;
+		NumMismatches += CheckSameText("Item {0}", 42);
+		NumMismatches += CheckSameText("{0} {1,6}: {2,-8} ms", Name, 1234, 1234 * 0.016f);
+		NumMismatches += CheckSameText("{0} fps, {1}", "abc", static_cast<const char*>("def"));
+		NumMismatches += CheckSameText("{0}{1}{2}", 'a', static_cast<uint8_t>('b'), static_cast<signed char>('c'));
+		NumMismatches += CheckSameText("{1,-4}|{0,4}|{{{2}}}", true, -7, 1.0e10);
+		Context.Report("Mismatches", NumMismatches, "texts");
+
+		MeasureFormat(Context, "Format/Integer", []()
+		{
+			for (int32_t Index = 0; Index < NumLabels; ++Index)
+			{
+				const std::string Label = Utils::StringUtils::Format("Item {0}", Index);
+				DoNotOptimize(Label);
+			}
+		});
+
+		MeasureFormat(Context, "FormatTo/Integer", []()
+		{
+			char Label[64];
+			for (int32_t Index = 0; Index < NumLabels; ++Index)
+			{
+				Utils::StringUtils::FormatTo(Label, "Item {0}", Index);
+				DoNotOptimize(Label);
+			}
+		});
+
+		MeasureFormat(Context, "Format/Mixed", [&Name]()
+		{
+			for (int32_t Index = 0; Index < NumLabels; ++Index)
+			{
+				const std::string Label = Utils::StringUtils::Format("{0} {1,6}: {2,-8} ms", Name, Index, Index * 0.016f);
+				DoNotOptimize(Label);
+			}
+		});
+
+		MeasureFormat(Context, "FormatTo/Mixed", [&Name]()
+		{
+			char Label[64];
+			for (int32_t Index = 0; Index < NumLabels; ++Index)
+			{
+				Utils::StringUtils::FormatTo(Label, "{0} {1,6}: {2,-8} ms", Name, Index, Index * 0.016f);
+				DoNotOptimize(Label);
+			}
+		});
+
+		// the text of a label kept between frames, it only allocates the first time
+		MeasureFormat(Context, "FormatTo/RetainedString", [&Name]()
+		{
+			static std::string Label;
+			for (int32_t Index = 0; Index < NumLabels; ++Index)
+			{
+				Utils::StringUtils::FormatTo(Label, "{0} {1,6}: {2,-8} ms", Name, Index, Index * 0.016f);
+				DoNotOptimize(Label);
+			}
+		});
+	}
+}
@@ -0,0 +1,328 @@
+#include "Benchmark.h"
+#include "MemoryStats.h"
+#include "SlateCore/Widgets/SWidgets.h"
+#include "SlateCore/Layout/ArrangedWidget.h"
+#include "SlateCore/Layout/Children.h"
+#include "SlateCore/Layout/ParallelLayout.h"
+#include "SlateCore/Rendering/DrawElements.h"
+#include "Core/Misc/Attribute.h"
+#include <random>
+
+/*
+ * cost of every phase of the widget pipeline on synthetic trees
+ * construction, attribute update, prepass, arrange, paint element generation and hit test are measured separately
+ */
+namespace ZeroUI::Benchmark
+{
+	namespace
+	{
+		constexpr float LeafSize = 16.0f;
+
+		class FBenchChildren : public FChildren
+		{
+		public:
+			using FChildren::FChildren;
+
+			void Add(const Ref<SWidget>& Widget) { m_Widgets.push_back(Widget); }
+
+			virtual int32_t Num() const override { return static_cast<int32_t>(m_Widgets.size()); }
+
+			virtual Ref<SWidget> GetChildAt(int32_t Index) override { return m_Widgets[Index]; }
+
+			virtual Ref<const SWidget> GetChildAt(int32_t Index) const override { return m_Widgets[Index]; }
+
+			virtual const FSlotBase& GetSlotAt(int32_t ChildIndex) const override
+			{
+				return FNoChildren::NoChildrenInstance.GetSlotAt(ChildIndex);
+			}
+
+		private:
+			std::vector<Ref<SWidget>> m_Widgets;
+		};
+
+		/* a leaf drawing a box of its color attribute */
+		class SBenchLeaf : public SWidget
+		{
+		public:
+			SBenchLeaf()
+			{
+				SetThreadSafeLayout(true);
+			}
+
+			void SetColor(TAttribute<ZMath::FColor4> InColor)
+			{
+				m_Color = std::move(InColor);
+				Invalidate(EInvalidateWidgetReason::Paint);
+			}
+
+			virtual FChildren* GetChildren() override { return &FNoChildren::NoChildrenInstance; }
+
+		protected:
+			virtual int32_t OnPaint(const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32_t LayerId) const override
+			{
+				FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), m_Color.Get());
+				return LayerId;
+			}
+
+			virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override
+			{
+			}
+
+			virtual ZMath::vec2 ComputeDesiredSize(float LayoutScaleMultiplier) const override
+			{
+				return ZMath::vec2(LeafSize, LeafSize);
+			}
+
+		private:
+			TAttribute<ZMath::FColor4> m_Color = ZMath::FColor4(1.0f);
+		};
+
+		/* stacks its children vertically */
+		class SBenchPanel : public SWidget
+		{
+		public:
+			SBenchPanel()
+				: m_Children(this)
+			{
+				SetThreadSafeLayout(true);
+			}
+
+			void AddChild(const Ref<SWidget>& Child)
+			{
+				m_Children.Add(Child);
+				Child->AssignParentWidget(*this);
+			}
+
+			virtual FChildren* GetChildren() override { return &m_Children; }
+
+		protected:
+			virtual int32_t OnPaint(const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32_t LayerId) const override
+			{
+				FArrangedChildren ArrangedChildren(EVisibility::Visible);
+				ArrangeChildren(AllottedGeometry, ArrangedChildren);
+
+				int32_t MaxLayerId = LayerId;
+				for (const FArrangedWidget& Child : ArrangedChildren)
+				{
+					MaxLayerId = std::max(MaxLayerId, Child.GetWidgetPtr()->Paint(Child.GetGeometry(), MyCullingRect, OutDrawElements, LayerId + 1));
+				}
+				return MaxLayerId;
+			}
+
+			virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override
+			{
+				float Offset = 0.0f;
+				for (int32_t ChildIndex = 0; ChildIndex < m_Children.Num(); ++ChildIndex)
+				{
+					Ref<SWidget> Child = std::const_pointer_cast<SWidget>(m_Children.GetChildAt(ChildIndex));
+					const ZMath::vec2 ChildSize = Child->GetDesiredSize();
+					ArrangedChildren.AddWidget(FArrangedWidget(Child, AllottedGeometry.MakeChild(ZMath::vec2(0.0f, Offset), ChildSize)));
+					Offset += ChildSize.y;
+				}
+			}
+
+			virtual ZMath::vec2 ComputeDesiredSize(float LayoutScaleMultiplier) const override
+			{
+				ZMath::vec2 DesiredSize(0.0f, 0.0f);
+				for (int32_t ChildIndex = 0; ChildIndex < m_Children.Num(); ++ChildIndex)
+				{
+					const ZMath::vec2 ChildSize = m_Children.GetChildAt(ChildIndex)->GetDesiredSize();
+					DesiredSize.x = std::max(DesiredSize.x, ChildSize.x);
+					DesiredSize.y += ChildSize.y;
+				}
+				return DesiredSize;
+			}
+
+		private:
+			FBenchChildren m_Children;
+		};
+
+		enum class ETreeShape : uint8_t
+		{
+			/* chains of 64 nested panels */
+			Deep,
+			/* a single panel with all the leaves */
+			Wide,
+			/* panels of 8 children, a child out of 4 is a leaf */
+			Mixed,
+		};
+
+		const char* ToString(ETreeShape Shape)
+		{
+			switch (Shape)
+			{
+			case ETreeShape::Deep: return "Deep";
+			case ETreeShape::Wide: return "Wide";
+			default: return "Mixed";
+			}
+		}
+
+		struct FBenchTree
+		{
+			Ref<SBenchPanel> Root;
+			std::vector<Ref<SBenchLeaf>> Leaves;
+			int32_t NumWidgets = 1;
+		};
+
+		Ref<SBenchLeaf> AddLeaf(FBenchTree& Tree, const Ref<SBenchPanel>& Parent)
+		{
+			Ref<SBenchLeaf> Leaf = CreateRef<SBenchLeaf>();
+			Parent->AddChild(Leaf);
+			Tree.Leaves.push_back(Leaf);
+			++Tree.NumWidgets;
+			return Leaf;
+		}
+
+		Ref<SBenchPanel> AddPanel(FBenchTree& Tree, const Ref<SBenchPanel>& Parent)
+		{
+			Ref<SBenchPanel> Panel = CreateRef<SBenchPanel>();
+			Parent->AddChild(Panel);
+			++Tree.NumWidgets;
+			return Panel;
+		}
+
+		void BuildMixed(FBenchTree& Tree, const Ref<SBenchPanel>& Parent, int32_t TargetWidgets)
+		{
+			for (int32_t ChildIndex = 0; ChildIndex < 8 && Tree.NumWidgets < TargetWidgets; ++ChildIndex)
+			{
+				if (ChildIndex % 4 == 0)
+				{
+					AddLeaf(Tree, Parent);
+				}
+				else
+				{
+					Ref<SBenchPanel> Panel = AddPanel(Tree, Parent);
+					// split what is left between the remaining panels so the tree stays balanced
+					const int32_t Budget = Tree.NumWidgets + std::max((TargetWidgets - Tree.NumWidgets) / (8 - ChildIndex), 1);
+					BuildMixed(Tree, Panel, std::min(Budget, TargetWidgets));
+				}
+			}
+		}
+
+		FBenchTree BuildTree(ETreeShape Shape, int32_t TargetWidgets)
+		{
+			FBenchTree Tree;
+			Tree.Root = CreateRef<SBenchPanel>();
+			switch (Shape)
+			{
+			case ETreeShape::Deep:
+				while (Tree.NumWidgets < TargetWidgets)
+				{
+					Ref<SBenchPanel> Panel = Tree.Root;
+					for (int32_t Depth = 0; Depth < 63 && Tree.NumWidgets + 1 < TargetWidgets; ++Depth)
+					{
+						Panel = AddPanel(Tree, Panel);
+					}
+					AddLeaf(Tree, Panel);
+				}
+				break;
+			case ETreeShape::Wide:
+				while (Tree.NumWidgets < TargetWidgets)
+				{
+					AddLeaf(Tree, Tree.Root);
+				}
+				break;
+			case ETreeShape::Mixed:
+				while (Tree.NumWidgets < TargetWidgets)
+				{
+					BuildMixed(Tree, Tree.Root, TargetWidgets);
+				}
+				break;
+			}
+			return Tree;
+		}
+
+		/* time and allocations of a phase, per widget */
+		template<typename FunctionType>
+		void MeasurePhase(FBenchmarkContext& Context, const std::string& Name, int32_t NumWidgets, int32_t Repeat, FunctionType&& Function)
+		{
+			const uint64_t AllocationsBefore = GetAllocationCount();
+			const double Elapsed = MeasureMinNanoseconds(Repeat, Function);
+			const uint64_t Allocations = GetAllocationCount() - AllocationsBefore;
+
+			Context.Report(Name, Elapsed / NumWidgets, "ns/widget");
+			Context.Report(Name + "/Allocations", static_cast<double>(Allocations) / Repeat, "allocs/frame");
+		}
+	}
+
+	ZERO_BENCHMARK(WidgetPipeline)
+	{
+		std::mt19937 RandomEngine(42);
+
+		for (ETreeShape Shape : { ETreeShape::Deep, ETreeShape::Wide, ETreeShape::Mixed })
+		{
+			for (int32_t TargetWidgets : { 1000, 10000, 100000, 1000000 })
+			{
+				const std::string Prefix = std::string(ToString(Shape)) + "/" + std::to_string(TargetWidgets) + "/";
+				const int32_t Repeat = TargetWidgets >= 1000000 ? 1 : 3;
+
+				// the previous tree is destroyed out of the measure
+				FBenchTree Tree;
+				double ConstructionElapsed = 0.0;
+				const uint64_t AllocationsBefore = GetAllocationCount();
+				for (int32_t Run = 0; Run < Repeat; ++Run)
+				{
+					Tree = FBenchTree();
+					const double Start = NowNanoseconds();
+					FBenchTree NewTree = BuildTree(Shape, TargetWidgets);
+					const double Elapsed = NowNanoseconds() - Start;
+					ConstructionElapsed = Run == 0 ? Elapsed : std::min(ConstructionElapsed, Elapsed);
+					Tree = std::move(NewTree);
+				}
+				const int32_t NumWidgets = Tree.NumWidgets;
+				Context.Report(Prefix + "Construction", ConstructionElapsed / NumWidgets, "ns/widget");
+				Context.Report(Prefix + "Construction/Allocations", static_cast<double>(GetAllocationCount() - AllocationsBefore) / Repeat, "allocs/frame");
+
+				float Frame = 0.0f;
+				MeasurePhase(Context, Prefix + "AttributeUpdate", NumWidgets, Repeat, [&Tree, &Frame]()
+				{
+					Frame += 1.0f;
+					for (const Ref<SBenchLeaf>& Leaf : Tree.Leaves)
+					{
+						Leaf->SetColor(ZMath::FColor4(Frame, 1.0f, 1.0f, 1.0f));
+					}
+				});
+
+				MeasurePhase(Context, Prefix + "Prepass", NumWidgets, Repeat, [&Tree]()
+				{
+					Tree.Root->SlatePrepass(1.0f);
+				});
+
+				const FGeometry RootGeometry = FGeometry::MakeRoot(Tree.Root->GetDesiredSize(), FSlateLayoutTransform(ZMath::vec2(0.0f, 0.0f)));
+				FArrangedWidgetTree ArrangedTree;
+				MeasurePhase(Context, Prefix + "Arrange", NumWidgets, Repeat, [&Tree, &RootGeometry, &ArrangedTree]()
+				{
+					FSlateParallelLayout::ArrangeTree(Tree.Root, RootGeometry, ArrangedTree);
+				});
+
+				FSlateWindowElementList ElementList;
+				const FSlateRect CullingRect(ZMath::vec2(0.0f, 0.0f), RootGeometry.GetLocalSize());
+				MeasurePhase(Context, Prefix + "Paint", NumWidgets, Repeat, [&Tree, &RootGeometry, &CullingRect, &ElementList]()
+				{
+					ElementList.ResetElementList();
+					Tree.Root->Paint(RootGeometry, CullingRect, ElementList, 0);
+				});
+
+				constexpr int32_t NumQueries = 1000;
+				std::uniform_real_distribution<float> RandomX(0.0f, RootGeometry.GetLocalSize().x);
+				std::uniform_real_distribution<float> RandomY(0.0f, RootGeometry.GetLocalSize().y);
+				std::vector<ZMath::vec2> Points;
+				for (int32_t QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+				{
+					Points.emplace_back(RandomX(RandomEngine), RandomY(RandomEngine));
+				}
+
+				int32_t Hits = 0;
+				const double HitTestElapsed = MeasureMinNanoseconds(Repeat, [&ArrangedTree, &Points, &Hits]()
+				{
+					for (const ZMath::vec2& Point : Points)
+					{
+						Hits += ArrangedTree.HitTest(Point) != INDEX_NONE ? 1 : 0;
+					}
+				});
+				Context.Report(Prefix + "HitTest", HitTestElapsed / NumQueries, "ns/query");
+				DoNotOptimize(Hits);
+			}
+		}
+	}
+}
@@ -0,0 +1,33 @@
+#include "Test.h"
+#include "Core/AsyncLog.h"
+#include <string>
+
+namespace ZeroUI::Test
+{
+	/* a message whose format is invalid is written as an error, the queue goes on */
+	ZERO_TEST(AsyncLogInvalidFormat)
+	{
+		FAsyncLogSettings Settings;
+		Settings.QueueCapacity = 16;
+		Settings.OverflowPolicy = EAsyncLogOverflowPolicy::Block;
+		FAsyncLog Log(Settings);
+
+		// formatted by the background thread
+		Log.Push(ELogCategory::Core, spdlog::level::info, "{0} {1}", 1);
+		// formatted by the calling thread
+		Log.Push(ELogCategory::Core, spdlog::level::info, "{:d}", std::string("text"));
+		Log.Push(ELogCategory::Core, spdlog::level::info, "{0}", 2);
+
+		// hangs if one of the cells is never published
+		Log.Flush();
+
+		// the queue holds 16 messages, the cells of the invalid messages must be reusable
+		for (int32_t Index = 0; Index < 32; ++Index)
+		{
+			Log.Push(ELogCategory::Core, spdlog::level::info, "{0} {1}", Index);
+		}
+		Log.Flush();
+
+		ZERO_CHECK(Log.GetNumDropped() == 0);
+	}
+}
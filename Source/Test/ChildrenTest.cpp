@@ -0,0 +1,91 @@
+#include "Test.h"
+#include "SlateCore/Widgets/SWidgets.h"
+#include "SlateCore/Layout/Children.h"
+#include "SlateCore/Debugging/SlateInvalidationTrace.h"
+
+namespace ZeroUI::Test
+{
+	namespace
+	{
+		class FTestSlot : public TSlotBase<FTestSlot>
+		{
+		};
+
+		class STestWidget : public SWidget
+		{
+		public:
+			STestWidget()
+				: m_Children(this)
+			{
+			}
+
+			TPanelChildren<FTestSlot>& GetPanelChildren() { return m_Children; }
+
+			virtual FChildren* GetChildren() override { return &m_Children; }
+
+		protected:
+			virtual int32_t OnPaint(const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32_t LayerId) const override
+			{
+				return LayerId;
+			}
+
+			virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override
+			{
+			}
+
+			virtual ZMath::vec2 ComputeDesiredSize(float LayoutScaleMultiplier) const override
+			{
+				return ZMath::vec2(0.0f, 0.0f);
+			}
+
+		private:
+			TPanelChildren<FTestSlot> m_Children;
+		};
+
+		/* the invalidations of the widget recorded in the current frame */
+		std::vector<FInvalidationTraceEvent> GetInvalidations(const SWidget& Widget)
+		{
+			const FSlateInvalidationTrace& Trace = FSlateInvalidationTrace::Get();
+			std::vector<FInvalidationTraceEvent> Events = Trace.GetEvents(Trace.GetFrameNumber());
+			std::erase_if(Events, [&Widget](const FInvalidationTraceEvent& Event) { return Event.Widget != &Widget; });
+			return Events;
+		}
+	}
+
+#if ZERO_ENABLE_INVALIDATION_TRACE
+	/* the slots invalidate their owner once per batch update, like the changes of the children */
+	ZERO_TEST(ChildrenBatchSlotInvalidation)
+	{
+		FSlateInvalidationTrace& Trace = FSlateInvalidationTrace::Get();
+		Trace.SetEnabled(true);
+
+		Ref<STestWidget> Panel = CreateRef<STestWidget>();
+		TPanelChildren<FTestSlot>& Children = Panel->GetPanelChildren();
+		for (int32_t Index = 0; Index < 3; ++Index)
+		{
+			Children.AddSlot(CreateRef<STestWidget>());
+		}
+
+		Trace.Reset();
+		Children[0].Invalidate(EInvalidateWidgetReason::Layout);
+		ZERO_CHECK(GetInvalidations(*Panel).size() == 1);
+
+		Trace.Reset();
+		{
+			FScopedChildrenUpdate ScopedUpdate(Children);
+			Children[0].Invalidate(EInvalidateWidgetReason::Layout);
+			Children[1].Invalidate(EInvalidateWidgetReason::Layout);
+			Children[2].Invalidate(EInvalidateWidgetReason::Paint);
+			Children.AddSlot(CreateRef<STestWidget>());
+			ZERO_CHECK(GetInvalidations(*Panel).empty());
+		}
+
+		const std::vector<FInvalidationTraceEvent> Invalidations = GetInvalidations(*Panel);
+		ZERO_CHECK(Invalidations.size() == 1);
+		ZERO_CHECK(!Invalidations.empty() && Invalidations[0].Reason == (EInvalidateWidgetReason::Layout | EInvalidateWidgetReason::Paint | EInvalidateWidgetReason::Child_Order));
+
+		Trace.Reset();
+		Trace.SetEnabled(false);
+	}
+#endif
+}
@@ -0,0 +1,67 @@
+#include "Test.h"
+#include "SlateCore/Layout/Clipping.h"
+
+namespace ZeroUI::Test
+{
+	/* a zone covering the active state doesn't clip anything more, the active state is reused */
+	ZERO_TEST(ClippingReuseCoveringZone)
+	{
+		FSlateClippingManager Manager;
+		const int32_t WindowIndex = Manager.PushClip(FSlateClippingZone(FSlateRect(0.0f, 0.0f, 100.0f, 100.0f)));
+		const int32_t PanelIndex = Manager.PushClip(FSlateClippingZone(FSlateRect(10.0f, 10.0f, 50.0f, 50.0f)));
+		ZERO_CHECK(PanelIndex != WindowIndex);
+
+		/* same bounds and bigger bounds both cover the panel */
+		ZERO_CHECK(Manager.PushClip(FSlateClippingZone(FSlateRect(10.0f, 10.0f, 50.0f, 50.0f))) == PanelIndex);
+		ZERO_CHECK(Manager.PushClip(FSlateClippingZone(FSlateRect(-20.0f, 0.0f, 80.0f, 60.0f))) == PanelIndex);
+		ZERO_CHECK(Manager.GetClippingStates().size() == 2);
+
+		/* a stencil state is covered by its bounding box */
+		const ZMath::vec2 TopLeft(30.0f, 20.0f);
+		const ZMath::vec2 TopRight(40.0f, 30.0f);
+		const ZMath::vec2 BottomLeft(20.0f, 30.0f);
+		const ZMath::vec2 BottomRight(30.0f, 40.0f);
+		const int32_t RotatedIndex = Manager.PushClip(FSlateClippingZone(TopLeft, TopRight, BottomLeft, BottomRight));
+		ZERO_CHECK(RotatedIndex != PanelIndex);
+		ZERO_CHECK(Manager.PushClip(FSlateClippingZone(FSlateRect(15.0f, 15.0f, 45.0f, 45.0f))) == RotatedIndex);
+		ZERO_CHECK(Manager.GetClippingStates().size() == 3);
+	}
+
+	/* a zone smaller than the active state clips more, it gets its own state */
+	ZERO_TEST(ClippingNewStateForNarrowerZone)
+	{
+		FSlateClippingManager Manager;
+		const int32_t WindowIndex = Manager.PushClip(FSlateClippingZone(FSlateRect(0.0f, 0.0f, 100.0f, 100.0f)));
+
+		/* fully inside of the window */
+		const int32_t InsideIndex = Manager.PushClip(FSlateClippingZone(FSlateRect(10.0f, 10.0f, 50.0f, 50.0f)));
+		ZERO_CHECK(InsideIndex != WindowIndex);
+		ZERO_CHECK(Manager.GetClippingStates()[InsideIndex].GetBoundingBox() == FSlateRect(10.0f, 10.0f, 50.0f, 50.0f));
+		Manager.PopClip();
+
+		/* partially outside of the window, intersected with it */
+		const int32_t PartialIndex = Manager.PushClip(FSlateClippingZone(FSlateRect(50.0f, -10.0f, 150.0f, 50.0f)));
+		ZERO_CHECK(PartialIndex != WindowIndex && PartialIndex != InsideIndex);
+		ZERO_CHECK(Manager.GetClippingStates()[PartialIndex].GetBoundingBox() == FSlateRect(50.0f, 0.0f, 100.0f, 50.0f));
+	}
+
+	/* always clip and non intersecting zones never reuse the active state */
+	ZERO_TEST(ClippingNoReuseForAlwaysClipOrIgnoredParent)
+	{
+		FSlateClippingManager Manager;
+		const int32_t WindowIndex = Manager.PushClip(FSlateClippingZone(FSlateRect(0.0f, 0.0f, 100.0f, 100.0f)));
+
+		FSlateClippingZone AlwaysClipZone(FSlateRect(0.0f, 0.0f, 200.0f, 200.0f));
+		AlwaysClipZone.SetAlwaysClip(true);
+		const int32_t AlwaysClipIndex = Manager.PushClip(AlwaysClipZone);
+		ZERO_CHECK(AlwaysClipIndex != WindowIndex);
+		ZERO_CHECK(Manager.GetClippingStates()[AlwaysClipIndex].GetAlwaysClip());
+		Manager.PopClip();
+
+		FSlateClippingZone IgnoreParentZone(FSlateRect(-50.0f, -50.0f, 200.0f, 200.0f));
+		IgnoreParentZone.SetShouldIntersectParent(false);
+		const int32_t IgnoreParentIndex = Manager.PushClip(IgnoreParentZone);
+		ZERO_CHECK(IgnoreParentIndex != WindowIndex);
+		ZERO_CHECK(Manager.GetClippingStates()[IgnoreParentIndex].GetBoundingBox() == FSlateRect(-50.0f, -50.0f, 200.0f, 200.0f));
+	}
+}
@@ -0,0 +1,24 @@
+#include "Test.h"
+#include "Core/Containers/FixedVector.h"
+
+namespace ZeroUI::Test
+{
+	/* the vector can be filled up to its bound by every way of adding elements */
+	ZERO_TEST(FixedVectorFill)
+	{
+		TFixedVector<int32_t, 4> Vector = { 1, 2, 3 };
+		ZERO_CHECK(Vector.size() == 3);
+		ZERO_CHECK(Vector[2] == 3);
+
+		Vector.push_back(4);
+		ZERO_CHECK(Vector.full());
+
+		Vector.resize(2);
+		Vector.resize(4, 7);
+		ZERO_CHECK(Vector.size() == 4 && Vector[3] == 7);
+
+		Vector.clear();
+		Vector.resize(4);
+		ZERO_CHECK(Vector.size() == 4 && Vector[0] == 0);
+	}
+}
@@ -0,0 +1,46 @@
+#include "Test.h"
+#include "Slate/Framework/Application/InputRecording.h"
+
+namespace ZeroUI::Test
+{
+	namespace
+	{
+		FInputRecording MakeRecording()
+		{
+			FInputRecording Recording;
+			for (uint64_t Index = 0; Index < 3; ++Index)
+			{
+				FInputRecord Record;
+				Record.TimeNs = Index * 1000;
+				Record.Type = EInputRecordType::MouseMove;
+				Record.Position = ZMath::vec2(static_cast<float>(Index), 0.0f);
+				Recording.Add(Record);
+			}
+			return Recording;
+		}
+	}
+
+	/* a deserialized recording replaces the records, a failed one leaves the recording empty */
+	ZERO_TEST(InputRecordingDeserializeReplaces)
+	{
+		std::vector<uint8_t> Data;
+		MakeRecording().Serialize(Data);
+
+		FInputRecording Recording = MakeRecording();
+		ZERO_CHECK(Recording.Deserialize(Data.data(), Data.size()));
+		ZERO_CHECK(Recording.GetRecords().size() == 3);
+		ZERO_CHECK(Recording.GetDurationNs() == 2000);
+
+		ZERO_CHECK(Recording.Deserialize(Data.data(), Data.size()));
+		ZERO_CHECK(Recording.GetRecords().size() == 3);
+
+		// the last record is cut in the middle of its position
+		ZERO_CHECK(!Recording.Deserialize(Data.data(), Data.size() - 2));
+		ZERO_CHECK(Recording.GetRecords().empty());
+
+		ZERO_CHECK(Recording.Deserialize(Data.data(), Data.size()));
+		const uint8_t NotARecording[] = { 1, 2, 3 };
+		ZERO_CHECK(!Recording.Deserialize(NotARecording, sizeof(NotARecording)));
+		ZERO_CHECK(Recording.GetRecords().empty());
+	}
+}
@@ -1,7 +1,44 @@
-#include "iostream"
+#include "Test.h"
+#include <cstdint>
+#include <iostream>
 
-int main()
+using namespace ZeroUI::Test;
+
+/*
+ * usage: Test [filter]
+ * runs the tests whose name contains the filter, all of them without filter
+ * returns 1 when a check failed
+ */
+int main(int Argc, char** Argv)
 {
-	std::cout << "Hello ZeroUI!" << std::endl;
-	return 0;
-}
\ No newline at end of file
+	const char* Filter = Argc > 1 ? Argv[1] : "";
+
+	int32_t NumFailedTests = 0;
+	for (const auto& [Name, Function] : FTestRegistry::Get().GetTests())
+	{
+		if (Name.find(Filter) == std::string::npos)
+		{
+			continue;
+		}
+
+		FTestContext Context;
+		Function(Context);
+
+		if (Context.GetFailures().empty())
+		{
+			std::cout << "[ OK ] " << Name << std::endl;
+		}
+		else
+		{
+			std::cout << "[FAIL] " << Name << std::endl;
+			for (const std::string& Failure : Context.GetFailures())
+			{
+				std::cout << "    " << Failure << std::endl;
+			}
+			++NumFailedTests;
+		}
+	}
+
+	std::cout << NumFailedTests << " test(s) failed" << std::endl;
+	return NumFailedTests == 0 ? 0 : 1;
+}
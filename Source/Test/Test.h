@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace ZeroUI::Test
+{
+	/* passed to every test, collects the failed checks */
+	class FTestContext
+	{
+	public:
+		void Check(bool bCondition, const char* Expression, const char* File, int Line)
+		{
+			if (!bCondition)
+			{
+				m_Failures.push_back(std::string(File) + "(" + std::to_string(Line) + "): " + Expression);
+			}
+		}
+
+		const std::vector<std::string>& GetFailures() const { return m_Failures; }
+
+	private:
+		std::vector<std::string> m_Failures;
+	};
+
+	using FTestFunction = void(*)(FTestContext&);
+
+	class FTestRegistry
+	{
+	public:
+		static FTestRegistry& Get()
+		{
+			static FTestRegistry Instance;
+			return Instance;
+		}
+
+		void Register(const char* Name, FTestFunction Function)
+		{
+			m_Tests.emplace_back(Name, Function);
+		}
+
+		const std::vector<std::pair<std::string, FTestFunction>>& GetTests() const { return m_Tests; }
+
+	private:
+		std::vector<std::pair<std::string, FTestFunction>> m_Tests;
+	};
+
+	struct FTestRegistration
+	{
+		FTestRegistration(const char* Name, FTestFunction Function)
+		{
+			FTestRegistry::Get().Register(Name, Function);
+		}
+	};
+
+	/* usage: ZERO_TEST(MyTest) { ... ZERO_CHECK(Value == 1); } */
+#define ZERO_TEST(Name) \
+	static void Test_##Name(::ZeroUI::Test::FTestContext& Context);\
+	static ::ZeroUI::Test::FTestRegistration TestRegistration_##Name(#Name, &Test_##Name);\
+	static void Test_##Name(::ZeroUI::Test::FTestContext& Context)
+
+	/* records a failure and goes on, the test reports every failed check */
+#define ZERO_CHECK(Condition) Context.Check(static_cast<bool>(Condition), #Condition, __FILE__, __LINE__)
+}
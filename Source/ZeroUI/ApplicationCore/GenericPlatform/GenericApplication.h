@@ -1,10 +1,24 @@
+#pragma once
 
 #include "Core.h"
+#include "ApplicationCore/GenericPlatform/GenericApplicationMessageHandler.h"
+#include "ApplicationCore/GenericPlatform/GenericWindow.h"
+#include "Core/InputCore/InputCoreTypes.h"
 
 namespace ZeroUI
 {
 	class FSlateApplication;
 	class ICursor;
+	struct FGenericWindowDefinition;
+
+	/** A rectangle on the screen, in pixels */
+	struct FPlatformRect
+	{
+		int32_t Left;
+		int32_t Top;
+		int32_t Right;
+		int32_t Bottom;
+	};
 
 	/**
 	* Enumerates available modifier keys for input gestures.
@@ -307,7 +321,7 @@ namespace ZeroUI
 
 	GenericApplication( const Ref< ICursor >& InCursor )
 		: m_Cursor( InCursor )
-		, m_MessageHandler( MakeShareable( new FGenericApplicationMessageHandler() ) )
+		, m_MessageHandler( CreateRef< FGenericApplicationMessageHandler >() )
 	{
 
 	}
@@ -325,7 +339,7 @@ namespace ZeroUI
 
 	virtual void Tick ( const float TimeDelta ) { }
 
-	virtual Ref< FGenericWindow > MakeWindow() { return MakeShareable( new FGenericWindow() ); }
+	virtual Ref< FGenericWindow > MakeWindow() { return CreateRef< FGenericWindow >(); }
 
 	virtual void InitializeWindow( const Ref< FGenericWindow >& Window, const Ref< FGenericWindowDefinition >& InDefinition, const Ref< FGenericWindow >& InParent, const bool bShowImmediately ) { }
 
@@ -335,6 +349,12 @@ namespace ZeroUI
 
 	virtual FModifierKeysState GetModifierKeys() const  { return FModifierKeysState(); }
 
+	/**
+	 * @return The key of the codes sent to OnKeyDown and OnKeyUp, the key codes are specific to each platform.
+	 * EKeys::Invalid when the platform doesn't know the key code.
+	 */
+	virtual FKey GetKeyFromCodes( const int32_t KeyCode, const uint32_t CharacterCode ) const { return EKeys::Invalid; }
+
 	/** @return true if the system cursor is currently directly over a slate window. */
 	virtual bool IsCursorDirectlyOverSlateWindow() const { return true; }
 
@@ -343,6 +363,12 @@ namespace ZeroUI
 
 	virtual bool IsMinimized() const { return false; }
 
+	/** @return true if the frames are timed with the clock of the application instead of the real time, e.g. when an input script is replayed. */
+	virtual bool UsesVirtualTime() const { return false; }
+
+	/** @return The time of the application clock in seconds, only used when UsesVirtualTime returns true. */
+	virtual double GetVirtualTime() const { return 0.0; }
+
 	virtual void SetHighPrecisionMouseMode( const bool Enable, const Ref< FGenericWindow >& InWindow ) { };
 
 	virtual bool IsUsingHighPrecisionMouseMode() const { return false; }
@@ -27,4 +27,14 @@ namespace ZeroUI
 	{
 		// empty default functionality
 	}
+
+	bool FGenericWindow::IsMinimized() const
+	{
+		return false;
+	}
+
+	bool FGenericWindow::IsForegroundWindow() const
+	{
+		return true;
+	}
 }
\ No newline at end of file
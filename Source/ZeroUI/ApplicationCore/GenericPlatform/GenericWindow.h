@@ -4,9 +4,10 @@
 
 #include "Core.h"
 
-struct FGenericWindowDefinition;
 namespace ZeroUI
 {
+	struct FGenericWindowDefinition;
+
 	/**
 	 * Modes that an FGenericWindow can be in
 	 */
@@ -98,6 +99,15 @@ namespace ZeroUI
 		/** sets a new DPI scale factor */
 		virtual void SetDPIScaleFactor(const float Factor);
 
+		/** @return true if the native window is minimized */
+		virtual bool IsMinimized() const;
+
+		/** @return true if the native window is the foreground window, the one receiving the keyboard input. true by default, a window that can't tell is never throttled */
+		virtual bool IsForegroundWindow() const;
+
+		/** @return the definition the window was created with, null for a window that wasn't initialized */
+		const Ref< FGenericWindowDefinition >& GetDefinition() const { return m_Definition; }
+
 	protected:
 
 		Ref< FGenericWindowDefinition > m_Definition;
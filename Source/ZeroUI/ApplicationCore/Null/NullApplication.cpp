@@ -0,0 +1,162 @@
+#include "NullApplication.h"
+#include "NullCursor.h"
+#include "NullWindow.h"
+
+namespace ZeroUI
+{
+	Ref<FNullApplication> FNullApplication::CreateNullApplication()
+	{
+		return Ref<FNullApplication>(new FNullApplication());
+	}
+
+	FNullApplication::FNullApplication()
+		: GenericApplication(CreateRef<FNullCursor>())
+		, m_NullCursor(std::static_pointer_cast<FNullCursor>(m_Cursor))
+		, m_NextEvent(0)
+		, m_CurrentTime(0.0)
+		, m_FrameDeltaTime(1.0 / 60.0)
+		, m_TargetWindowIndex(0)
+		, m_bCapsLocked(false)
+	{
+	}
+
+	FNullApplication::~FNullApplication()
+	{
+	}
+
+	void FNullApplication::SetInputScript(FNullInputScript InScript)
+	{
+		m_Script = std::move(InScript);
+		m_NextEvent = 0;
+		m_CurrentTime = 0.0;
+		m_TargetWindowIndex = 0;
+		m_PressedKeys.Reset();
+		m_bCapsLocked = false;
+		UpdateForegroundWindow();
+	}
+
+	bool FNullApplication::IsScriptFinished() const
+	{
+		return m_NextEvent >= m_Script.GetEvents().size() && m_CurrentTime >= m_Script.GetEndTime();
+	}
+
+	void FNullApplication::PumpMessages(const float TimeDelta)
+	{
+		// the events are sent in the first frame that reaches their time, whatever the real duration of the frames
+		const std::vector<FNullInputEvent>& Events = m_Script.GetEvents();
+		while (m_NextEvent < Events.size() && Events[m_NextEvent].Time <= m_CurrentTime)
+		{
+			ProcessEvent(Events[m_NextEvent]);
+			++m_NextEvent;
+		}
+	}
+
+	void FNullApplication::Tick(const float TimeDelta)
+	{
+		m_CurrentTime += m_FrameDeltaTime;
+	}
+
+	Ref< FGenericWindow > FNullApplication::MakeWindow()
+	{
+		return FNullWindow::Make();
+	}
+
+	void FNullApplication::InitializeWindow(const Ref< FGenericWindow >& Window, const Ref< FGenericWindowDefinition >& InDefinition, const Ref< FGenericWindow >& InParent, const bool bShowImmediately)
+	{
+		const Ref<FNullWindow> NullWindow = std::static_pointer_cast<FNullWindow>(Window);
+		const Ref<FNullWindow> ParentWindow = std::static_pointer_cast<FNullWindow>(InParent);
+
+		m_Windows.push_back(NullWindow);
+		NullWindow->Initialize(InDefinition, ParentWindow);
+		UpdateForegroundWindow();
+	}
+
+	FModifierKeysState FNullApplication::GetModifierKeys() const
+	{
+		return FModifierKeysState(
+			m_PressedKeys.Contains(EKeys::LeftShift),
+			m_PressedKeys.Contains(EKeys::RightShift),
+			m_PressedKeys.Contains(EKeys::LeftControl),
+			m_PressedKeys.Contains(EKeys::RightControl),
+			m_PressedKeys.Contains(EKeys::LeftAlt),
+			m_PressedKeys.Contains(EKeys::RightAlt),
+			m_PressedKeys.Contains(EKeys::LeftCommand),
+			m_PressedKeys.Contains(EKeys::RightCommand),
+			m_bCapsLocked);
+	}
+
+	FKey FNullApplication::GetKeyFromCodes(const int32_t KeyCode, const uint32_t CharacterCode) const
+	{
+		// the key codes of the script are the keys themselves
+		if (KeyCode > 0 && KeyCode < EKeys::NumKeys)
+		{
+			return FKey(static_cast<uint16_t>(KeyCode));
+		}
+		return EKeys::Invalid;
+	}
+
+	Ref<FNullWindow> FNullApplication::GetTargetWindow() const
+	{
+		return m_TargetWindowIndex < static_cast<int32_t>(m_Windows.size()) ? m_Windows[m_TargetWindowIndex] : nullptr;
+	}
+
+	void FNullApplication::UpdateForegroundWindow()
+	{
+		for (int32_t WindowIndex = 0; WindowIndex < static_cast<int32_t>(m_Windows.size()); ++WindowIndex)
+		{
+			m_Windows[WindowIndex]->SetIsForegroundWindow(WindowIndex == m_TargetWindowIndex);
+		}
+	}
+
+	void FNullApplication::ProcessEvent(const FNullInputEvent& Event)
+	{
+		const ZMath::vec2 CursorPos = m_NullCursor->GetPosition();
+
+		switch (Event.Type)
+		{
+		case ENullInputEventType::MouseMove:
+			m_NullCursor->SetPosition(static_cast<int32_t>(Event.Position.x), static_cast<int32_t>(Event.Position.y));
+			m_MessageHandler->OnMouseMove();
+			break;
+
+		case ENullInputEventType::MouseDown:
+			m_MessageHandler->OnMouseDown(GetTargetWindow(), Event.Button, CursorPos);
+			break;
+
+		case ENullInputEventType::MouseUp:
+			m_MessageHandler->OnMouseUp(Event.Button, CursorPos);
+			break;
+
+		case ENullInputEventType::MouseDoubleClick:
+			m_MessageHandler->OnMouseDoubleClick(GetTargetWindow(), Event.Button, CursorPos);
+			break;
+
+		case ENullInputEventType::MouseWheel:
+			m_MessageHandler->OnMouseWheel(Event.WheelDelta, CursorPos);
+			break;
+
+		case ENullInputEventType::KeyDown:
+			if (Event.Key == EKeys::CapsLock && !Event.bIsRepeat)
+			{
+				m_bCapsLocked = !m_bCapsLocked;
+			}
+			m_PressedKeys.Add(Event.Key);
+			m_MessageHandler->OnKeyDown(Event.Key.GetIndex(), 0, Event.bIsRepeat);
+			break;
+
+		case ENullInputEventType::KeyUp:
+			m_PressedKeys.Remove(Event.Key);
+			m_MessageHandler->OnKeyUp(Event.Key.GetIndex(), 0, false);
+			break;
+
+		case ENullInputEventType::KeyChar:
+			m_MessageHandler->OnKeyChar(Event.Character, Event.bIsRepeat);
+			break;
+
+		case ENullInputEventType::SetWindow:
+			m_TargetWindowIndex = Event.WindowIndex;
+			UpdateForegroundWindow();
+			break;
+		}
+	}
+}
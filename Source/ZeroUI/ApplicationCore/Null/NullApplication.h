@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Core.h"
+#include "ApplicationCore/GenericPlatform/GenericApplication.h"
+#include "ApplicationCore/Null/NullInputScript.h"
+#include "Core/InputCore/KeyMap.h"
+
+namespace ZeroUI
+{
+	class FNullWindow;
+	class FNullCursor;
+
+	/**
+	 * Application without a display or input devices, it builds on every platform.
+	 *
+	 * The input comes from an input script and the frames are timed with a virtual clock: every Tick advances the clock
+	 * by the frame delta time, and PumpMessages sends the events of the script whose time is reached. A session replays
+	 * the same way however fast the frames run, e.g. for the performance regression runs:
+	 *
+	 *		Ref<FNullApplication> Platform = FNullApplication::CreateNullApplication();
+	 *		Platform->SetInputScript(Script);
+	 *		FSlateApplication& Application = FSlateApplication::Create(Platform);
+	 *		...
+	 *		while (!Platform->IsScriptFinished())
+	 *		{
+	 *			Application.Tick();
+	 *		}
+	 *
+	 * The key codes sent to the message handler are the indices of the keys in the key table, see FKey::GetIndex.
+	 */
+	class FNullApplication
+		: public GenericApplication
+	{
+	public:
+
+		static Ref<FNullApplication> CreateNullApplication();
+
+		/** Virtual destructor. */
+		virtual ~FNullApplication();
+
+		/** Replaces the script, the virtual clock restarts at 0. */
+		void SetInputScript(FNullInputScript InScript);
+
+		const FNullInputScript& GetInputScript() const { return m_Script; }
+
+		/** The virtual time added by every frame, 60 frames per second by default. */
+		void SetFrameDeltaTime(double InFrameDeltaTime) { m_FrameDeltaTime = InFrameDeltaTime; }
+
+		double GetFrameDeltaTime() const { return m_FrameDeltaTime; }
+
+		/** @return true when every event was sent and the clock reached the end of the script. */
+		bool IsScriptFinished() const;
+
+		const std::vector<Ref<FNullWindow>>& GetWindows() const { return m_Windows; }
+
+	public:
+		virtual void PumpMessages(const float TimeDelta) override;
+		virtual void Tick(const float TimeDelta) override;
+		virtual Ref< FGenericWindow > MakeWindow() override;
+		virtual void InitializeWindow(const Ref< FGenericWindow >& Window, const Ref< FGenericWindowDefinition >& InDefinition, const Ref< FGenericWindow >& InParent, const bool bShowImmediately) override;
+		virtual FModifierKeysState GetModifierKeys() const override;
+		virtual FKey GetKeyFromCodes(const int32_t KeyCode, const uint32_t CharacterCode) const override;
+		virtual bool UsesVirtualTime() const override { return true; }
+		virtual double GetVirtualTime() const override { return m_CurrentTime; }
+
+	protected:
+
+		/** Hidden constructor. */
+		FNullApplication();
+
+	private:
+
+		/** Sends an event of the script to the message handler. */
+		void ProcessEvent(const FNullInputEvent& Event);
+
+		/** @return The window the mouse events are sent to, nullptr when the script targets a window that doesn't exist. */
+		Ref<FNullWindow> GetTargetWindow() const;
+
+		/** The target window of the mouse events is the foreground window, like the window a user clicks in. */
+		void UpdateForegroundWindow();
+
+	private:
+
+		Ref<FNullCursor> m_NullCursor;
+
+		FNullInputScript m_Script;
+
+		/** The index of the next event of the script to send */
+		size_t m_NextEvent;
+
+		double m_CurrentTime;
+
+		double m_FrameDeltaTime;
+
+		/** The windows, in creation order */
+		std::vector<Ref<FNullWindow>> m_Windows;
+
+		/** The window of the mouse events and the foreground window, changed by the SetWindow events */
+		int32_t m_TargetWindowIndex;
+
+		/** The pressed keys, the modifier keys state is built from them */
+		FKeySet m_PressedKeys;
+
+		/** Toggled by the caps lock key downs */
+		bool m_bCapsLocked;
+	};
+}
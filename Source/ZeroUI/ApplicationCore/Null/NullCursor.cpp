@@ -0,0 +1,23 @@
+#include "NullCursor.h"
+
+namespace ZeroUI
+{
+	FNullCursor::FNullCursor()
+		: m_Position(0.0f, 0.0f)
+	{
+	}
+
+	FNullCursor::~FNullCursor()
+	{
+	}
+
+	ZMath::vec2 FNullCursor::GetPosition() const
+	{
+		return m_Position;
+	}
+
+	void FNullCursor::SetPosition(const int32_t X, const int32_t Y)
+	{
+		m_Position = ZMath::vec2(static_cast<float>(X), static_cast<float>(Y));
+	}
+}
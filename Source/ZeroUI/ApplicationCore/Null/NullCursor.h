@@ -0,0 +1,27 @@
+#pragma once
+#include "Core.h"
+#include "ApplicationCore/GenericPlatform/ICursor.h"
+
+namespace ZeroUI
+{
+	/**
+	 * A cursor without a device, its position is only changed by SetPosition.
+	 * The null application moves it when it replays the mouse moves of an input script.
+	 */
+	class FNullCursor : public ICursor
+	{
+	public:
+
+		FNullCursor();
+
+		virtual ~FNullCursor();
+
+		virtual ZMath::vec2 GetPosition() const override;
+
+		virtual void SetPosition(const int32_t X, const int32_t Y) override;
+
+	private:
+
+		ZMath::vec2 m_Position;
+	};
+}
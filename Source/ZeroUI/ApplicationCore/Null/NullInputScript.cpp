@@ -0,0 +1,290 @@
+#include "NullInputScript.h"
+
+namespace ZeroUI
+{
+	namespace
+	{
+		bool ParseMouseButton(const std::string& Name, EMouseButtons::Type& OutButton)
+		{
+			static const std::pair<const char*, EMouseButtons::Type> Buttons[] =
+			{
+				{ "Left", EMouseButtons::Left },
+				{ "Middle", EMouseButtons::Middle },
+				{ "Right", EMouseButtons::Right },
+				{ "Thumb01", EMouseButtons::Thumb01 },
+				{ "Thumb02", EMouseButtons::Thumb02 },
+			};
+
+			for (const auto& [ButtonName, Button] : Buttons)
+			{
+				if (Name == ButtonName)
+				{
+					OutButton = Button;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool ParseRepeat(std::istringstream& Stream)
+		{
+			std::string Flag;
+			return (Stream >> Flag) && Flag == "Repeat";
+		}
+	}
+
+	void FNullInputScript::AddMouseMove(double Time, float X, float Y)
+	{
+		FNullInputEvent Event;
+		Event.Time = Time;
+		Event.Type = ENullInputEventType::MouseMove;
+		Event.Position = ZMath::vec2(X, Y);
+		AddEvent(Event);
+	}
+
+	void FNullInputScript::AddMouseDown(double Time, EMouseButtons::Type Button)
+	{
+		FNullInputEvent Event;
+		Event.Time = Time;
+		Event.Type = ENullInputEventType::MouseDown;
+		Event.Button = Button;
+		AddEvent(Event);
+	}
+
+	void FNullInputScript::AddMouseUp(double Time, EMouseButtons::Type Button)
+	{
+		FNullInputEvent Event;
+		Event.Time = Time;
+		Event.Type = ENullInputEventType::MouseUp;
+		Event.Button = Button;
+		AddEvent(Event);
+	}
+
+	void FNullInputScript::AddMouseDoubleClick(double Time, EMouseButtons::Type Button)
+	{
+		FNullInputEvent Event;
+		Event.Time = Time;
+		Event.Type = ENullInputEventType::MouseDoubleClick;
+		Event.Button = Button;
+		AddEvent(Event);
+	}
+
+	void FNullInputScript::AddMouseWheel(double Time, float Delta)
+	{
+		FNullInputEvent Event;
+		Event.Time = Time;
+		Event.Type = ENullInputEventType::MouseWheel;
+		Event.WheelDelta = Delta;
+		AddEvent(Event);
+	}
+
+	void FNullInputScript::AddKeyDown(double Time, FKey Key, bool bIsRepeat)
+	{
+		FNullInputEvent Event;
+		Event.Time = Time;
+		Event.Type = ENullInputEventType::KeyDown;
+		Event.Key = Key;
+		Event.bIsRepeat = bIsRepeat;
+		AddEvent(Event);
+	}
+
+	void FNullInputScript::AddKeyUp(double Time, FKey Key)
+	{
+		FNullInputEvent Event;
+		Event.Time = Time;
+		Event.Type = ENullInputEventType::KeyUp;
+		Event.Key = Key;
+		AddEvent(Event);
+	}
+
+	void FNullInputScript::AddKeyChar(double Time, TCHAR Character, bool bIsRepeat)
+	{
+		FNullInputEvent Event;
+		Event.Time = Time;
+		Event.Type = ENullInputEventType::KeyChar;
+		Event.Character = Character;
+		Event.bIsRepeat = bIsRepeat;
+		AddEvent(Event);
+	}
+
+	void FNullInputScript::AddSetWindow(double Time, int32_t WindowIndex)
+	{
+		FNullInputEvent Event;
+		Event.Time = Time;
+		Event.Type = ENullInputEventType::SetWindow;
+		Event.WindowIndex = WindowIndex;
+		AddEvent(Event);
+	}
+
+	void FNullInputScript::AddEvent(const FNullInputEvent& Event)
+	{
+		// the events are usually added in order, the insertion is only a search for the out of order ones
+		if (m_Events.empty() || m_Events.back().Time <= Event.Time)
+		{
+			m_Events.push_back(Event);
+		}
+		else
+		{
+			auto Position = std::upper_bound(m_Events.begin(), m_Events.end(), Event.Time, [](double Time, const FNullInputEvent& Other) { return Time < Other.Time; });
+			m_Events.insert(Position, Event);
+		}
+	}
+
+	double FNullInputScript::GetEndTime() const
+	{
+		return m_Events.empty() ? m_EndTime : std::max(m_EndTime, m_Events.back().Time);
+	}
+
+	void FNullInputScript::Empty()
+	{
+		m_Events.clear();
+		m_EndTime = 0.0;
+	}
+
+	bool FNullInputScript::Parse(std::string_view Text)
+	{
+		int32_t LineNumber = 0;
+		while (!Text.empty())
+		{
+			const size_t LineEnd = Text.find('\n');
+			std::string Line(Text.substr(0, LineEnd));
+			Text = LineEnd == std::string_view::npos ? std::string_view() : Text.substr(LineEnd + 1);
+			++LineNumber;
+
+			const size_t CommentStart = Line.find('#');
+			if (CommentStart != std::string::npos)
+			{
+				Line.resize(CommentStart);
+			}
+
+			std::istringstream Stream(Line);
+			double Time = 0.0;
+			std::string Type;
+			if (!(Stream >> Time))
+			{
+				if (Line.find_first_not_of(" \t\r") == std::string::npos)
+				{
+					continue;
+				}
+				CORE_LOG_ERROR("Input script line {0}: expected a time", LineNumber);
+				return false;
+			}
+
+			if (!(Stream >> Type))
+			{
+				CORE_LOG_ERROR("Input script line {0}: expected an event", LineNumber);
+				return false;
+			}
+
+			bool bValid = true;
+			if (Type == "MouseMove")
+			{
+				float X = 0.0f;
+				float Y = 0.0f;
+				bValid = static_cast<bool>(Stream >> X >> Y);
+				if (bValid)
+				{
+					AddMouseMove(Time, X, Y);
+				}
+			}
+			else if (Type == "MouseDown" || Type == "MouseUp" || Type == "MouseDoubleClick")
+			{
+				std::string ButtonName;
+				EMouseButtons::Type Button = EMouseButtons::Invalid;
+				bValid = (Stream >> ButtonName) && ParseMouseButton(ButtonName, Button);
+				if (bValid)
+				{
+					if (Type == "MouseDown")
+					{
+						AddMouseDown(Time, Button);
+					}
+					else if (Type == "MouseUp")
+					{
+						AddMouseUp(Time, Button);
+					}
+					else
+					{
+						AddMouseDoubleClick(Time, Button);
+					}
+				}
+			}
+			else if (Type == "MouseWheel")
+			{
+				float Delta = 0.0f;
+				bValid = static_cast<bool>(Stream >> Delta);
+				if (bValid)
+				{
+					AddMouseWheel(Time, Delta);
+				}
+			}
+			else if (Type == "KeyDown" || Type == "KeyUp")
+			{
+				std::string KeyName;
+				bValid = static_cast<bool>(Stream >> KeyName);
+				const FKey Key(KeyName);
+				bValid = bValid && Key.IsValid();
+				if (bValid)
+				{
+					if (Type == "KeyDown")
+					{
+						AddKeyDown(Time, Key, ParseRepeat(Stream));
+					}
+					else
+					{
+						AddKeyUp(Time, Key);
+					}
+				}
+			}
+			else if (Type == "KeyChar")
+			{
+				std::string Character;
+				bValid = static_cast<bool>(Stream >> Character);
+				if (bValid)
+				{
+					// a single character is the character itself, otherwise its code, e.g. 32 for a space
+					const TCHAR Code = Character.size() == 1 ? static_cast<TCHAR>(Character[0]) : static_cast<TCHAR>(std::strtoul(Character.c_str(), nullptr, 10));
+					AddKeyChar(Time, Code, ParseRepeat(Stream));
+				}
+			}
+			else if (Type == "Window")
+			{
+				int32_t WindowIndex = 0;
+				bValid = (Stream >> WindowIndex) && WindowIndex >= 0;
+				if (bValid)
+				{
+					AddSetWindow(Time, WindowIndex);
+				}
+			}
+			else if (Type == "End")
+			{
+				SetEndTime(std::max(m_EndTime, Time));
+			}
+			else
+			{
+				CORE_LOG_ERROR("Input script line {0}: unknown event {1}", LineNumber, Type);
+				return false;
+			}
+
+			if (!bValid)
+			{
+				CORE_LOG_ERROR("Input script line {0}: invalid arguments for {1}", LineNumber, Type);
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool FNullInputScript::LoadFromFile(const std::filesystem::path& FilePath)
+	{
+		std::ifstream File(FilePath, std::ios::binary);
+		if (!File)
+		{
+			CORE_LOG_ERROR("Can't open the input script {0}", FilePath.string());
+			return false;
+		}
+
+		std::stringstream Text;
+		Text << File.rdbuf();
+		return Parse(Text.str());
+	}
+}
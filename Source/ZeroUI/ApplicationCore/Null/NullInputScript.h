@@ -0,0 +1,110 @@
+#pragma once
+#include "Core.h"
+#include "Core/InputCore/InputCoreTypes.h"
+#include "ApplicationCore/GenericPlatform/GenericApplicationMessageHandler.h"
+
+namespace ZeroUI
+{
+	enum class ENullInputEventType : uint8_t
+	{
+		MouseMove,
+		MouseDown,
+		MouseUp,
+		MouseDoubleClick,
+		MouseWheel,
+		KeyDown,
+		KeyUp,
+		KeyChar,
+
+		/** The following mouse events are sent to another window */
+		SetWindow,
+	};
+
+	/** An input event of a script, only the members used by its type are set */
+	struct FNullInputEvent
+	{
+		/** The virtual time of the event, in seconds since the start of the script */
+		double Time = 0.0;
+
+		ENullInputEventType Type = ENullInputEventType::MouseMove;
+
+		EMouseButtons::Type Button = EMouseButtons::Invalid;
+
+		FKey Key;
+
+		TCHAR Character = 0;
+
+		bool bIsRepeat = false;
+
+		/** The position of a mouse move, in screen space */
+		ZMath::vec2 Position = ZMath::vec2(0.0f, 0.0f);
+
+		float WheelDelta = 0.0f;
+
+		/** The window of SetWindow, in the creation order of the windows */
+		int32_t WindowIndex = 0;
+	};
+
+	/**
+	 * The input of a whole session, replayed by the null application.
+	 * The events are kept sorted by time, two events with the same time keep the order in which they were added.
+	 *
+	 * The text format has an event per line, '#' starts a comment:
+	 *		<Time> MouseMove <X> <Y>
+	 *		<Time> MouseDown|MouseUp|MouseDoubleClick Left|Middle|Right|Thumb01|Thumb02
+	 *		<Time> MouseWheel <Delta>
+	 *		<Time> KeyDown|KeyUp <KeyName> [Repeat]
+	 *		<Time> KeyChar <Character or character code> [Repeat]
+	 *		<Time> Window <WindowIndex>
+	 *		<Time> End
+	 * The times are in seconds, End makes the script last until its time even when there are no more events.
+	 */
+	class FNullInputScript
+	{
+	public:
+
+		void AddMouseMove(double Time, float X, float Y);
+
+		void AddMouseDown(double Time, EMouseButtons::Type Button);
+
+		void AddMouseUp(double Time, EMouseButtons::Type Button);
+
+		void AddMouseDoubleClick(double Time, EMouseButtons::Type Button);
+
+		void AddMouseWheel(double Time, float Delta);
+
+		void AddKeyDown(double Time, FKey Key, bool bIsRepeat = false);
+
+		void AddKeyUp(double Time, FKey Key);
+
+		void AddKeyChar(double Time, TCHAR Character, bool bIsRepeat = false);
+
+		void AddSetWindow(double Time, int32_t WindowIndex);
+
+		void AddEvent(const FNullInputEvent& Event);
+
+		/** The script lasts at least until this time */
+		void SetEndTime(double Time) { m_EndTime = Time; }
+
+		/** @return The time of the last event, or the end time when it's later. */
+		double GetEndTime() const;
+
+		const std::vector<FNullInputEvent>& GetEvents() const { return m_Events; }
+
+		void Empty();
+
+		/**
+		 * Adds the events of a script in the text format.
+		 * @return false if a line can't be parsed, the error is logged and the events of the previous lines are kept.
+		 */
+		bool Parse(std::string_view Text);
+
+		bool LoadFromFile(const std::filesystem::path& FilePath);
+
+	private:
+
+		std::vector<FNullInputEvent> m_Events;
+
+		double m_EndTime = 0.0;
+	};
+}
@@ -0,0 +1,31 @@
+#include "NullWindow.h"
+#include "ApplicationCore/GenericPlatform/GenericWindowDefinition.h"
+
+namespace ZeroUI
+{
+	FNullWindow::FNullWindow()
+		: m_Position(0.0f, 0.0f)
+		, m_Size(0.0f, 0.0f)
+		, m_DPIScaleFactor(1.0f)
+		, m_bIsMinimized(false)
+		, m_bIsForegroundWindow(false)
+	{
+	}
+
+	FNullWindow::~FNullWindow()
+	{
+	}
+
+	Ref<FNullWindow> FNullWindow::Make()
+	{
+		return Ref<FNullWindow>(new FNullWindow());
+	}
+
+	void FNullWindow::Initialize(const Ref<FGenericWindowDefinition>& InDefinition, const Ref<FNullWindow>& InParent)
+	{
+		m_Definition = InDefinition;
+		m_Parent = InParent;
+		m_Position = ZMath::vec2(InDefinition->XDesiredPositionOnScreen, InDefinition->YDesiredPositionOnScreen);
+		m_Size = ZMath::vec2(InDefinition->WidthDesiredOnScreen, InDefinition->HeightDesiredOnScreen);
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "Core.h"
+#include "ApplicationCore/GenericPlatform/GenericWindow.h"
+
+namespace ZeroUI
+{
+	/**
+	 * A window that is never shown, it only keeps the size and the DPI scale of its definition.
+	 * Used by the null application, e.g. to run the whole frame of a ui without a display.
+	 */
+	class FNullWindow
+		: public FGenericWindow
+	{
+	public:
+
+		/** Destructor. */
+		~FNullWindow();
+
+		/** Create a new FNullWindow. */
+		static Ref<FNullWindow> Make();
+
+		void Initialize( const Ref<FGenericWindowDefinition>& InDefinition, const Ref<FNullWindow>& InParent );
+
+		virtual float GetDPIScaleFactor() const override
+		{
+			return m_DPIScaleFactor;
+		}
+
+		virtual void SetDPIScaleFactor(float Value) override
+		{
+			m_DPIScaleFactor = Value;
+		}
+
+		virtual bool IsMinimized() const override { return m_bIsMinimized; }
+
+		virtual bool IsForegroundWindow() const override { return m_bIsForegroundWindow; }
+
+		void Minimize() { m_bIsMinimized = true; }
+
+		void Restore() { m_bIsMinimized = false; }
+
+		/** Set by the null application, the foreground window is the one its mouse events are sent to. */
+		void SetIsForegroundWindow(bool bInIsForegroundWindow) { m_bIsForegroundWindow = bInIsForegroundWindow; }
+
+		/** @return The position of the window on the virtual screen. */
+		ZMath::vec2 GetPosition() const { return m_Position; }
+
+		ZMath::vec2 GetSize() const { return m_Size; }
+
+		const Ref<FNullWindow>& GetParent() const { return m_Parent; }
+
+	private:
+
+		/** Protect the constructor; only Refs of this class can be made. */
+		FNullWindow();
+
+	private:
+
+		Ref<FNullWindow> m_Parent;
+
+		ZMath::vec2 m_Position;
+
+		ZMath::vec2 m_Size;
+
+		float m_DPIScaleFactor;
+
+		bool m_bIsMinimized;
+
+		bool m_bIsForegroundWindow;
+	};
+}
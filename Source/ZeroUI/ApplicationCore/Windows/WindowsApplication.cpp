@@ -6,6 +6,84 @@ namespace ZeroUI
 	// Current instance
 	FWindowsApplication* g_WindowsApplication = nullptr;
 
+	namespace
+	{
+		struct FVirtualKeyMapping
+		{
+			int32_t VirtualKey;
+			FKey Key;
+		};
+
+		// the virtual keys that aren't in a range of keys, see GetKeyFromCodes
+		constexpr FVirtualKeyMapping VirtualKeyTable[] =
+		{
+			{ VK_LBUTTON, EKeys::LeftMouseButton },
+			{ VK_RBUTTON, EKeys::RightMouseButton },
+			{ VK_MBUTTON, EKeys::MiddleMouseButton },
+			{ VK_XBUTTON1, EKeys::ThumbMouseButton },
+			{ VK_XBUTTON2, EKeys::ThumbMouseButton2 },
+
+			{ VK_BACK, EKeys::BackSpace },
+			{ VK_TAB, EKeys::Tab },
+			{ VK_RETURN, EKeys::Enter },
+			{ VK_PAUSE, EKeys::Pause },
+			{ VK_CAPITAL, EKeys::CapsLock },
+			{ VK_ESCAPE, EKeys::Escape },
+			{ VK_SPACE, EKeys::SpaceBar },
+			{ VK_PRIOR, EKeys::PageUp },
+			{ VK_NEXT, EKeys::PageDown },
+			{ VK_END, EKeys::End },
+			{ VK_HOME, EKeys::Home },
+			{ VK_LEFT, EKeys::Left },
+			{ VK_UP, EKeys::Up },
+			{ VK_RIGHT, EKeys::Right },
+			{ VK_DOWN, EKeys::Down },
+			{ VK_INSERT, EKeys::Insert },
+			{ VK_DELETE, EKeys::Delete },
+
+			{ VK_MULTIPLY, EKeys::Multiply },
+			{ VK_ADD, EKeys::Add },
+			{ VK_SUBTRACT, EKeys::Subtract },
+			{ VK_DECIMAL, EKeys::Decimal },
+			{ VK_DIVIDE, EKeys::Divide },
+
+			{ VK_NUMLOCK, EKeys::NumLock },
+			{ VK_SCROLL, EKeys::ScrollLock },
+
+			// the window messages send the generic modifier keys, the left one is used
+			{ VK_SHIFT, EKeys::LeftShift },
+			{ VK_LSHIFT, EKeys::LeftShift },
+			{ VK_RSHIFT, EKeys::RightShift },
+			{ VK_CONTROL, EKeys::LeftControl },
+			{ VK_LCONTROL, EKeys::LeftControl },
+			{ VK_RCONTROL, EKeys::RightControl },
+			{ VK_MENU, EKeys::LeftAlt },
+			{ VK_LMENU, EKeys::LeftAlt },
+			{ VK_RMENU, EKeys::RightAlt },
+			{ VK_LWIN, EKeys::LeftCommand },
+			{ VK_RWIN, EKeys::RightCommand },
+
+			// the keys of an us keyboard
+			{ VK_OEM_1, EKeys::Semicolon },
+			{ VK_OEM_PLUS, EKeys::Equals },
+			{ VK_OEM_COMMA, EKeys::Comma },
+			{ VK_OEM_MINUS, EKeys::Hyphen },
+			{ VK_OEM_PERIOD, EKeys::Period },
+			{ VK_OEM_2, EKeys::Slash },
+			{ VK_OEM_3, EKeys::Tilde },
+			{ VK_OEM_4, EKeys::LeftBracket },
+			{ VK_OEM_5, EKeys::Backslash },
+			{ VK_OEM_6, EKeys::RightBracket },
+			{ VK_OEM_7, EKeys::Apostrophe },
+		};
+
+		// the key at the offset of the first key of a range, the keys of a range are contiguous in the key table
+		FKey OffsetKey(FKey FirstKey, int32_t Offset)
+		{
+			return FKey(static_cast<uint16_t>(FirstKey.GetIndex() + Offset));
+		}
+	}
+
 	FWindowsApplication* FWindowsApplication::CreateWindowsApplication(const HINSTANCE InstanceHandle, const HICON IconHandle)
 	{
 		g_WindowsApplication = new FWindowsApplication(InstanceHandle, IconHandle);
@@ -29,6 +107,36 @@ namespace ZeroUI
 		}
 	}
 
+	FKey FWindowsApplication::GetKeyFromCodes(const int32_t KeyCode, const uint32_t CharacterCode) const
+	{
+		// the virtual keys of the letters and the digits are their ascii codes
+		if (KeyCode >= 'A' && KeyCode <= 'Z')
+		{
+			return OffsetKey(EKeys::A, KeyCode - 'A');
+		}
+		if (KeyCode >= '0' && KeyCode <= '9')
+		{
+			return OffsetKey(EKeys::Zero, KeyCode - '0');
+		}
+		if (KeyCode >= VK_NUMPAD0 && KeyCode <= VK_NUMPAD9)
+		{
+			return OffsetKey(EKeys::NumPadZero, KeyCode - VK_NUMPAD0);
+		}
+		if (KeyCode >= VK_F1 && KeyCode <= VK_F12)
+		{
+			return OffsetKey(EKeys::F1, KeyCode - VK_F1);
+		}
+
+		for (const FVirtualKeyMapping& Mapping : VirtualKeyTable)
+		{
+			if (Mapping.VirtualKey == KeyCode)
+			{
+				return Mapping.Key;
+			}
+		}
+		return EKeys::Invalid;
+	}
+
 	FWindowsApplication::FWindowsApplication(const HINSTANCE HInstance, const HICON IconHandle)
 		:GenericApplication(CreateRef<FWindowsCursor>())
 		,m_InstanceHandle(HInstance)
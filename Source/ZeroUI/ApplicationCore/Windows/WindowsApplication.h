@@ -67,6 +67,7 @@ namespace ZeroUI
 		virtual void ProcessDeferredEvents(const float TimeDelta) override;
 		virtual Ref< FGenericWindow > MakeWindow() override;
 		virtual void InitializeWindow(const Ref< FGenericWindow >& Window, const Ref< FGenericWindowDefinition >& InDefinition, const Ref< FGenericWindow >& InParent, const bool bShowImmediately) override;
+		virtual FKey GetKeyFromCodes(const int32_t KeyCode, const uint32_t CharacterCode) const override;
 
 	protected:
 		friend LRESULT WindowsApplication_WndProc(HWND hwnd, uint32_t msg, WPARAM wParam, LPARAM lParam);
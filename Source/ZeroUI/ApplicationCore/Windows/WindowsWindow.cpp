@@ -28,6 +28,16 @@ namespace ZeroUI
 		return m_HWnd;
 	}
 
+	bool FWindowsWindow::IsMinimized() const
+	{
+		return !!::IsIconic(m_HWnd);
+	}
+
+	bool FWindowsWindow::IsForegroundWindow() const
+	{
+		return ::GetForegroundWindow() == m_HWnd;
+	}
+
 	void FWindowsWindow::Initialize(FWindowsApplication* const Application, const Ref<FGenericWindowDefinition>& InDefinition, HINSTANCE InHInstance, const Ref<FWindowsWindow>& InParent, const bool bShowImmediately)
 	{
 		m_Definition = InDefinition;
@@ -46,6 +46,8 @@ namespace ZeroUI
 	public:
 		// FGenericWindow interface
 		virtual void* GetOSWindowHandle() const  override { return m_HWnd; }
+		virtual bool IsMinimized() const override;
+		virtual bool IsForegroundWindow() const override;
 
 	private:
 
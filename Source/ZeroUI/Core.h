@@ -2,6 +2,15 @@
 #include "PCH.h" 
 #include "Core/Log.h"
 
+#if !defined(_WIN32)
+#include <pthread.h>
+#include <cstring>
+
+// defined by the windows headers
+#define FORCEINLINE inline __attribute__((always_inline))
+typedef wchar_t TCHAR;
+#endif
+
 
 #define EDITOR_MODE 1
 
@@ -36,6 +45,7 @@ namespace ZeroUI
 	enum { INDEX_NONE = -1 };
 // Set the name of an std::thread.
 // Useful for debugging.
+#if defined(_WIN32)
 	const DWORD MS_VC_EXCEPTION = 0x406D1388;
 #pragma pack( push, 8 )
 	typedef struct tagTHREADNAME_INFO
@@ -67,6 +77,19 @@ namespace ZeroUI
 			}
 		}
 	}
+#else
+	namespace Utils
+	{
+		inline void SetThreadName(std::thread& thread, const char* threadName)
+		{
+			// the name is limited to 16 characters, the terminating null included
+			char TruncatedName[16];
+			std::strncpy(TruncatedName, threadName, sizeof(TruncatedName) - 1);
+			TruncatedName[sizeof(TruncatedName) - 1] = '\0';
+			pthread_setname_np(thread.native_handle(), TruncatedName);
+		}
+	}
+#endif
 
 	template<typename T>
 	using Scope = std::unique_ptr<T>;
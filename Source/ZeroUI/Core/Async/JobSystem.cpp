@@ -0,0 +1,262 @@
+#include "JobSystem.h"
+
+namespace ZeroUI
+{
+	namespace
+	{
+		/* index of the worker running on this thread, INDEX_NONE for the other threads */
+		thread_local int32_t t_WorkerIndex = INDEX_NONE;
+	}
+
+	FJobSystem& FJobSystem::Get()
+	{
+		static FJobSystem Instance;
+		return Instance;
+	}
+
+	FJobSystem::FJobSystem()
+		: m_NumWorkers(0)
+		, m_QueuedJobs(0)
+		, m_bRunning(false)
+	{
+	}
+
+	FJobSystem::~FJobSystem()
+	{
+		Shutdown();
+	}
+
+	void FJobSystem::Initialize(uint32_t InNumWorkers)
+	{
+		if (IsInitialized())
+		{
+			return;
+		}
+
+		if (InNumWorkers == 0)
+		{
+			const uint32_t HardwareThreads = std::thread::hardware_concurrency();
+			InNumWorkers = HardwareThreads > 1 ? HardwareThreads - 1 : 1;
+		}
+
+		m_Queues.clear();
+		for (uint32_t QueueIndex = 0; QueueIndex < InNumWorkers + 1; ++QueueIndex)
+		{
+			m_Queues.push_back(CreateScope<FJobQueue>());
+		}
+
+		m_NumWorkers = InNumWorkers;
+		m_bRunning = true;
+		m_Workers.reserve(InNumWorkers);
+		for (uint32_t WorkerIndex = 0; WorkerIndex < InNumWorkers; ++WorkerIndex)
+		{
+			m_Workers.emplace_back(&FJobSystem::WorkerLoop, this, WorkerIndex);
+			Utils::SetThreadName(m_Workers.back(), "ZeroUI Worker");
+		}
+	}
+
+	void FJobSystem::Shutdown()
+	{
+		if (!IsInitialized())
+		{
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> Lock(m_WakeMutex);
+			m_bRunning = false;
+		}
+		m_WakeCondition.notify_all();
+
+		for (std::thread& Worker : m_Workers)
+		{
+			Worker.join();
+		}
+		m_Workers.clear();
+		m_NumWorkers = 0;
+
+		// execute what is left so no counter stays pending
+		FJob Job;
+		while (PopOrSteal(0, Job))
+		{
+			Execute(Job);
+		}
+		m_Queues.clear();
+	}
+
+	void FJobSystem::Dispatch(FJobCounter& Counter, FJobFunction Job)
+	{
+		Counter.m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+		if (!IsInitialized())
+		{
+			FJob InlineJob{ std::move(Job), &Counter };
+			Execute(InlineJob);
+			return;
+		}
+
+		Enqueue(FJob{ std::move(Job), &Counter });
+	}
+
+	void FJobSystem::Dispatch(FJobCounter& Counter, FJobFunction Job, FJobCounter& Prerequisite)
+	{
+		Counter.m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+		{
+			std::lock_guard<std::mutex> Lock(Prerequisite.m_Mutex);
+			if (!Prerequisite.IsDone())
+			{
+				// queued by the thread that finishes the last job of the prerequisite
+				Prerequisite.m_Continuations.push_back(FJob{ std::move(Job), &Counter });
+				return;
+			}
+		}
+
+		if (!IsInitialized())
+		{
+			FJob InlineJob{ std::move(Job), &Counter };
+			Execute(InlineJob);
+			return;
+		}
+
+		Enqueue(FJob{ std::move(Job), &Counter });
+	}
+
+	void FJobSystem::Enqueue(FJob&& Job)
+	{
+		FJobQueue& Queue = *m_Queues[GetLocalQueueIndex()];
+		{
+			std::lock_guard<std::mutex> Lock(Queue.Mutex);
+			Queue.Jobs.push_back(std::move(Job));
+		}
+
+		{
+			// under the wake mutex, a worker that just found the queues empty is either waiting or will see the job
+			std::lock_guard<std::mutex> Lock(m_WakeMutex);
+			m_QueuedJobs.fetch_add(1, std::memory_order_release);
+		}
+		m_WakeCondition.notify_one();
+	}
+
+	void FJobSystem::Wait(FJobCounter& Counter)
+	{
+		// the queues outlive the workers during the shutdown, keep helping until they are joined
+		const bool bHasQueues = !m_Queues.empty();
+		const uint32_t LocalQueueIndex = bHasQueues ? GetLocalQueueIndex() : 0;
+
+		while (!Counter.IsDone())
+		{
+			FJob Job;
+			if (bHasQueues && PopOrSteal(LocalQueueIndex, Job))
+			{
+				Execute(Job);
+			}
+			else
+			{
+				// the remaining jobs of the group are running on other threads
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	bool FJobSystem::IsWorkerThread()
+	{
+		return t_WorkerIndex != INDEX_NONE;
+	}
+
+	void FJobSystem::WorkerLoop(uint32_t WorkerIndex)
+	{
+		t_WorkerIndex = static_cast<int32_t>(WorkerIndex);
+
+		while (true)
+		{
+			FJob Job;
+			if (PopOrSteal(WorkerIndex, Job))
+			{
+				Execute(Job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> Lock(m_WakeMutex);
+			m_WakeCondition.wait(Lock, [this]() { return !m_bRunning || m_QueuedJobs.load(std::memory_order_acquire) > 0; });
+			if (!m_bRunning)
+			{
+				break;
+			}
+		}
+
+		t_WorkerIndex = INDEX_NONE;
+	}
+
+	bool FJobSystem::PopOrSteal(uint32_t LocalQueueIndex, FJob& OutJob)
+	{
+		if (m_QueuedJobs.load(std::memory_order_acquire) <= 0)
+		{
+			return false;
+		}
+
+		const uint32_t NumQueues = static_cast<uint32_t>(m_Queues.size());
+
+		// the local queue first, from the back
+		{
+			FJobQueue& LocalQueue = *m_Queues[LocalQueueIndex];
+			std::lock_guard<std::mutex> Lock(LocalQueue.Mutex);
+			if (!LocalQueue.Jobs.empty())
+			{
+				OutJob = std::move(LocalQueue.Jobs.back());
+				LocalQueue.Jobs.pop_back();
+				m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		// steal the oldest job of the other queues, they are usually the biggest chunks of work
+		for (uint32_t Offset = 1; Offset < NumQueues; ++Offset)
+		{
+			FJobQueue& VictimQueue = *m_Queues[(LocalQueueIndex + Offset) % NumQueues];
+			std::lock_guard<std::mutex> Lock(VictimQueue.Mutex);
+			if (!VictimQueue.Jobs.empty())
+			{
+				OutJob = std::move(VictimQueue.Jobs.front());
+				VictimQueue.Jobs.pop_front();
+				m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void FJobSystem::Execute(FJob& Job)
+	{
+		Job.Function();
+
+		std::vector<FJob> Continuations;
+		{
+			// the counter can't be destroyed before the lock is released, see ~FJobCounter
+			FJobCounter& Counter = *Job.Counter;
+			std::lock_guard<std::mutex> Lock(Counter.m_Mutex);
+			if (Counter.m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				Continuations.swap(Counter.m_Continuations);
+			}
+		}
+
+		for (FJob& Continuation : Continuations)
+		{
+			if (IsInitialized())
+			{
+				Enqueue(std::move(Continuation));
+			}
+			else
+			{
+				Execute(Continuation);
+			}
+		}
+	}
+
+	uint32_t FJobSystem::GetLocalQueueIndex() const
+	{
+		return t_WorkerIndex != INDEX_NONE ? static_cast<uint32_t>(t_WorkerIndex) : static_cast<uint32_t>(m_Queues.size()) - 1;
+	}
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "Core.h"
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+
+namespace ZeroUI
+{
+	class FJobCounter;
+
+	/* a job waiting in a queue, or waiting for its prerequisite */
+	struct FQueuedJob
+	{
+		std::function<void()> Function;
+		FJobCounter* Counter = nullptr;
+	};
+
+	/*
+	 * counter used to join a group of jobs
+	 * it's incremented when a job is dispatched and decremented when the job is done, the group is complete when it reaches 0
+	 */
+	class FJobCounter
+	{
+	public:
+		FJobCounter()
+			: m_Pending(0)
+		{
+		}
+
+		/* waits for the thread that finished the last job to release the counter */
+		~FJobCounter()
+		{
+			std::lock_guard<std::mutex> Lock(m_Mutex);
+		}
+
+		FJobCounter(const FJobCounter&) = delete;
+		FJobCounter& operator=(const FJobCounter&) = delete;
+
+		/* returns true when all the jobs that were dispatched with this counter are done */
+		bool IsDone() const
+		{
+			return m_Pending.load(std::memory_order_acquire) == 0;
+		}
+
+	private:
+		friend class FJobSystem;
+
+		std::atomic<int32_t> m_Pending;
+
+		/* guards the continuations, and the release of the counter by the thread that executes the last job */
+		std::mutex m_Mutex;
+
+		/* jobs that depend on this counter, they are queued once it reaches 0 */
+		std::vector<FQueuedJob> m_Continuations;
+	};
+
+	/*
+	 * small work stealing job system
+	 * every worker owns a deque, it pushes and pops its own jobs at the back(LIFO, cache friendly for fork/join)
+	 * and steals from the front of the other deques when it runs out of work
+	 * threads that are not workers push into a shared queue
+	 *
+	 * a thread that waits on a counter keeps executing jobs until the counter is done, so nested fork/join never dead locks
+	 */
+	class FJobSystem
+	{
+	public:
+		using FJobFunction = std::function<void()>;
+
+		static FJobSystem& Get();
+
+		FJobSystem();
+		~FJobSystem();
+
+		FJobSystem(const FJobSystem&) = delete;
+		FJobSystem& operator=(const FJobSystem&) = delete;
+
+		/*
+		 * start the worker threads
+		 * @param InNumWorkers the number of worker, 0 uses the number of hardware threads minus the calling thread
+		 */
+		void Initialize(uint32_t InNumWorkers = 0);
+
+		/* stop and join the worker threads, the queued jobs are executed before returning */
+		void Shutdown();
+
+		bool IsInitialized() const { return m_bRunning.load(std::memory_order_acquire); }
+
+		uint32_t GetNumWorkers() const { return m_NumWorkers; }
+
+		/*
+		 * queue a job, the counter is incremented now and decremented once the job is executed
+		 * when the job system is not initialized the job is executed immediately on the calling thread
+		 */
+		void Dispatch(FJobCounter& Counter, FJobFunction Job);
+
+		/*
+		 * queue a job that runs once all the jobs of the prerequisite are done, the counter is incremented now
+		 * the prerequisite must stay alive until the job is queued, i.e. until it's done
+		 */
+		void Dispatch(FJobCounter& Counter, FJobFunction Job, FJobCounter& Prerequisite);
+
+		/* block until the counter is done, the calling thread executes jobs in the mean time */
+		void Wait(FJobCounter& Counter);
+
+		/*
+		 * fork/join loop, calls Body(Index) for every index in [0, Num)
+		 * the indices are split in batches of at least MinBatchSize, the first batch runs on the calling thread
+		 */
+		template<typename FunctionType>
+		void ParallelFor(int32_t Num, FunctionType&& Body, int32_t MinBatchSize = 1);
+
+		/* returns true if the calling thread is one of the workers */
+		static bool IsWorkerThread();
+
+	private:
+		using FJob = FQueuedJob;
+
+		/* push a job in the queue of the calling thread and wake a worker */
+		void Enqueue(FJob&& Job);
+
+		struct FJobQueue
+		{
+			std::mutex Mutex;
+			std::deque<FJob> Jobs;
+		};
+
+		void WorkerLoop(uint32_t WorkerIndex);
+
+		/* pop a job from the local queue, or steal one from the other queues */
+		bool PopOrSteal(uint32_t LocalQueueIndex, FJob& OutJob);
+
+		void Execute(FJob& Job);
+
+		/* the queue of the calling thread, the shared queue for the non worker threads */
+		uint32_t GetLocalQueueIndex() const;
+
+	private:
+		/* one queue per worker, the last one is shared by the threads that are not workers */
+		std::vector<Scope<FJobQueue>> m_Queues;
+
+		std::vector<std::thread> m_Workers;
+
+		/* set before the workers start, the workers read it while m_Workers is being filled */
+		uint32_t m_NumWorkers;
+
+		/* number of jobs that are queued and not yet picked by a thread */
+		std::atomic<int32_t> m_QueuedJobs;
+
+		std::atomic<bool> m_bRunning;
+
+		std::mutex m_WakeMutex;
+		std::condition_variable m_WakeCondition;
+	};
+
+	template<typename FunctionType>
+	void FJobSystem::ParallelFor(int32_t Num, FunctionType&& Body, int32_t MinBatchSize)
+	{
+		if (Num <= 0)
+		{
+			return;
+		}
+
+		// a few batches per thread so the stealing can balance uneven work
+		const int32_t MaxBatches = static_cast<int32_t>(GetNumWorkers() + 1) * 4;
+		const int32_t NumBatches = std::clamp(Num / std::max(MinBatchSize, 1), 1, MaxBatches);
+		if (NumBatches == 1 || !IsInitialized())
+		{
+			for (int32_t Index = 0; Index < Num; ++Index)
+			{
+				Body(Index);
+			}
+			return;
+		}
+
+		const int32_t BatchSize = (Num + NumBatches - 1) / NumBatches;
+
+		FJobCounter Counter;
+		for (int32_t BatchStart = BatchSize; BatchStart < Num; BatchStart += BatchSize)
+		{
+			const int32_t BatchEnd = std::min(BatchStart + BatchSize, Num);
+			Dispatch(Counter, [&Body, BatchStart, BatchEnd]()
+			{
+				for (int32_t Index = BatchStart; Index < BatchEnd; ++Index)
+				{
+					Body(Index);
+				}
+			});
+		}
+
+		for (int32_t Index = 0; Index < BatchSize; ++Index)
+		{
+			Body(Index);
+		}
+
+		Wait(Counter);
+	}
+}
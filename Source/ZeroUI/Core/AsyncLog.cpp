@@ -0,0 +1,191 @@
+#include "AsyncLog.h"
+#include "Core.h"
+
+namespace ZeroUI
+{
+	namespace
+	{
+		uint64_t RoundUpToPowerOfTwo(uint64_t Value)
+		{
+			uint64_t Result = 2;
+			while (Result < Value)
+			{
+				Result <<= 1;
+			}
+			return Result;
+		}
+	}
+
+	FAsyncLog::FAsyncLog(const FAsyncLogSettings& InSettings)
+		: m_Settings(InSettings)
+		, m_Cells(RoundUpToPowerOfTwo(InSettings.QueueCapacity))
+		, m_CellMask(m_Cells.size() - 1)
+		, m_EnqueuePosition(0)
+		, m_DequeuePosition(0)
+		, m_NumDropped(0)
+		, m_NumDroppedToReport(0)
+		, m_bRunning(true)
+	{
+		for (uint64_t CellIndex = 0; CellIndex < m_Cells.size(); ++CellIndex)
+		{
+			m_Cells[CellIndex].Sequence.store(CellIndex, std::memory_order_relaxed);
+		}
+
+		m_Worker = std::thread(&FAsyncLog::WorkerLoop, this);
+		Utils::SetThreadName(m_Worker, "ZeroUI Log");
+	}
+
+	FAsyncLog::~FAsyncLog()
+	{
+		m_bRunning.store(false, std::memory_order_release);
+		if (m_Worker.joinable())
+		{
+			m_Worker.join();
+		}
+	}
+
+	FAsyncLog::FCell* FAsyncLog::BeginPush()
+	{
+		uint64_t Position = m_EnqueuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FCell& Cell = m_Cells[Position & m_CellMask];
+			const uint64_t Sequence = Cell.Sequence.load(std::memory_order_acquire);
+			const int64_t Difference = static_cast<int64_t>(Sequence) - static_cast<int64_t>(Position);
+			if (Difference == 0)
+			{
+				if (m_EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					return &Cell;
+				}
+			}
+			else if (Difference < 0)
+			{
+				// the queue is full
+				if (m_Settings.OverflowPolicy != EAsyncLogOverflowPolicy::Block)
+				{
+					m_NumDropped.fetch_add(1, std::memory_order_relaxed);
+					if (m_Settings.OverflowPolicy == EAsyncLogOverflowPolicy::DropAndCount)
+					{
+						m_NumDroppedToReport.fetch_add(1, std::memory_order_relaxed);
+					}
+					return nullptr;
+				}
+
+				std::this_thread::yield();
+				Position = m_EnqueuePosition.load(std::memory_order_relaxed);
+			}
+			else
+			{
+				// another producer took the cell
+				Position = m_EnqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	void FAsyncLog::EndPush(FCell& Cell)
+	{
+		// the sequence of a reserved cell is its position until it's published
+		const uint64_t Position = Cell.Sequence.load(std::memory_order_relaxed);
+		Cell.Sequence.store(Position + 1, std::memory_order_release);
+	}
+
+	std::string FAsyncLog::MakeFormatErrorText(const char* Format, const std::exception& Error)
+	{
+		return std::string("invalid log format \"") + (Format ? Format : "") + "\": " + Error.what();
+	}
+
+	void FAsyncLog::SetText(FAsyncLogRecord& Record, const std::string& Message)
+	{
+		Record.TextLength = static_cast<uint32_t>(std::min<size_t>(Message.size(), FAsyncLogRecord::PayloadSize));
+		std::memcpy(Record.Payload, Message.data(), Record.TextLength);
+	}
+
+	bool FAsyncLog::WriteNext(std::string& Message)
+	{
+		const uint64_t Position = m_DequeuePosition.load(std::memory_order_relaxed);
+		FCell& Cell = m_Cells[Position & m_CellMask];
+		if (Cell.Sequence.load(std::memory_order_acquire) != Position + 1)
+		{
+			return false;
+		}
+
+		const FAsyncLogRecord& Record = Cell.Record;
+		if (Record.FormatFunction)
+		{
+			Record.FormatFunction(Record, Message);
+		}
+		else
+		{
+			Message.assign(reinterpret_cast<const char*>(Record.Payload), Record.TextLength);
+		}
+
+		const std::shared_ptr<spdlog::logger>& Logger = Record.Category == ELogCategory::Core ? FLog::GetCoreLogger() : FLog::GetClientLogger();
+		const spdlog::level::level_enum Level = Record.Level;
+
+		// the cell can be reused by the producers once the record is copied
+		Cell.Sequence.store(Position + m_Cells.size(), std::memory_order_release);
+
+		if (Logger)
+		{
+			Logger->log(Level, Message);
+		}
+
+		// Flush waits for the position, the message must be written first
+		m_DequeuePosition.store(Position + 1, std::memory_order_release);
+		return true;
+	}
+
+	void FAsyncLog::WorkerLoop()
+	{
+		std::string Message;
+		for (;;)
+		{
+			bool bWroteAny = false;
+			while (WriteNext(Message))
+			{
+				bWroteAny = true;
+			}
+
+			const uint64_t NumDroppedToReport = m_NumDroppedToReport.exchange(0, std::memory_order_relaxed);
+			if (NumDroppedToReport > 0 && FLog::GetCoreLogger())
+			{
+				FLog::GetCoreLogger()->warn("{0} log messages were dropped, the queue was full", NumDroppedToReport);
+			}
+
+			if (bWroteAny)
+			{
+				if (FLog::GetCoreLogger())
+				{
+					FLog::GetCoreLogger()->flush();
+				}
+				if (FLog::GetClientLogger())
+				{
+					FLog::GetClientLogger()->flush();
+				}
+				continue;
+			}
+
+			// the producers are done when the log is destroyed, the queue is drained before leaving
+			if (!m_bRunning.load(std::memory_order_acquire))
+			{
+				if (m_DequeuePosition.load(std::memory_order_relaxed) == m_EnqueuePosition.load(std::memory_order_acquire))
+				{
+					break;
+				}
+				continue;
+			}
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(m_Settings.FlushIntervalMs));
+		}
+	}
+
+	void FAsyncLog::Flush()
+	{
+		const uint64_t Target = m_EnqueuePosition.load(std::memory_order_acquire);
+		while (m_DequeuePosition.load(std::memory_order_acquire) < Target)
+		{
+			std::this_thread::yield();
+		}
+	}
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <spdlog/spdlog.h>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace ZeroUI
+{
+	enum class ELogCategory : uint8_t
+	{
+		Core,
+		Client,
+	};
+
+	/* what the async log does when its queue is full */
+	enum class EAsyncLogOverflowPolicy : uint8_t
+	{
+		/* the calling thread waits for a free slot, nothing is lost */
+		Block,
+		/* the message is dropped */
+		Drop,
+		/* the message is dropped, the background thread logs how many were lost once the queue drains */
+		DropAndCount,
+	};
+
+	struct FAsyncLogSettings
+	{
+		/* number of messages the queue holds, rounded up to a power of 2, allocated once */
+		uint32_t QueueCapacity = 8192;
+
+		EAsyncLogOverflowPolicy OverflowPolicy = EAsyncLogOverflowPolicy::DropAndCount;
+
+		/* how long the background thread sleeps when the queue is empty */
+		uint32_t FlushIntervalMs = 2;
+	};
+
+	/*
+	 * a message waiting in the queue
+	 * the arguments that are trivially copyable are copied as they are and formatted by the background thread,
+	 * the other messages(strings, paths...) are formatted by the calling thread and their text is copied.
+	 */
+	struct FAsyncLogRecord
+	{
+		/* the arguments, or the formatted text, bigger messages are truncated */
+		static constexpr uint32_t PayloadSize = 192;
+
+		using FFormatFunction = void(*)(const FAsyncLogRecord& Record, std::string& OutMessage);
+
+		const char* Format = nullptr;
+
+		/* formats the arguments of the payload, null when the payload holds the text */
+		FFormatFunction FormatFunction = nullptr;
+
+		uint32_t TextLength = 0;
+
+		ELogCategory Category = ELogCategory::Core;
+
+		spdlog::level::level_enum Level = spdlog::level::info;
+
+		alignas(std::max_align_t) uint8_t Payload[PayloadSize];
+	};
+
+	/*
+	 * asynchronous log
+	 * the producers reserve a slot of a preallocated bounded queue with a compare and swap(one sequence per slot), so
+	 * logging never locks nor allocates for the deferred messages. a single background thread formats the messages
+	 * and writes them in the spdlog loggers.
+	 */
+	class FAsyncLog
+	{
+	public:
+		explicit FAsyncLog(const FAsyncLogSettings& InSettings);
+
+		/* flush the queue and join the background thread */
+		~FAsyncLog();
+
+		FAsyncLog(const FAsyncLog&) = delete;
+		FAsyncLog& operator=(const FAsyncLog&) = delete;
+
+		template<typename... ArgTypes>
+		void Push(ELogCategory Category, spdlog::level::level_enum Level, const char* Format, ArgTypes&&... Args);
+
+		/* block until every message pushed before the call is written */
+		void Flush();
+
+		/* number of messages dropped because the queue was full */
+		uint64_t GetNumDropped() const { return m_NumDropped.load(std::memory_order_relaxed); }
+
+	private:
+		struct FCell;
+
+		/* the values are copied as they are, the pointers and views could dangle before the message is formatted */
+		template<typename T>
+		static constexpr bool IsDeferrable()
+		{
+			using ValueType = std::decay_t<T>;
+			return std::is_trivially_copyable_v<ValueType> && !std::is_pointer_v<ValueType>
+				&& !std::is_same_v<ValueType, std::string_view> && !std::is_same_v<ValueType, spdlog::string_view_t>;
+		}
+
+		template<typename TupleType>
+		static void FormatDeferred(const FAsyncLogRecord& Record, std::string& OutMessage)
+		{
+			const TupleType& Values = *std::launder(reinterpret_cast<const TupleType*>(Record.Payload));
+			try
+			{
+				OutMessage = std::apply([&Record](const auto&... Value)
+				{
+					return fmt::vformat(Record.Format, fmt::make_format_args(Value...));
+				}, Values);
+			}
+			catch (const std::exception& Error)
+			{
+				// runs on the background thread, an exception would terminate the program
+				OutMessage = MakeFormatErrorText(Record.Format, Error);
+			}
+		}
+
+		/* the text written instead of a message whose format is invalid */
+		static std::string MakeFormatErrorText(const char* Format, const std::exception& Error);
+
+		/* reserve the next cell, applies the overflow policy when the queue is full */
+		FCell* BeginPush();
+
+		/* publish a cell reserved by BeginPush */
+		void EndPush(FCell& Cell);
+
+		/* copy the formatted text in the payload */
+		static void SetText(FAsyncLogRecord& Record, const std::string& Message);
+
+		void WorkerLoop();
+
+		/* pop and write one message, returns false when the queue is empty */
+		bool WriteNext(std::string& Message);
+
+	private:
+		struct FCell
+		{
+			std::atomic<uint64_t> Sequence;
+			FAsyncLogRecord Record;
+		};
+
+		FAsyncLogSettings m_Settings;
+
+		std::vector<FCell> m_Cells;
+		uint64_t m_CellMask;
+
+		/* the producers and the consumer positions, on separate cache lines */
+		alignas(64) std::atomic<uint64_t> m_EnqueuePosition;
+		alignas(64) std::atomic<uint64_t> m_DequeuePosition;
+
+		std::atomic<uint64_t> m_NumDropped;
+
+		/* dropped messages that are not reported yet, see EAsyncLogOverflowPolicy::DropAndCount */
+		std::atomic<uint64_t> m_NumDroppedToReport;
+
+		std::atomic<bool> m_bRunning;
+
+		std::thread m_Worker;
+	};
+
+	template<typename... ArgTypes>
+	void FAsyncLog::Push(ELogCategory Category, spdlog::level::level_enum Level, const char* Format, ArgTypes&&... Args)
+	{
+		FCell* Cell = BeginPush();
+		if (Cell == nullptr)
+		{
+			return;
+		}
+
+		FAsyncLogRecord* Record = &Cell->Record;
+		Record->Format = Format;
+		Record->Category = Category;
+		Record->Level = Level;
+
+		using FTuple = std::tuple<std::decay_t<ArgTypes>...>;
+		if constexpr ((IsDeferrable<ArgTypes>() && ...) && sizeof(FTuple) <= FAsyncLogRecord::PayloadSize && alignof(FTuple) <= alignof(std::max_align_t))
+		{
+			new (Record->Payload) FTuple(std::forward<ArgTypes>(Args)...);
+			Record->FormatFunction = &FormatDeferred<FTuple>;
+		}
+		else
+		{
+			Record->FormatFunction = nullptr;
+			// the cell is reserved, it must be published even if the format is invalid or the queue stalls
+			try
+			{
+				SetText(*Record, fmt::vformat(Format, fmt::make_format_args(Args...)));
+			}
+			catch (const std::exception& Error)
+			{
+				SetText(*Record, MakeFormatErrorText(Format, Error));
+			}
+		}
+
+		EndPush(*Cell);
+	}
+}
@@ -0,0 +1,228 @@
+#pragma once
+
+#include "Core.h"
+#include <cstdlib>
+
+namespace ZeroUI
+{
+	/*
+	 * a vector of at most N elements that are kept in the object itself, it never allocates
+	 * for the arrays with a known bound, e.g. the merged rectangles of a damage region. adding an element to a full
+	 * vector is a fatal error(release builds included), use TInlineVector when the bound is only the common case.
+	 * the interface is the one of std::vector, the iterators are pointers.
+	 */
+	template<typename T, uint32_t N>
+	class TFixedVector
+	{
+		static_assert(N > 0, "a fixed vector must hold at least one element");
+
+	public:
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using iterator = T*;
+		using const_iterator = const T*;
+
+		TFixedVector() = default;
+
+		TFixedVector(std::initializer_list<T> InitList)
+		{
+			for (const T& Value : InitList)
+			{
+				emplace_back(Value);
+			}
+		}
+
+		TFixedVector(const TFixedVector& Other)
+		{
+			std::uninitialized_copy(Other.begin(), Other.end(), data());
+			m_Size = Other.m_Size;
+		}
+
+		TFixedVector(TFixedVector&& Other) noexcept(std::is_nothrow_move_constructible_v<T>)
+		{
+			std::uninitialized_move(Other.begin(), Other.end(), data());
+			m_Size = Other.m_Size;
+			Other.clear();
+		}
+
+		~TFixedVector() { clear(); }
+
+		TFixedVector& operator=(const TFixedVector& Other)
+		{
+			if (this != &Other)
+			{
+				clear();
+				std::uninitialized_copy(Other.begin(), Other.end(), data());
+				m_Size = Other.m_Size;
+			}
+			return *this;
+		}
+
+		TFixedVector& operator=(TFixedVector&& Other) noexcept(std::is_nothrow_move_constructible_v<T>)
+		{
+			if (this != &Other)
+			{
+				clear();
+				std::uninitialized_move(Other.begin(), Other.end(), data());
+				m_Size = Other.m_Size;
+				Other.clear();
+			}
+			return *this;
+		}
+
+		size_t size() const { return m_Size; }
+
+		bool empty() const { return m_Size == 0; }
+
+		bool full() const { return m_Size == N; }
+
+		static constexpr size_t capacity() { return N; }
+
+		static constexpr size_t max_size() { return N; }
+
+		T* data() { return reinterpret_cast<T*>(m_Storage); }
+		const T* data() const { return reinterpret_cast<const T*>(m_Storage); }
+
+		T& operator[](size_t Index)
+		{
+			assert(Index < m_Size);
+			return data()[Index];
+		}
+
+		const T& operator[](size_t Index) const
+		{
+			assert(Index < m_Size);
+			return data()[Index];
+		}
+
+		T& front() { return (*this)[0]; }
+		const T& front() const { return (*this)[0]; }
+
+		T& back() { return (*this)[m_Size - 1]; }
+		const T& back() const { return (*this)[m_Size - 1]; }
+
+		iterator begin() { return data(); }
+		iterator end() { return data() + m_Size; }
+		const_iterator begin() const { return data(); }
+		const_iterator end() const { return data() + m_Size; }
+
+		void push_back(const T& Value) { emplace_back(Value); }
+
+		void push_back(T&& Value) { emplace_back(std::move(Value)); }
+
+		template<typename... ArgsType>
+		T& emplace_back(ArgsType&&... Args)
+		{
+			CheckCapacity(m_Size + 1);
+			T* const Element = ::new (static_cast<void*>(data() + m_Size)) T(std::forward<ArgsType>(Args)...);
+			++m_Size;
+			return *Element;
+		}
+
+		void pop_back()
+		{
+			assert(m_Size > 0);
+			std::destroy_at(data() + --m_Size);
+		}
+
+		iterator insert(const_iterator Position, const T& Value) { return emplace(Position, Value); }
+
+		iterator insert(const_iterator Position, T&& Value) { return emplace(Position, std::move(Value)); }
+
+		template<typename... ArgsType>
+		iterator emplace(const_iterator Position, ArgsType&&... Args)
+		{
+			const size_t Index = Position - data();
+			assert(Index <= m_Size);
+
+			/* built first, the arguments can refer to an element that is moved below */
+			T Value(std::forward<ArgsType>(Args)...);
+			if (Index == m_Size)
+			{
+				emplace_back(std::move(Value));
+				return data() + Index;
+			}
+
+			emplace_back(std::move(back()));
+			std::move_backward(data() + Index, data() + m_Size - 2, data() + m_Size - 1);
+			data()[Index] = std::move(Value);
+			return data() + Index;
+		}
+
+		iterator erase(const_iterator Position) { return erase(Position, Position + 1); }
+
+		iterator erase(const_iterator First, const_iterator Last)
+		{
+			T* const WriteIt = const_cast<T*>(First);
+			assert(data() <= WriteIt && First <= Last && Last <= end());
+			if (First != Last)
+			{
+				T* const NewEnd = std::move(const_cast<T*>(Last), end(), WriteIt);
+				std::destroy(NewEnd, end());
+				m_Size = static_cast<uint32_t>(NewEnd - data());
+			}
+			return WriteIt;
+		}
+
+		void clear()
+		{
+			std::destroy(begin(), end());
+			m_Size = 0;
+		}
+
+		/* there is nothing to reserve, the capacity is only checked */
+		void reserve(size_t NewCapacity) const { assert(NewCapacity <= N); }
+
+		void resize(size_t NewSize)
+		{
+			CheckCapacity(NewSize);
+			if (NewSize < m_Size)
+			{
+				erase(begin() + NewSize, end());
+				return;
+			}
+			std::uninitialized_value_construct(data() + m_Size, data() + NewSize);
+			m_Size = static_cast<uint32_t>(NewSize);
+		}
+
+		void resize(size_t NewSize, const T& Value)
+		{
+			CheckCapacity(NewSize);
+			if (NewSize < m_Size)
+			{
+				erase(begin() + NewSize, end());
+				return;
+			}
+			while (m_Size < NewSize)
+			{
+				emplace_back(Value);
+			}
+		}
+
+		friend bool operator==(const TFixedVector& A, const TFixedVector& B)
+		{
+			return std::equal(A.begin(), A.end(), B.begin(), B.end());
+		}
+
+	private:
+		/* checked in the release builds too, the elements are kept in the object and would be written out of it */
+		static void CheckCapacity(size_t NewSize)
+		{
+			if (NewSize > N)
+			{
+				CORE_LOG_FATAL("TFixedVector: the vector is full, it holds {0} elements", N);
+				FLog::Flush();
+				std::abort();
+			}
+		}
+
+		alignas(T) std::byte m_Storage[sizeof(T) * N];
+
+		uint32_t m_Size = 0;
+	};
+}
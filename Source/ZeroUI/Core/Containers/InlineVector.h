@@ -0,0 +1,338 @@
+#pragma once
+
+#include "Core.h"
+
+namespace ZeroUI
+{
+	/*
+	 * a vector that keeps its first N elements in the object itself, it only allocates when it grows past them
+	 * the hot arrays are tiny most of the time, e.g. the children of a panel or the metadata of a widget, so they don't
+	 * allocate at all. the heap storage comes from the allocator, a std compatible allocator of T.
+	 * the interface is the one of std::vector, the iterators are pointers and are invalidated by a move when the
+	 * elements are inline.
+	 */
+	template<typename T, uint32_t N, typename AllocatorType = std::allocator<T>>
+	class TInlineVector
+	{
+		static_assert(N > 0, "use std::vector for a vector without inline elements");
+
+		using FAllocatorTraits = std::allocator_traits<AllocatorType>;
+
+	public:
+		using value_type = T;
+		using allocator_type = AllocatorType;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using iterator = T*;
+		using const_iterator = const T*;
+
+		static constexpr uint32_t InlineCapacity = N;
+
+		TInlineVector() = default;
+
+		explicit TInlineVector(const AllocatorType& InAllocator)
+			: m_Allocator(InAllocator)
+		{
+		}
+
+		TInlineVector(std::initializer_list<T> InitList)
+		{
+			reserve(InitList.size());
+			for (const T& Value : InitList)
+			{
+				emplace_back(Value);
+			}
+		}
+
+		TInlineVector(const TInlineVector& Other)
+			: m_Allocator(FAllocatorTraits::select_on_container_copy_construction(Other.m_Allocator))
+		{
+			reserve(Other.size());
+			std::uninitialized_copy(Other.begin(), Other.end(), m_Data);
+			m_Size = Other.m_Size;
+		}
+
+		TInlineVector(TInlineVector&& Other) noexcept(std::is_nothrow_move_constructible_v<T>)
+			: m_Allocator(std::move(Other.m_Allocator))
+		{
+			MoveFrom(Other);
+		}
+
+		~TInlineVector()
+		{
+			clear();
+			ReleaseHeap();
+		}
+
+		TInlineVector& operator=(const TInlineVector& Other)
+		{
+			if (this != &Other)
+			{
+				clear();
+				reserve(Other.size());
+				std::uninitialized_copy(Other.begin(), Other.end(), m_Data);
+				m_Size = Other.m_Size;
+			}
+			return *this;
+		}
+
+		TInlineVector& operator=(TInlineVector&& Other) noexcept(std::is_nothrow_move_constructible_v<T>)
+		{
+			if (this != &Other)
+			{
+				clear();
+				if constexpr (FAllocatorTraits::propagate_on_container_move_assignment::value)
+				{
+					ReleaseHeap();
+					m_Allocator = std::move(Other.m_Allocator);
+				}
+				else if (!FAllocatorTraits::is_always_equal::value && !(m_Allocator == Other.m_Allocator))
+				{
+					/* the heap storage of the other vector can't be freed by this allocator, the elements are moved one by one */
+					reserve(Other.size());
+					std::uninitialized_move(Other.begin(), Other.end(), m_Data);
+					m_Size = Other.m_Size;
+					Other.clear();
+					return *this;
+				}
+				ReleaseHeap();
+				MoveFrom(Other);
+			}
+			return *this;
+		}
+
+		size_t size() const { return m_Size; }
+
+		bool empty() const { return m_Size == 0; }
+
+		size_t capacity() const { return m_Capacity; }
+
+		/* returns true while the elements are in the object, nothing was allocated */
+		bool IsInline() const { return m_Data == GetInlineData(); }
+
+		const AllocatorType& get_allocator() const { return m_Allocator; }
+
+		T* data() { return m_Data; }
+		const T* data() const { return m_Data; }
+
+		T& operator[](size_t Index)
+		{
+			assert(Index < m_Size);
+			return m_Data[Index];
+		}
+
+		const T& operator[](size_t Index) const
+		{
+			assert(Index < m_Size);
+			return m_Data[Index];
+		}
+
+		T& front() { return (*this)[0]; }
+		const T& front() const { return (*this)[0]; }
+
+		T& back() { return (*this)[m_Size - 1]; }
+		const T& back() const { return (*this)[m_Size - 1]; }
+
+		iterator begin() { return m_Data; }
+		iterator end() { return m_Data + m_Size; }
+		const_iterator begin() const { return m_Data; }
+		const_iterator end() const { return m_Data + m_Size; }
+
+		void push_back(const T& Value) { emplace_back(Value); }
+
+		void push_back(T&& Value) { emplace_back(std::move(Value)); }
+
+		template<typename... ArgsType>
+		T& emplace_back(ArgsType&&... Args)
+		{
+			if (m_Size == m_Capacity)
+			{
+				/* the new element is built before the old ones are moved, the arguments can refer to them */
+				const uint32_t NewCapacity = GrowCapacity(m_Size + 1);
+				T* NewData = Allocate(NewCapacity);
+				::new (static_cast<void*>(NewData + m_Size)) T(std::forward<ArgsType>(Args)...);
+				Relocate(NewData, NewCapacity);
+			}
+			else
+			{
+				::new (static_cast<void*>(m_Data + m_Size)) T(std::forward<ArgsType>(Args)...);
+			}
+			return m_Data[m_Size++];
+		}
+
+		void pop_back()
+		{
+			assert(m_Size > 0);
+			std::destroy_at(m_Data + --m_Size);
+		}
+
+		iterator insert(const_iterator Position, const T& Value) { return emplace(Position, Value); }
+
+		iterator insert(const_iterator Position, T&& Value) { return emplace(Position, std::move(Value)); }
+
+		template<typename... ArgsType>
+		iterator emplace(const_iterator Position, ArgsType&&... Args)
+		{
+			const size_t Index = Position - m_Data;
+			assert(Index <= m_Size);
+
+			/* built first, the arguments can refer to an element that is moved below */
+			T Value(std::forward<ArgsType>(Args)...);
+			if (Index == m_Size)
+			{
+				emplace_back(std::move(Value));
+				return m_Data + Index;
+			}
+
+			emplace_back(std::move(back()));
+			std::move_backward(m_Data + Index, m_Data + m_Size - 2, m_Data + m_Size - 1);
+			m_Data[Index] = std::move(Value);
+			return m_Data + Index;
+		}
+
+		iterator erase(const_iterator Position) { return erase(Position, Position + 1); }
+
+		iterator erase(const_iterator First, const_iterator Last)
+		{
+			T* const WriteIt = const_cast<T*>(First);
+			assert(m_Data <= WriteIt && First <= Last && Last <= end());
+			if (First != Last)
+			{
+				T* const NewEnd = std::move(const_cast<T*>(Last), end(), WriteIt);
+				std::destroy(NewEnd, end());
+				m_Size = static_cast<uint32_t>(NewEnd - m_Data);
+			}
+			return WriteIt;
+		}
+
+		/* destroys the elements, the capacity is kept */
+		void clear()
+		{
+			std::destroy(begin(), end());
+			m_Size = 0;
+		}
+
+		void reserve(size_t NewCapacity)
+		{
+			if (NewCapacity > m_Capacity)
+			{
+				Relocate(Allocate(NewCapacity), NewCapacity);
+			}
+		}
+
+		void resize(size_t NewSize)
+		{
+			if (NewSize < m_Size)
+			{
+				erase(begin() + NewSize, end());
+				return;
+			}
+			reserve(NewSize);
+			std::uninitialized_value_construct(m_Data + m_Size, m_Data + NewSize);
+			m_Size = static_cast<uint32_t>(NewSize);
+		}
+
+		void resize(size_t NewSize, const T& Value)
+		{
+			if (NewSize < m_Size)
+			{
+				erase(begin() + NewSize, end());
+				return;
+			}
+			while (m_Size < NewSize)
+			{
+				emplace_back(Value);
+			}
+		}
+
+		/* frees the heap storage when the elements fit in the object again */
+		void shrink_to_fit()
+		{
+			if (!IsInline() && m_Size <= N)
+			{
+				T* const HeapData = m_Data;
+				const uint32_t HeapCapacity = m_Capacity;
+				std::uninitialized_move(HeapData, HeapData + m_Size, GetInlineData());
+				std::destroy(HeapData, HeapData + m_Size);
+				FAllocatorTraits::deallocate(m_Allocator, HeapData, HeapCapacity);
+				m_Data = GetInlineData();
+				m_Capacity = N;
+			}
+		}
+
+		friend bool operator==(const TInlineVector& A, const TInlineVector& B)
+		{
+			return std::equal(A.begin(), A.end(), B.begin(), B.end());
+		}
+
+	private:
+		T* GetInlineData() { return reinterpret_cast<T*>(m_InlineStorage); }
+		const T* GetInlineData() const { return reinterpret_cast<const T*>(m_InlineStorage); }
+
+		uint32_t GrowCapacity(size_t MinCapacity) const
+		{
+			return static_cast<uint32_t>(std::max<size_t>(MinCapacity, m_Capacity * 2));
+		}
+
+		T* Allocate(size_t Capacity)
+		{
+			assert(Capacity <= std::numeric_limits<uint32_t>::max());
+			return FAllocatorTraits::allocate(m_Allocator, Capacity);
+		}
+
+		/* moves the elements to the new heap storage and frees the old one */
+		void Relocate(T* NewData, size_t NewCapacity)
+		{
+			std::uninitialized_move(m_Data, m_Data + m_Size, NewData);
+			std::destroy(m_Data, m_Data + m_Size);
+			ReleaseHeap();
+			m_Data = NewData;
+			m_Capacity = static_cast<uint32_t>(NewCapacity);
+		}
+
+		void ReleaseHeap()
+		{
+			if (!IsInline())
+			{
+				FAllocatorTraits::deallocate(m_Allocator, m_Data, m_Capacity);
+				m_Data = GetInlineData();
+				m_Capacity = N;
+			}
+		}
+
+		/* takes the heap storage of the other vector, or moves its inline elements, the other vector is left empty */
+		void MoveFrom(TInlineVector& Other)
+		{
+			if (Other.IsInline())
+			{
+				std::uninitialized_move(Other.begin(), Other.end(), GetInlineData());
+				m_Size = Other.m_Size;
+				Other.clear();
+			}
+			else
+			{
+				m_Data = Other.m_Data;
+				m_Size = Other.m_Size;
+				m_Capacity = Other.m_Capacity;
+				Other.m_Data = Other.GetInlineData();
+				Other.m_Size = 0;
+				Other.m_Capacity = N;
+			}
+		}
+
+	private:
+		alignas(T) std::byte m_InlineStorage[sizeof(T) * N];
+
+		T* m_Data = GetInlineData();
+
+		uint32_t m_Size = 0;
+
+		uint32_t m_Capacity = N;
+
+		[[no_unique_address]] AllocatorType m_Allocator;
+	};
+}
@@ -10,6 +10,8 @@ namespace ZeroUI
 	class FDelegateBase
 	{
 	public:
+		virtual ~FDelegateBase() = default;
+
 		virtual TReturn Execute(ParamTypes ...Params)
 		{
 			return TReturn();
@@ -49,7 +51,7 @@ namespace ZeroUI
 			return (*m_Function)(Params...);
 		}
 	private:
-		TReturn(*m_Funcation)(ParamTypes ...);
+		TReturn(*m_Function)(ParamTypes ...);
 	};
 
 	template<class TReturn, typename ...ParamTypes>
@@ -115,12 +117,19 @@ namespace ZeroUI
 			m_CurDelegatePtr = new FFunctionDelegate<TReturn, ParamTypes...>(Function);
 		}
 
-		bool IsBound()
+		// bind a delegate type of another module, e.g. a widget bound by its handle, the delegate owns it
+		void BindDelegateInstance(FDelegateBase<TReturn, ParamTypes...>* DelegateInstance)
+		{
+			ReleaseDelegate();
+			m_CurDelegatePtr = DelegateInstance;
+		}
+
+		bool IsBound() const
 		{
 			return m_CurDelegatePtr != nullptr;
 		}
 
-		virtual TReturn Execute(ParamTypes ...Params)
+		virtual TReturn Execute(ParamTypes ...Params) const
 		{
 			return m_CurDelegatePtr->Execute(Params...);
 		}
@@ -184,7 +193,7 @@ namespace ZeroUI
 			FDelegateHandle Handle;
 			this->insert({ Handle, TDelegate() });
 			TDelegate& Delegate = this->at(Handle);
-			Delegate.Bind(Funcation);
+			Delegate.Bind(InFuncation);
 
 			return Handle;
 		}
@@ -2,6 +2,7 @@
 
 #include <filesystem>
 #include "Delegate.h"
+#include "Async/JobSystem.h"
 
 namespace ZeroUI
 {
@@ -47,13 +48,29 @@ namespace ZeroUI
 
 		void CheckWatchedFiles()
 		{
-			for (auto const& [File, FileTime] : m_FilesMap)
+			// the files are stat on the job system, the events are broadcast on the calling thread in the map order
+			std::vector<std::map<std::string, std::filesystem::file_time_type>::iterator> Files;
+			Files.reserve(m_FilesMap.size());
+			for (auto It = m_FilesMap.begin(); It != m_FilesMap.end(); ++It)
 			{
-				auto CurrentFileLastWriteTime = std::filesystem::last_write_time(File);
-				if (m_FilesMap[File] != CurrentFileLastWriteTime)
+				Files.push_back(It);
+			}
+
+			std::vector<std::filesystem::file_time_type> CurrentFileTimes(Files.size());
+			FJobSystem::Get().ParallelFor(static_cast<int32_t>(Files.size()), [&Files, &CurrentFileTimes](int32_t Index)
+			{
+				// a deleted file keeps its last known time
+				std::error_code ErrorCode;
+				const auto CurrentFileLastWriteTime = std::filesystem::last_write_time(Files[Index]->first, ErrorCode);
+				CurrentFileTimes[Index] = ErrorCode ? Files[Index]->second : CurrentFileLastWriteTime;
+			}, 16);
+
+			for (size_t Index = 0; Index < Files.size(); ++Index)
+			{
+				if (Files[Index]->second != CurrentFileTimes[Index])
 				{
-					m_FilesMap[File] = CurrentFileLastWriteTime;
-					m_FileModifiedEvent.Broadcast(File);
+					Files[Index]->second = CurrentFileTimes[Index];
+					m_FileModifiedEvent.Broadcast(Files[Index]->first);
 				}
 			}
 		}
@@ -15,7 +15,9 @@
 #include <fstream>
 #include <iostream>
 #include <codecvt>
+#if defined(_WIN32)
 #include <comdef.h>
+#endif
 #include <mutex>
 #include <filesystem>
 
@@ -2,11 +2,22 @@
 
 namespace ZeroUI
 {
-	const FKey EKeys::Invalid("");//none
+	FKey::FKey(std::string_view InName)
+		: m_Index(InputCorePrivate::Invalid)
+	{
+		if (InName.empty())
+		{
+			return;
+		}
 
-	const FKey EKeys::LeftMouseButton("LeftMouseButton");
-	const FKey EKeys::RightMouseButton("RightMouseButton");
-	const FKey EKeys::MiddleMouseButton("MiddleMouseButton");
-	const FKey EKeys::ThumbMouseButton("ThumbMouseButton");
-	const FKey EKeys::ThumbMouseButton2("ThumbMouseButton2");
-}
\ No newline at end of file
+		// only called when the bindings are created, the input path never looks a key up by its name
+		for (uint16_t Index = 1; Index < InputCorePrivate::NumKeys; ++Index)
+		{
+			if (InputCorePrivate::KeyTable[Index].Name == InName)
+			{
+				m_Index = Index;
+				return;
+			}
+		}
+	}
+}
@@ -1,31 +1,247 @@
 #pragma once
 
-#include <string>
+#include "Core.h"
+#include "Core/Misc/EnumClassFlags.h"
 
 namespace ZeroUI
 {
+	enum class EKeyFlags : uint8_t
+	{
+		None = 0,
+		MouseButton = 1 << 0,
+		ModifierKey = 1 << 1,
+		Keyboard = 1 << 2,
+
+		/* a value that changes instead of a button that is pressed, e.g. the mouse wheel */
+		Axis = 1 << 3,
+	};
+
+	ENUM_CLASS_FLAGS(EKeyFlags)
+
+	/*
+	 * every key known by the input, Key(Name, Flags)
+	 * the position of a key in the list is its index, a key added to the list only needs a line here
+	 */
+	#define ZERO_INPUT_KEYS(Key) \
+		Key(LeftMouseButton, EKeyFlags::MouseButton) \
+		Key(RightMouseButton, EKeyFlags::MouseButton) \
+		Key(MiddleMouseButton, EKeyFlags::MouseButton) \
+		Key(ThumbMouseButton, EKeyFlags::MouseButton) \
+		Key(ThumbMouseButton2, EKeyFlags::MouseButton) \
+		Key(MouseX, EKeyFlags::Axis) \
+		Key(MouseY, EKeyFlags::Axis) \
+		Key(MouseWheelAxis, EKeyFlags::Axis) \
+		Key(MouseScrollUp, EKeyFlags::MouseButton) \
+		Key(MouseScrollDown, EKeyFlags::MouseButton) \
+		\
+		Key(BackSpace, EKeyFlags::Keyboard) \
+		Key(Tab, EKeyFlags::Keyboard) \
+		Key(Enter, EKeyFlags::Keyboard) \
+		Key(Pause, EKeyFlags::Keyboard) \
+		Key(CapsLock, EKeyFlags::Keyboard) \
+		Key(Escape, EKeyFlags::Keyboard) \
+		Key(SpaceBar, EKeyFlags::Keyboard) \
+		Key(PageUp, EKeyFlags::Keyboard) \
+		Key(PageDown, EKeyFlags::Keyboard) \
+		Key(End, EKeyFlags::Keyboard) \
+		Key(Home, EKeyFlags::Keyboard) \
+		Key(Left, EKeyFlags::Keyboard) \
+		Key(Up, EKeyFlags::Keyboard) \
+		Key(Right, EKeyFlags::Keyboard) \
+		Key(Down, EKeyFlags::Keyboard) \
+		Key(Insert, EKeyFlags::Keyboard) \
+		Key(Delete, EKeyFlags::Keyboard) \
+		\
+		Key(Zero, EKeyFlags::Keyboard) \
+		Key(One, EKeyFlags::Keyboard) \
+		Key(Two, EKeyFlags::Keyboard) \
+		Key(Three, EKeyFlags::Keyboard) \
+		Key(Four, EKeyFlags::Keyboard) \
+		Key(Five, EKeyFlags::Keyboard) \
+		Key(Six, EKeyFlags::Keyboard) \
+		Key(Seven, EKeyFlags::Keyboard) \
+		Key(Eight, EKeyFlags::Keyboard) \
+		Key(Nine, EKeyFlags::Keyboard) \
+		\
+		Key(A, EKeyFlags::Keyboard) \
+		Key(B, EKeyFlags::Keyboard) \
+		Key(C, EKeyFlags::Keyboard) \
+		Key(D, EKeyFlags::Keyboard) \
+		Key(E, EKeyFlags::Keyboard) \
+		Key(F, EKeyFlags::Keyboard) \
+		Key(G, EKeyFlags::Keyboard) \
+		Key(H, EKeyFlags::Keyboard) \
+		Key(I, EKeyFlags::Keyboard) \
+		Key(J, EKeyFlags::Keyboard) \
+		Key(K, EKeyFlags::Keyboard) \
+		Key(L, EKeyFlags::Keyboard) \
+		Key(M, EKeyFlags::Keyboard) \
+		Key(N, EKeyFlags::Keyboard) \
+		Key(O, EKeyFlags::Keyboard) \
+		Key(P, EKeyFlags::Keyboard) \
+		Key(Q, EKeyFlags::Keyboard) \
+		Key(R, EKeyFlags::Keyboard) \
+		Key(S, EKeyFlags::Keyboard) \
+		Key(T, EKeyFlags::Keyboard) \
+		Key(U, EKeyFlags::Keyboard) \
+		Key(V, EKeyFlags::Keyboard) \
+		Key(W, EKeyFlags::Keyboard) \
+		Key(X, EKeyFlags::Keyboard) \
+		Key(Y, EKeyFlags::Keyboard) \
+		Key(Z, EKeyFlags::Keyboard) \
+		\
+		Key(NumPadZero, EKeyFlags::Keyboard) \
+		Key(NumPadOne, EKeyFlags::Keyboard) \
+		Key(NumPadTwo, EKeyFlags::Keyboard) \
+		Key(NumPadThree, EKeyFlags::Keyboard) \
+		Key(NumPadFour, EKeyFlags::Keyboard) \
+		Key(NumPadFive, EKeyFlags::Keyboard) \
+		Key(NumPadSix, EKeyFlags::Keyboard) \
+		Key(NumPadSeven, EKeyFlags::Keyboard) \
+		Key(NumPadEight, EKeyFlags::Keyboard) \
+		Key(NumPadNine, EKeyFlags::Keyboard) \
+		Key(Multiply, EKeyFlags::Keyboard) \
+		Key(Add, EKeyFlags::Keyboard) \
+		Key(Subtract, EKeyFlags::Keyboard) \
+		Key(Decimal, EKeyFlags::Keyboard) \
+		Key(Divide, EKeyFlags::Keyboard) \
+		\
+		Key(F1, EKeyFlags::Keyboard) \
+		Key(F2, EKeyFlags::Keyboard) \
+		Key(F3, EKeyFlags::Keyboard) \
+		Key(F4, EKeyFlags::Keyboard) \
+		Key(F5, EKeyFlags::Keyboard) \
+		Key(F6, EKeyFlags::Keyboard) \
+		Key(F7, EKeyFlags::Keyboard) \
+		Key(F8, EKeyFlags::Keyboard) \
+		Key(F9, EKeyFlags::Keyboard) \
+		Key(F10, EKeyFlags::Keyboard) \
+		Key(F11, EKeyFlags::Keyboard) \
+		Key(F12, EKeyFlags::Keyboard) \
+		\
+		Key(NumLock, EKeyFlags::Keyboard) \
+		Key(ScrollLock, EKeyFlags::Keyboard) \
+		Key(LeftShift, EKeyFlags::Keyboard | EKeyFlags::ModifierKey) \
+		Key(RightShift, EKeyFlags::Keyboard | EKeyFlags::ModifierKey) \
+		Key(LeftControl, EKeyFlags::Keyboard | EKeyFlags::ModifierKey) \
+		Key(RightControl, EKeyFlags::Keyboard | EKeyFlags::ModifierKey) \
+		Key(LeftAlt, EKeyFlags::Keyboard | EKeyFlags::ModifierKey) \
+		Key(RightAlt, EKeyFlags::Keyboard | EKeyFlags::ModifierKey) \
+		Key(LeftCommand, EKeyFlags::Keyboard | EKeyFlags::ModifierKey) \
+		Key(RightCommand, EKeyFlags::Keyboard | EKeyFlags::ModifierKey) \
+		\
+		Key(Semicolon, EKeyFlags::Keyboard) \
+		Key(Equals, EKeyFlags::Keyboard) \
+		Key(Comma, EKeyFlags::Keyboard) \
+		Key(Hyphen, EKeyFlags::Keyboard) \
+		Key(Period, EKeyFlags::Keyboard) \
+		Key(Slash, EKeyFlags::Keyboard) \
+		Key(Tilde, EKeyFlags::Keyboard) \
+		Key(LeftBracket, EKeyFlags::Keyboard) \
+		Key(Backslash, EKeyFlags::Keyboard) \
+		Key(RightBracket, EKeyFlags::Keyboard) \
+		Key(Apostrophe, EKeyFlags::Keyboard)
+
+	struct FKeyDetails
+	{
+		std::string_view Name;
+		EKeyFlags Flags;
+	};
+
+	namespace InputCorePrivate
+	{
+		enum EKeyIndex : uint16_t
+		{
+			Invalid,
+		#define ZERO_KEY_INDEX(Name, Flags) Name,
+			ZERO_INPUT_KEYS(ZERO_KEY_INDEX)
+		#undef ZERO_KEY_INDEX
+			NumKeys,
+		};
+
+		/* the details of every key, indexed by the key */
+		inline constexpr FKeyDetails KeyTable[] =
+		{
+			{ std::string_view(), EKeyFlags::None },
+		#define ZERO_KEY_DETAILS(Name, Flags) { #Name, Flags },
+			ZERO_INPUT_KEYS(ZERO_KEY_DETAILS)
+		#undef ZERO_KEY_DETAILS
+		};
+
+		static_assert(std::size(KeyTable) == NumKeys, "the key table must have an entry per key");
+	}
+
+	/*
+	 * a key of the keyboard, a mouse button or axis
+	 * a key is the index of its entry in the key table, copying, comparing and hashing a key is an integer operation.
+	 * the name and the flags of a key are read from the table, they are known at compile time.
+	 */
 	struct FKey
 	{
-		FKey()
+		constexpr FKey()
+			: m_Index(InputCorePrivate::Invalid)
 		{
 		}
 
-		FKey(const std::string& InName)
-			: m_KeyName(InName)
+		explicit constexpr FKey(uint16_t InIndex)
+			: m_Index(InIndex < InputCorePrivate::NumKeys ? InIndex : static_cast<uint16_t>(InputCorePrivate::Invalid))
 		{}
 
+		/* find a key by its name, e.g. when a binding is read from a config, Invalid when the name is unknown */
+		explicit FKey(std::string_view InName);
+
+		constexpr bool IsValid() const { return m_Index != InputCorePrivate::Invalid; }
+
+		/* the index of the key in the table, in [0, EKeys::NumKeys) */
+		constexpr uint16_t GetIndex() const { return m_Index; }
+
+		constexpr const FKeyDetails& GetDetails() const { return InputCorePrivate::KeyTable[m_Index]; }
+
+		/* the name of the key, empty for Invalid */
+		constexpr std::string_view GetName() const { return GetDetails().Name; }
+
+		constexpr bool IsMouseButton() const { return EnumHasAnyFlags(GetDetails().Flags, EKeyFlags::MouseButton); }
+
+		constexpr bool IsModifierKey() const { return EnumHasAnyFlags(GetDetails().Flags, EKeyFlags::ModifierKey); }
+
+		constexpr bool IsKeyboardKey() const { return EnumHasAnyFlags(GetDetails().Flags, EKeyFlags::Keyboard); }
+
+		constexpr bool IsAxis() const { return EnumHasAnyFlags(GetDetails().Flags, EKeyFlags::Axis); }
+
+		constexpr bool operator==(FKey Other) const { return m_Index == Other.m_Index; }
+		constexpr bool operator!=(FKey Other) const { return m_Index != Other.m_Index; }
+
+		/* the order of the key table, for sorted containers */
+		constexpr bool operator<(FKey Other) const { return m_Index < Other.m_Index; }
+
 	private:
-		std::string m_KeyName;
+		uint16_t m_Index;
 	};
 
+	static_assert(sizeof(FKey) == sizeof(uint16_t), "a key must stay a single index");
+
 	struct EKeys
 	{
-		static const FKey Invalid;
+		static constexpr uint16_t NumKeys = InputCorePrivate::NumKeys;
 
-		static const FKey LeftMouseButton;
-		static const FKey RightMouseButton;
-		static const FKey MiddleMouseButton;
-		static const FKey ThumbMouseButton;
-		static const FKey ThumbMouseButton2;
+		static constexpr FKey Invalid{ InputCorePrivate::Invalid };
+
+	#define ZERO_KEY_CONSTANT(Name, Flags) static constexpr FKey Name{ InputCorePrivate::Name };
+		ZERO_INPUT_KEYS(ZERO_KEY_CONSTANT)
+	#undef ZERO_KEY_CONSTANT
 	};
-} // namespace 
+
+	inline std::ostream& operator<<(std::ostream& Stream, FKey Key)
+	{
+		return Stream << Key.GetName();
+	}
+} // namespace
+
+template<>
+struct std::hash<ZeroUI::FKey>
+{
+	size_t operator()(ZeroUI::FKey Key) const noexcept
+	{
+		return Key.GetIndex();
+	}
+};
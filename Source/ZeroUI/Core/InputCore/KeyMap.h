@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Core.h"
+#include "Core/InputCore/InputCoreTypes.h"
+#include <bitset>
+
+namespace ZeroUI
+{
+	/*
+	 * a set of keys, one bit per key of the key table
+	 * e.g. the pressed mouse buttons of a pointer event, adding and testing a key is a bit operation
+	 */
+	class FKeySet
+	{
+	public:
+		/* EKeys::Invalid is never added */
+		void Add(FKey Key)
+		{
+			if (Key.IsValid())
+			{
+				m_Bits.set(Key.GetIndex());
+			}
+		}
+
+		void Remove(FKey Key) { m_Bits.reset(Key.GetIndex()); }
+
+		bool Contains(FKey Key) const { return m_Bits.test(Key.GetIndex()); }
+
+		int32_t Num() const { return static_cast<int32_t>(m_Bits.count()); }
+
+		bool IsEmpty() const { return m_Bits.none(); }
+
+		void Reset() { m_Bits.reset(); }
+
+		/* call the function with every key of the set, in the order of the key table */
+		template<typename FunctionType>
+		void ForEach(FunctionType&& Function) const
+		{
+			for (uint16_t Index = 1; Index < EKeys::NumKeys; ++Index)
+			{
+				if (m_Bits.test(Index))
+				{
+					Function(FKey(Index));
+				}
+			}
+		}
+
+		bool operator==(const FKeySet& Other) const { return m_Bits == Other.m_Bits; }
+
+	private:
+		std::bitset<EKeys::NumKeys> m_Bits;
+	};
+
+	/*
+	 * a value per key, e.g. the action bound to each key
+	 * the values are stored in an array indexed by the keys, finding the value of a key is an array access and never a
+	 * lookup. the unbound keys keep a default constructed value.
+	 */
+	template<typename ValueType>
+	class TKeyMap
+	{
+	public:
+		TKeyMap()
+			: m_Values()
+		{
+		}
+
+		/* bind the key, an existing value is replaced */
+		void Add(FKey Key, ValueType Value)
+		{
+			assert(Key.IsValid());
+			m_Values[Key.GetIndex()] = std::move(Value);
+			m_Bound.Add(Key);
+		}
+
+		void Remove(FKey Key)
+		{
+			if (m_Bound.Contains(Key))
+			{
+				m_Values[Key.GetIndex()] = ValueType();
+				m_Bound.Remove(Key);
+			}
+		}
+
+		bool Contains(FKey Key) const { return m_Bound.Contains(Key); }
+
+		/* @return the value of the key, nullptr when the key is not bound */
+		const ValueType* Find(FKey Key) const
+		{
+			return m_Bound.Contains(Key) ? &m_Values[Key.GetIndex()] : nullptr;
+		}
+
+		ValueType* Find(FKey Key)
+		{
+			return m_Bound.Contains(Key) ? &m_Values[Key.GetIndex()] : nullptr;
+		}
+
+		/* @return the value of the key, the default value when the key is not bound */
+		const ValueType& FindOrDefault(FKey Key) const { return m_Values[Key.GetIndex()]; }
+
+		const FKeySet& GetBoundKeys() const { return m_Bound; }
+
+		int32_t Num() const { return m_Bound.Num(); }
+
+		void Empty()
+		{
+			m_Bound.ForEach([this](FKey Key) { m_Values[Key.GetIndex()] = ValueType(); });
+			m_Bound.Reset();
+		}
+
+	private:
+		/* the entry 0 is the value of EKeys::Invalid, it's never bound */
+		std::array<ValueType, EKeys::NumKeys> m_Values;
+
+		FKeySet m_Bound;
+	};
+}
@@ -1,16 +1,49 @@
 #include "Log.h"
+#include <spdlog/sinks/stdout_color_sinks.h>
 
 namespace ZeroUI
 {
 std::shared_ptr<spdlog::logger> FLog::s_CoreLogger;
 std::shared_ptr<spdlog::logger> FLog::s_ClientLogger;
+std::unique_ptr<FAsyncLog> FLog::s_AsyncLog;
 void FLog::Init()
 {
-	spdlog::set_pattern("%^[%T] %n: %v%$");  
+	spdlog::set_pattern("%^[%T] %n: %v%$");
 	s_CoreLogger = spdlog::stdout_color_mt("ZeroEngine");
 	s_CoreLogger->set_level(spdlog::level::trace);
 
 	s_ClientLogger = spdlog::stdout_color_mt("APP");
 	s_ClientLogger->set_level(spdlog::level::trace);
 }
+
+void FLog::InitAsync(const FAsyncLogSettings& Settings)
+{
+	if (!s_CoreLogger)
+	{
+		Init();
+	}
+	s_AsyncLog = std::make_unique<FAsyncLog>(Settings);
+}
+
+void FLog::Shutdown()
+{
+	// the destructor drains the queue
+	s_AsyncLog.reset();
+}
+
+void FLog::Flush()
+{
+	if (s_AsyncLog)
+	{
+		s_AsyncLog->Flush();
+	}
+	if (s_CoreLogger)
+	{
+		s_CoreLogger->flush();
+	}
+	if (s_ClientLogger)
+	{
+		s_ClientLogger->flush();
+	}
+}
 }
@@ -2,6 +2,21 @@
 
 #include <spdlog/spdlog.h>
 #include <spdlog/fmt/ostr.h>
+#include "Core/AsyncLog.h"
+
+/* the levels of ZERO_LOG_ACTIVE_LEVEL, same order as spdlog::level */
+#define ZERO_LOG_LEVEL_TRACE	0
+#define ZERO_LOG_LEVEL_DEBUG	1
+#define ZERO_LOG_LEVEL_INFO		2
+#define ZERO_LOG_LEVEL_WARN		3
+#define ZERO_LOG_LEVEL_ERROR	4
+#define ZERO_LOG_LEVEL_FATAL	5
+#define ZERO_LOG_LEVEL_OFF		6
+
+/* the macros below this level are compiled out, their arguments are not evaluated */
+#ifndef ZERO_LOG_ACTIVE_LEVEL
+#define ZERO_LOG_ACTIVE_LEVEL ZERO_LOG_LEVEL_TRACE
+#endif
 
 namespace ZeroUI
 {
@@ -9,33 +24,96 @@ class FLog
 {
 public:
 	static void Init();
+
+	/* init and send the messages to a background thread, the calling thread only formats the arguments that can't be copied */
+	static void InitAsync(const FAsyncLogSettings& Settings = FAsyncLogSettings());
+
+	/* write the pending messages and stop the background thread */
+	static void Shutdown();
+
+	/* block until the pending messages are written */
+	static void Flush();
+
 	inline static std::shared_ptr<spdlog::logger>& GetCoreLogger() { return s_CoreLogger; }
 	inline static std::shared_ptr<spdlog::logger>& GetClientLogger() { return s_ClientLogger; }
+
+	/* null when the log is synchronous */
+	inline static FAsyncLog* GetAsyncLog() { return s_AsyncLog.get(); }
+
+	template<typename... ArgTypes>
+	static void Log(ELogCategory Category, spdlog::level::level_enum Level, const char* Format, ArgTypes&&... Args)
+	{
+		const std::shared_ptr<spdlog::logger>& Logger = Category == ELogCategory::Core ? s_CoreLogger : s_ClientLogger;
+		if (!Logger || !Logger->should_log(Level))
+		{
+			return;
+		}
+
+		if (s_AsyncLog)
+		{
+			s_AsyncLog->Push(Category, Level, Format, std::forward<ArgTypes>(Args)...);
+		}
+		else
+		{
+			Logger->log(Level, fmt::runtime(Format), std::forward<ArgTypes>(Args)...);
+		}
+	}
 private:
 	static std::shared_ptr<spdlog::logger> s_CoreLogger;
 	static std::shared_ptr<spdlog::logger> s_ClientLogger;
+	static std::unique_ptr<FAsyncLog> s_AsyncLog;
 };
 }
 
+#define ZERO_LOG(Category, Level, ...)	::ZeroUI::FLog::Log(::ZeroUI::ELogCategory::Category, spdlog::level::Level, __VA_ARGS__)
+
 // Core log macros
-#define CORE_LOG_TRACE(...)		Zero::FLog::GetCoreLogger()->trace(__VA_ARGS__)
-#define CORE_LOG_INFO(...)		Zero::FLog::GetCoreLogger()->info(__VA_ARGS__)
-#define CORE_LOG_WARN(...)		Zero::FLog::GetCoreLogger()->warn(__VA_ARGS__)
-#define CORE_LOG_ERROR(...)		Zero::FLog::GetCoreLogger()->error(__VA_ARGS__)
-#define CORE_LOG_FATAL(...)		Zero::FLog::GetCoreLogger()->fatal(__VA_ARGS__)
-
-// Client log macros
-#define CLIENT_LOG_TRACE(...)			Zero::FLog::GetClientLogger()->trace(__VA_ARGS__)
-#define CLIENT_LOG_INFO(...)			Zero::FLog::GetClientLogger()->info(__VA_ARGS__)
-#define CLIENT_LOG_WARN(...)			Zero::FLog::GetClientLogger()->warn(__VA_ARGS__)
-#define CLIENT_LOG_ERROR(...)			Zero::FLog::GetClientLogger()->error(__VA_ARGS__)
-#define CLIENT_LOG_FATAL(...)			Zero::FLog::GetClientLogger()->fatal(__VA_ARGS__)
+#if ZERO_LOG_ACTIVE_LEVEL <= ZERO_LOG_LEVEL_TRACE
+#define CORE_LOG_TRACE(...)		ZERO_LOG(Core, trace, __VA_ARGS__)
+#define CLIENT_LOG_TRACE(...)	ZERO_LOG(Client, trace, __VA_ARGS__)
+#else
+#define CORE_LOG_TRACE(...)		((void)0)
+#define CLIENT_LOG_TRACE(...)	((void)0)
+#endif
+
+#if ZERO_LOG_ACTIVE_LEVEL <= ZERO_LOG_LEVEL_INFO
+#define CORE_LOG_INFO(...)		ZERO_LOG(Core, info, __VA_ARGS__)
+#define CLIENT_LOG_INFO(...)	ZERO_LOG(Client, info, __VA_ARGS__)
+#else
+#define CORE_LOG_INFO(...)		((void)0)
+#define CLIENT_LOG_INFO(...)	((void)0)
+#endif
+
+#if ZERO_LOG_ACTIVE_LEVEL <= ZERO_LOG_LEVEL_WARN
+#define CORE_LOG_WARN(...)		ZERO_LOG(Core, warn, __VA_ARGS__)
+#define CLIENT_LOG_WARN(...)	ZERO_LOG(Client, warn, __VA_ARGS__)
+#else
+#define CORE_LOG_WARN(...)		((void)0)
+#define CLIENT_LOG_WARN(...)	((void)0)
+#endif
+
+#if ZERO_LOG_ACTIVE_LEVEL <= ZERO_LOG_LEVEL_ERROR
+#define CORE_LOG_ERROR(...)		ZERO_LOG(Core, err, __VA_ARGS__)
+#define CLIENT_LOG_ERROR(...)	ZERO_LOG(Client, err, __VA_ARGS__)
+#else
+#define CORE_LOG_ERROR(...)		((void)0)
+#define CLIENT_LOG_ERROR(...)	((void)0)
+#endif
+
+// spdlog has no fatal level, critical is the closest
+#if ZERO_LOG_ACTIVE_LEVEL <= ZERO_LOG_LEVEL_FATAL
+#define CORE_LOG_FATAL(...)		ZERO_LOG(Core, critical, __VA_ARGS__)
+#define CLIENT_LOG_FATAL(...)	ZERO_LOG(Client, critical, __VA_ARGS__)
+#else
+#define CORE_LOG_FATAL(...)		((void)0)
+#define CLIENT_LOG_FATAL(...)	((void)0)
+#endif
 
 #define ZERO_ENABLE_ASSETS
 
 #ifdef ZERO_ENABLE_ASSETS
-#define CLIENT_ASSERT(x, ...) {if(!(x)){CLIENT_LOG_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak();}}
-#define CORE_ASSERT(x, ...) {if(!(x)){CORE_LOG_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak();}}
+#define CLIENT_ASSERT(x, ...) {if(!(x)){CLIENT_LOG_ERROR("Assertion Failed: {0}", __VA_ARGS__); ::ZeroUI::FLog::Flush(); __debugbreak();}}
+#define CORE_ASSERT(x, ...) {if(!(x)){CORE_LOG_ERROR("Assertion Failed: {0}", __VA_ARGS__); ::ZeroUI::FLog::Flush(); __debugbreak();}}
 #else
 #define CLIENT_ASSERT(x, ...)
 #define CORE_ASSERT(x, ...)
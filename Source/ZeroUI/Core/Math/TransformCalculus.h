@@ -119,6 +119,15 @@ namespace ZeroUI
 		typedef TransformType ResultType;
 	};
 
+	/**
+	 * Specialization for concatenating two uniform scales.
+	 * Declared before the generic Concatenate, a float has no namespace the generic version could find it through.
+	 */
+	inline float Concatenate(float LHS, float RHS)
+	{
+		return LHS * RHS;
+	}
+
 	/**
 	 * Concatenates two transforms. Uses TransformCast<> to convert them first.
 	 * If more efficient means are available to concatenate two transforms, provide a non-template overload (or possibly a specialization).
@@ -138,7 +147,7 @@ namespace ZeroUI
 	}
 
 	template<typename TransformType>
-	inline auto Concatenate(const TransformType& LHS, const TransformType& RHS) -> decltype(LHS.concatenate(RHS))
+	inline auto Concatenate(const TransformType& LHS, const TransformType& RHS) -> decltype(LHS.Concatenate(RHS))
 	{
 		return LHS.Concatenate(RHS);
 	}
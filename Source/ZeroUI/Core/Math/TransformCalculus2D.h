@@ -39,8 +39,8 @@ namespace ZeroUI
 
 		explicit FMatrix2x2(const FScale2D& Scale)
 		{
-			float ScaleX = Scale.GetVector().X;
-			float ScaleY = Scale.GetVector().Y;
+			float ScaleX = Scale.GetVector().x;
+			float ScaleY = Scale.GetVector().y;
 
 			m_M[0][0] = ScaleX; m_M[0][1] = 0;
 			m_M[1][0] = 0;      m_M[1][1] = ScaleY;
@@ -153,7 +153,7 @@ namespace ZMath
     }
 
 
-	static UINT CalcConstantBufferByteSize(UINT byteSize)
+	static uint32_t CalcConstantBufferByteSize(uint32_t byteSize)
 	{
 		// Constant buffers must be a multiple of the minimum hardware
 		// allocation size (usually 256 bytes).  So round up to nearest
@@ -15,7 +15,7 @@ namespace ZeroUI
 		 *
 		 * @return  The attribute's value
 		 */
-		DECLARE_DELEGATE_RetVal( ObjectType, FGetter );
+		using FGetter = FSingleDelegate<ObjectType>;
 		/** Default constructor. */
 		TAttribute()
 			: m_Value()         // NOTE: Potentially uninitialized for atomics!!
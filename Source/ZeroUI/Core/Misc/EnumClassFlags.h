@@ -29,13 +29,13 @@ namespace ZeroUI
 	template<typename Enum>
 	constexpr bool EnumHasAllFlags(Enum Flags, Enum Contains)
 	{
-		return ( ( ( std::underlying_type<Enum>::type )Flags ) & ( std::underlying_type<Enum>::type )Contains ) == ( ( std::underlying_type<Enum>::type )Contains );
+		return ( ( ( typename std::underlying_type<Enum>::type )Flags ) & ( typename std::underlying_type<Enum>::type )Contains ) == ( ( typename std::underlying_type<Enum>::type )Contains );
 	}
 
 	template<typename Enum>
 	constexpr bool EnumHasAnyFlags(Enum Flags, Enum Contains)
 	{
-		return ( ( ( std::underlying_type<Enum>::type )Flags ) & ( std::underlying_type<Enum>::type )Contains ) != 0;
+		return ( ( ( typename std::underlying_type<Enum>::type )Flags ) & ( typename std::underlying_type<Enum>::type )Contains ) != 0;
 	}
 
 	template<typename Enum>
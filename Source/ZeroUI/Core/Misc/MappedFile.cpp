@@ -0,0 +1,120 @@
+#include "MappedFile.h"
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace ZeroUI
+{
+	FMappedFile::~FMappedFile()
+	{
+		Close();
+	}
+
+#if defined(_WIN32)
+	bool FMappedFile::Open(const std::string& Path)
+	{
+		Close();
+
+		m_File = ::CreateFileW(std::filesystem::path(Path).wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (m_File == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER FileSize;
+		if (!::GetFileSizeEx(m_File, &FileSize) || FileSize.QuadPart == 0)
+		{
+			Close();
+			return false;
+		}
+
+		m_Mapping = ::CreateFileMappingW(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (m_Mapping == nullptr)
+		{
+			Close();
+			return false;
+		}
+
+		m_Data = static_cast<const uint8_t*>(::MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+		if (m_Data == nullptr)
+		{
+			Close();
+			return false;
+		}
+
+		m_Size = static_cast<size_t>(FileSize.QuadPart);
+		return true;
+	}
+
+	void FMappedFile::Close()
+	{
+		if (m_Data != nullptr)
+		{
+			::UnmapViewOfFile(m_Data);
+			m_Data = nullptr;
+		}
+		if (m_Mapping != nullptr)
+		{
+			::CloseHandle(m_Mapping);
+			m_Mapping = nullptr;
+		}
+		if (m_File != INVALID_HANDLE_VALUE)
+		{
+			::CloseHandle(m_File);
+			m_File = INVALID_HANDLE_VALUE;
+		}
+		m_Size = 0;
+	}
+#else
+	bool FMappedFile::Open(const std::string& Path)
+	{
+		Close();
+
+		m_FileDescriptor = ::open(Path.c_str(), O_RDONLY);
+		if (m_FileDescriptor < 0)
+		{
+			return false;
+		}
+
+		struct stat FileStat;
+		if (::fstat(m_FileDescriptor, &FileStat) != 0 || FileStat.st_size == 0)
+		{
+			Close();
+			return false;
+		}
+
+		void* MappedData = ::mmap(nullptr, static_cast<size_t>(FileStat.st_size), PROT_READ, MAP_PRIVATE, m_FileDescriptor, 0);
+		if (MappedData == MAP_FAILED)
+		{
+			Close();
+			return false;
+		}
+
+		// the whole file is decoded right away
+		::madvise(MappedData, static_cast<size_t>(FileStat.st_size), MADV_SEQUENTIAL);
+
+		m_Data = static_cast<const uint8_t*>(MappedData);
+		m_Size = static_cast<size_t>(FileStat.st_size);
+		return true;
+	}
+
+	void FMappedFile::Close()
+	{
+		if (m_Data != nullptr)
+		{
+			::munmap(const_cast<uint8_t*>(m_Data), m_Size);
+			m_Data = nullptr;
+		}
+		if (m_FileDescriptor >= 0)
+		{
+			::close(m_FileDescriptor);
+			m_FileDescriptor = -1;
+		}
+		m_Size = 0;
+	}
+#endif
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Core.h"
+
+namespace ZeroUI
+{
+	/*
+	 * read only memory mapping of a whole file
+	 * the pages are loaded by the os on first access, so the file is never copied in a buffer of ours
+	 */
+	class FMappedFile
+	{
+	public:
+		FMappedFile() = default;
+		~FMappedFile();
+
+		FMappedFile(const FMappedFile&) = delete;
+		FMappedFile& operator=(const FMappedFile&) = delete;
+
+		/* map the file, returns false if the file can't be opened or is empty */
+		bool Open(const std::string& Path);
+
+		void Close();
+
+		bool IsValid() const { return m_Data != nullptr; }
+
+		const uint8_t* GetData() const { return m_Data; }
+
+		size_t GetSize() const { return m_Size; }
+
+	private:
+		const uint8_t* m_Data = nullptr;
+
+		size_t m_Size = 0;
+
+#if defined(_WIN32)
+		HANDLE m_File = INVALID_HANDLE_VALUE;
+		HANDLE m_Mapping = nullptr;
+#else
+		int m_FileDescriptor = -1;
+#endif
+	};
+}
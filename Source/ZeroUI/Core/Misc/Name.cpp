@@ -0,0 +1,201 @@
+#include "Name.h"
+
+namespace ZeroUI
+{
+	namespace
+	{
+		struct FNameEntry
+		{
+			uint32_t ComparisonIndex;
+			uint32_t Length;
+
+			/* null terminated, the entry is allocated with the size of its text */
+			char Text[1];
+		};
+
+		/*
+		 * the texts of the names
+		 * the entries are allocated once and never move, a hash table of entry indices finds a text. a new text is
+		 * published in an empty slot of the hash table with a compare and swap, when two threads add the same text at
+		 * the same time the loser uses the entry of the winner and its own entry is never found.
+		 */
+		class FNameTable
+		{
+		public:
+			static constexpr uint32_t MaxNames = 1 << 16;
+			static constexpr uint32_t ChunkSize = 1 << 10;
+			static constexpr uint32_t NumChunks = MaxNames / ChunkSize;
+
+			/* twice the names, the probes stay short */
+			static constexpr uint32_t NumSlots = MaxNames * 2;
+
+			static FNameTable& Get()
+			{
+				static FNameTable Instance;
+				return Instance;
+			}
+
+			FNameTable()
+				: m_Slots(new std::atomic<uint32_t>[NumSlots])
+				, m_NumEntries(0)
+			{
+				for (uint32_t SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+				{
+					m_Slots[SlotIndex].store(0, std::memory_order_relaxed);
+				}
+				for (std::atomic<std::atomic<const FNameEntry*>*>& Chunk : m_Chunks)
+				{
+					Chunk.store(nullptr, std::memory_order_relaxed);
+				}
+
+				// the entry 0 is the empty name
+				[[maybe_unused]] const uint32_t NoneIndex = CreateEntry(std::string_view());
+				assert(NoneIndex == 0);
+			}
+
+			uint32_t FindOrAdd(std::string_view Text)
+			{
+				if (Text.empty())
+				{
+					return 0;
+				}
+
+				const uint32_t Hash = HashText(Text);
+				uint32_t NewIndex = 0;
+				for (uint32_t SlotIndex = Hash & (NumSlots - 1);; SlotIndex = (SlotIndex + 1) & (NumSlots - 1))
+				{
+					uint32_t Index = m_Slots[SlotIndex].load(std::memory_order_acquire);
+					if (Index == 0)
+					{
+						if (NewIndex == 0)
+						{
+							NewIndex = CreateEntry(Text);
+						}
+
+						if (m_Slots[SlotIndex].compare_exchange_strong(Index, NewIndex, std::memory_order_acq_rel, std::memory_order_acquire))
+						{
+							return NewIndex;
+						}
+						// another thread took the slot, Index is its entry
+					}
+
+					const FNameEntry& Entry = GetEntry(Index);
+					if (std::string_view(Entry.Text, Entry.Length) == Text)
+					{
+						return Index;
+					}
+				}
+			}
+
+			const FNameEntry& GetEntry(uint32_t Index) const
+			{
+				const std::atomic<const FNameEntry*>* Chunk = m_Chunks[Index / ChunkSize].load(std::memory_order_acquire);
+				return *Chunk[Index % ChunkSize].load(std::memory_order_acquire);
+			}
+
+			uint32_t GetNumEntries() const { return m_NumEntries.load(std::memory_order_relaxed); }
+
+		private:
+			static uint32_t HashText(std::string_view Text)
+			{
+				// fnv-1a
+				uint32_t Hash = 2166136261u;
+				for (char Character : Text)
+				{
+					Hash = (Hash ^ static_cast<uint8_t>(Character)) * 16777619u;
+				}
+				return Hash;
+			}
+
+			uint32_t CreateEntry(std::string_view Text)
+			{
+				// the lower case text is interned first, the comparison index of a lower case text is its own index
+				std::string LowerText(Text);
+				std::transform(LowerText.begin(), LowerText.end(), LowerText.begin(), [](char Character) { return static_cast<char>(std::tolower(static_cast<uint8_t>(Character))); });
+				const bool bLowerCase = LowerText == Text;
+				const uint32_t ComparisonIndex = bLowerCase ? 0 : FindOrAdd(LowerText);
+
+				const uint32_t Index = m_NumEntries.fetch_add(1, std::memory_order_relaxed);
+				if (Index >= MaxNames)
+				{
+					// the chunks don't grow, a name past the limit would be written out of the table
+					CORE_LOG_FATAL("FName: the name table is full, it holds {0} names", MaxNames);
+					FLog::Flush();
+					std::abort();
+				}
+
+				FNameEntry* Entry = static_cast<FNameEntry*>(::operator new(offsetof(FNameEntry, Text) + Text.size() + 1));
+				Entry->ComparisonIndex = bLowerCase ? Index : ComparisonIndex;
+				Entry->Length = static_cast<uint32_t>(Text.size());
+				std::memcpy(Entry->Text, Text.data(), Text.size());
+				Entry->Text[Text.size()] = '\0';
+
+				GetOrCreateChunk(Index / ChunkSize)[Index % ChunkSize].store(Entry, std::memory_order_release);
+				return Index;
+			}
+
+			std::atomic<const FNameEntry*>* GetOrCreateChunk(uint32_t ChunkIndex)
+			{
+				std::atomic<const FNameEntry*>* Chunk = m_Chunks[ChunkIndex].load(std::memory_order_acquire);
+				if (Chunk)
+				{
+					return Chunk;
+				}
+
+				std::atomic<const FNameEntry*>* NewChunk = new std::atomic<const FNameEntry*>[ChunkSize];
+				for (uint32_t EntryIndex = 0; EntryIndex < ChunkSize; ++EntryIndex)
+				{
+					NewChunk[EntryIndex].store(nullptr, std::memory_order_relaxed);
+				}
+
+				if (m_Chunks[ChunkIndex].compare_exchange_strong(Chunk, NewChunk, std::memory_order_acq_rel, std::memory_order_acquire))
+				{
+					return NewChunk;
+				}
+
+				// another thread created the chunk
+				delete[] NewChunk;
+				return Chunk;
+			}
+
+		private:
+			/* the index of an entry in each slot, 0 when the slot is empty */
+			std::unique_ptr<std::atomic<uint32_t>[]> m_Slots;
+
+			std::atomic<std::atomic<const FNameEntry*>*> m_Chunks[NumChunks];
+
+			std::atomic<uint32_t> m_NumEntries;
+		};
+	}
+
+	FName::FName(const char* Text)
+		: m_Index(Text ? FNameTable::Get().FindOrAdd(Text) : 0)
+	{
+	}
+
+	FName::FName(std::string_view Text)
+		: m_Index(FNameTable::Get().FindOrAdd(Text))
+	{
+	}
+
+	FName::FName(const std::string& Text)
+		: m_Index(FNameTable::Get().FindOrAdd(Text))
+	{
+	}
+
+	std::string_view FName::ToStringView() const
+	{
+		const FNameEntry& Entry = FNameTable::Get().GetEntry(m_Index);
+		return std::string_view(Entry.Text, Entry.Length);
+	}
+
+	uint32_t FName::GetComparisonIndex() const
+	{
+		return FNameTable::Get().GetEntry(m_Index).ComparisonIndex;
+	}
+
+	uint32_t FName::GetNumNames()
+	{
+		return FNameTable::Get().GetNumEntries();
+	}
+}
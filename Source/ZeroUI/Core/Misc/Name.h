@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Core.h"
+
+namespace ZeroUI
+{
+	enum class ENameCase : uint8_t
+	{
+		CaseSensitive,
+		IgnoreCase,
+	};
+
+	/*
+	 * an interned string, e.g. the type of a widget or the name of an attribute
+	 * the text is stored once in a global table and a name is only the index of its text, so copying, comparing and
+	 * hashing a name don't touch the text. the table is never locked, a name can be created from any thread.
+	 *
+	 * the names are case sensitive, "Button" and "button" are two names that can be compared ignoring the case
+	 * with IsEqual(Other, ENameCase::IgnoreCase), also without comparing the texts.
+	 */
+	class FName
+	{
+	public:
+		constexpr FName() = default;
+
+		FName(const char* Text);
+		FName(std::string_view Text);
+		FName(const std::string& Text);
+
+		/* the empty name */
+		bool IsNone() const { return m_Index == 0; }
+
+		/* the text is stored by the table until the end of the program, it's null terminated */
+		std::string_view ToStringView() const;
+
+		const char* c_str() const { return ToStringView().data(); }
+
+		std::string ToString() const { return std::string(ToStringView()); }
+
+		/* the index of the text in the table, two names with the same text have the same index */
+		uint32_t GetIndex() const { return m_Index; }
+
+		/* the index of the lower case text, shared by the names that only differ by their case */
+		uint32_t GetComparisonIndex() const;
+
+		bool IsEqual(FName Other, ENameCase Case = ENameCase::CaseSensitive) const
+		{
+			return Case == ENameCase::CaseSensitive ? m_Index == Other.m_Index : GetComparisonIndex() == Other.GetComparisonIndex();
+		}
+
+		bool operator==(FName Other) const { return m_Index == Other.m_Index; }
+
+		/* the order of creation of the names, not the alphabetical order, for sorted containers */
+		bool operator<(FName Other) const { return m_Index < Other.m_Index; }
+
+		/* the number of texts in the table */
+		static uint32_t GetNumNames();
+
+	private:
+		uint32_t m_Index = 0;
+	};
+
+	static_assert(sizeof(FName) == sizeof(uint32_t), "a name must stay a single index");
+
+	inline constexpr FName NAME_None;
+
+	inline std::ostream& operator<<(std::ostream& Stream, FName Name)
+	{
+		return Stream << Name.ToStringView();
+	}
+}
+
+template<>
+struct std::hash<ZeroUI::FName>
+{
+	size_t operator()(ZeroUI::FName Name) const noexcept
+	{
+		return Name.GetIndex();
+	}
+};
@@ -0,0 +1,91 @@
+#include "LatencyHistogram.h"
+#include <bit>
+
+namespace ZeroUI
+{
+	FLatencyHistogram::FLatencyHistogram()
+		: m_Buckets(GetBucketIndex(MaxValueNs) + 1, 0)
+		, m_Count(0)
+		, m_SumNs(0)
+		, m_MinNs(std::numeric_limits<uint64_t>::max())
+		, m_MaxNs(0)
+	{
+	}
+
+	uint32_t FLatencyHistogram::GetBucketIndex(uint64_t ValueNs)
+	{
+		if (ValueNs < 2 * SubBucketCount)
+		{
+			return static_cast<uint32_t>(ValueNs);
+		}
+
+		// the top SubBucketBits + 1 bits of the value select the bucket in its power of 2
+		const uint32_t Shift = static_cast<uint32_t>(std::bit_width(ValueNs)) - (SubBucketBits + 1);
+		return (Shift + 1) * SubBucketCount + static_cast<uint32_t>((ValueNs >> Shift) - SubBucketCount);
+	}
+
+	uint64_t FLatencyHistogram::GetBucketUpperBound(uint32_t BucketIndex)
+	{
+		if (BucketIndex < 2 * SubBucketCount)
+		{
+			return BucketIndex;
+		}
+
+		const uint32_t Shift = BucketIndex / SubBucketCount - 1;
+		const uint64_t SubBucket = BucketIndex % SubBucketCount + SubBucketCount;
+		return ((SubBucket + 1) << Shift) - 1;
+	}
+
+	void FLatencyHistogram::Add(uint64_t ValueNs)
+	{
+		++m_Buckets[GetBucketIndex(std::min(ValueNs, MaxValueNs))];
+		++m_Count;
+		m_SumNs += ValueNs;
+		m_MinNs = std::min(m_MinNs, ValueNs);
+		m_MaxNs = std::max(m_MaxNs, ValueNs);
+	}
+
+	void FLatencyHistogram::Merge(const FLatencyHistogram& Other)
+	{
+		for (size_t BucketIndex = 0; BucketIndex < m_Buckets.size(); ++BucketIndex)
+		{
+			m_Buckets[BucketIndex] += Other.m_Buckets[BucketIndex];
+		}
+		m_Count += Other.m_Count;
+		m_SumNs += Other.m_SumNs;
+		m_MinNs = std::min(m_MinNs, Other.m_MinNs);
+		m_MaxNs = std::max(m_MaxNs, Other.m_MaxNs);
+	}
+
+	void FLatencyHistogram::Reset()
+	{
+		std::fill(m_Buckets.begin(), m_Buckets.end(), 0);
+		m_Count = 0;
+		m_SumNs = 0;
+		m_MinNs = std::numeric_limits<uint64_t>::max();
+		m_MaxNs = 0;
+	}
+
+	uint64_t FLatencyHistogram::GetPercentileNs(double Percentile) const
+	{
+		if (m_Count == 0)
+		{
+			return 0;
+		}
+
+		// the rank of the value, at least the first one
+		const double Rank = std::ceil(std::clamp(Percentile, 0.0, 100.0) / 100.0 * static_cast<double>(m_Count));
+		const uint64_t Target = std::max<uint64_t>(1, static_cast<uint64_t>(Rank));
+
+		uint64_t Cumulated = 0;
+		for (uint32_t BucketIndex = 0; BucketIndex < m_Buckets.size(); ++BucketIndex)
+		{
+			Cumulated += m_Buckets[BucketIndex];
+			if (Cumulated >= Target)
+			{
+				return std::min(GetBucketUpperBound(BucketIndex), m_MaxNs);
+			}
+		}
+		return m_MaxNs;
+	}
+}
@@ -0,0 +1,152 @@
+#include "Profiler.h"
+
+namespace ZeroUI
+{
+	namespace
+	{
+		/* the buffer of the calling thread, cached so the recording doesn't lock */
+		thread_local void* t_ThreadBuffer = nullptr;
+
+		/* the names are literals or function names, only the characters that break the json are escaped */
+		void WriteJsonString(std::ostream& Stream, const char* Value)
+		{
+			Stream << '"';
+			for (const char* Char = Value; *Char != '\0'; ++Char)
+			{
+				if (*Char == '"' || *Char == '\\')
+				{
+					Stream << '\\';
+				}
+				Stream << *Char;
+			}
+			Stream << '"';
+		}
+	}
+
+	const char* GetFramePhaseName(EFramePhase Phase)
+	{
+		switch (Phase)
+		{
+		case EFramePhase::InputDrain:		return "InputDrain";
+		case EFramePhase::Tick:				return "Tick";
+		case EFramePhase::Prepass:			return "Prepass";
+		case EFramePhase::Arrange:			return "Arrange";
+		case EFramePhase::Paint:			return "Paint";
+		case EFramePhase::Batch:			return "Batch";
+		case EFramePhase::Present:			return "Present";
+		default:							return "Unknown";
+		}
+	}
+
+	EFramePhase FFrameStats::GetSlowestPhase() const
+	{
+		const auto Slowest = std::max_element(PhaseMs.begin(), PhaseMs.end());
+		return static_cast<EFramePhase>(std::distance(PhaseMs.begin(), Slowest));
+	}
+
+	FProfiler& FProfiler::Get()
+	{
+		static FProfiler Instance;
+		return Instance;
+	}
+
+	FProfiler::FProfiler()
+		: m_StartTime(std::chrono::steady_clock::now())
+		, m_bEnabled(true)
+	{
+	}
+
+	uint64_t FProfiler::GetTimeNs() const
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_StartTime).count());
+	}
+
+	void FProfiler::RecordEvent(const char* Name, uint64_t StartNs, uint64_t EndNs)
+	{
+		if (!IsEnabled())
+		{
+			return;
+		}
+
+		FThreadBuffer& Buffer = GetThreadBuffer();
+		const uint64_t WriteCount = Buffer.WriteCount.load(std::memory_order_relaxed);
+		Buffer.Events[WriteCount & (EventsPerThread - 1)] = FProfileEvent{ Name, StartNs, EndNs };
+		Buffer.WriteCount.store(WriteCount + 1, std::memory_order_release);
+	}
+
+	FProfiler::FThreadBuffer& FProfiler::GetThreadBuffer()
+	{
+		if (t_ThreadBuffer == nullptr)
+		{
+			std::lock_guard<std::mutex> Lock(m_BuffersMutex);
+			Scope<FThreadBuffer> Buffer = CreateScope<FThreadBuffer>();
+			Buffer->ThreadIndex = static_cast<uint32_t>(m_ThreadBuffers.size());
+			Buffer->Events.resize(EventsPerThread);
+			t_ThreadBuffer = Buffer.get();
+			m_ThreadBuffers.push_back(std::move(Buffer));
+		}
+		return *static_cast<FThreadBuffer*>(t_ThreadBuffer);
+	}
+
+	void FProfiler::BeginFrame()
+	{
+		const uint64_t FrameNumber = m_CurrentFrameStats.FrameNumber;
+		m_CurrentFrameStats = FFrameStats();
+		m_CurrentFrameStats.FrameNumber = FrameNumber;
+		m_FrameStartNs = GetTimeNs();
+	}
+
+	void FProfiler::EndFrame()
+	{
+		const uint64_t EndNs = GetTimeNs();
+		m_CurrentFrameStats.FrameMs = static_cast<double>(EndNs - m_FrameStartNs) * 1e-6;
+		RecordEvent("Frame", m_FrameStartNs, EndNs);
+
+		m_LastFrameStats = m_CurrentFrameStats;
+		++m_CurrentFrameStats.FrameNumber;
+	}
+
+	void FProfiler::AddPhaseTime(EFramePhase Phase, uint64_t DurationNs)
+	{
+		m_CurrentFrameStats.PhaseMs[static_cast<size_t>(Phase)] += static_cast<double>(DurationNs) * 1e-6;
+	}
+
+	bool FProfiler::ExportChromeTrace(const std::filesystem::path& FilePath) const
+	{
+		std::ofstream Stream(FilePath, std::ios::out | std::ios::trunc);
+		if (!Stream.is_open())
+		{
+			return false;
+		}
+
+		// the timestamps of the format are in microseconds
+		Stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		Stream.setf(std::ios::fixed);
+		Stream.precision(3);
+
+		bool bFirstEvent = true;
+		std::lock_guard<std::mutex> Lock(m_BuffersMutex);
+		for (const Scope<FThreadBuffer>& Buffer : m_ThreadBuffers)
+		{
+			const uint64_t WriteCount = Buffer->WriteCount.load(std::memory_order_acquire);
+			const uint64_t FirstEvent = WriteCount > EventsPerThread ? WriteCount - EventsPerThread : 0;
+			for (uint64_t EventIndex = FirstEvent; EventIndex < WriteCount; ++EventIndex)
+			{
+				const FProfileEvent& Event = Buffer->Events[EventIndex & (EventsPerThread - 1)];
+
+				Stream << (bFirstEvent ? "\n" : ",\n");
+				bFirstEvent = false;
+
+				Stream << "{\"name\":";
+				WriteJsonString(Stream, Event.Name);
+				Stream << ",\"cat\":\"ZeroUI\",\"ph\":\"X\""
+					<< ",\"ts\":" << static_cast<double>(Event.StartNs) * 1e-3
+					<< ",\"dur\":" << static_cast<double>(Event.EndNs - Event.StartNs) * 1e-3
+					<< ",\"pid\":1,\"tid\":" << Buffer->ThreadIndex << "}";
+			}
+		}
+
+		Stream << "\n]}\n";
+		return Stream.good();
+	}
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "Core.h"
+#include <atomic>
+#include <chrono>
+
+/* set ZERO_ENABLE_PROFILER to 0 to compile the markers out, the scopes then expand to nothing */
+#ifndef ZERO_ENABLE_PROFILER
+#define ZERO_ENABLE_PROFILER 1
+#endif
+
+namespace ZeroUI
+{
+	/* the phases of a slate frame, in execution order */
+	enum class EFramePhase : uint8_t
+	{
+		InputDrain,
+		Tick,
+		Prepass,
+		Arrange,
+		Paint,
+		Batch,
+		Present,
+		Num,
+	};
+
+	const char* GetFramePhaseName(EFramePhase Phase);
+
+	/* the time spent in every phase of a frame, in milliseconds */
+	struct FFrameStats
+	{
+		uint64_t FrameNumber = 0;
+
+		/* from BeginFrame to EndFrame */
+		double FrameMs = 0.0;
+
+		std::array<double, static_cast<size_t>(EFramePhase::Num)> PhaseMs{};
+
+		double GetPhaseMs(EFramePhase Phase) const { return PhaseMs[static_cast<size_t>(Phase)]; }
+
+		/* the phase that took the most time */
+		EFramePhase GetSlowestPhase() const;
+	};
+
+	/* a closed scope, the name must outlive the profiler(a literal or __FUNCTION__) */
+	struct FProfileEvent
+	{
+		const char* Name = nullptr;
+		uint64_t StartNs = 0;
+		uint64_t EndNs = 0;
+	};
+
+	/*
+	 * records the scopes of every thread in a thread local ring buffer, nothing is locked while recording
+	 * the oldest events are overwritten once a buffer is full, so the export always holds the last frames
+	 *
+	 * the frame stats are accumulated by the frame phase scopes of the game thread, between BeginFrame and EndFrame
+	 */
+	class FProfiler
+	{
+	public:
+		/* events kept per thread, a power of 2 */
+		static constexpr uint32_t EventsPerThread = 1 << 16;
+
+		static FProfiler& Get();
+
+		FProfiler();
+
+		FProfiler(const FProfiler&) = delete;
+		FProfiler& operator=(const FProfiler&) = delete;
+
+		/* nanoseconds since the creation of the profiler */
+		uint64_t GetTimeNs() const;
+
+		void SetEnabled(bool bInEnabled) { m_bEnabled.store(bInEnabled, std::memory_order_relaxed); }
+
+		bool IsEnabled() const { return m_bEnabled.load(std::memory_order_relaxed); }
+
+		/* push an event in the buffer of the calling thread */
+		void RecordEvent(const char* Name, uint64_t StartNs, uint64_t EndNs);
+
+		/* called by the game thread around a frame */
+		void BeginFrame();
+		void EndFrame();
+
+		/* accumulate time in a phase of the current frame, a phase can be entered several times per frame */
+		void AddPhaseTime(EFramePhase Phase, uint64_t DurationNs);
+
+		/* the stats of the last complete frame */
+		const FFrameStats& GetLastFrameStats() const { return m_LastFrameStats; }
+
+		/*
+		 * write the recorded events in the chrome trace event format, open it in chrome://tracing or ui.perfetto.dev
+		 * call it between two frames, an event that is recorded during the export can be torn
+		 */
+		bool ExportChromeTrace(const std::filesystem::path& FilePath) const;
+
+	private:
+		struct FThreadBuffer
+		{
+			uint32_t ThreadIndex = 0;
+
+			std::vector<FProfileEvent> Events;
+
+			/* total number of events written, the slot is WriteCount % EventsPerThread */
+			std::atomic<uint64_t> WriteCount = 0;
+		};
+
+		/* the buffer of the calling thread, registered on the first event */
+		FThreadBuffer& GetThreadBuffer();
+
+	private:
+		const std::chrono::steady_clock::time_point m_StartTime;
+
+		std::atomic<bool> m_bEnabled;
+
+		/* the buffers are never released, a thread can exit while its events still have to be exported */
+		mutable std::mutex m_BuffersMutex;
+		std::vector<Scope<FThreadBuffer>> m_ThreadBuffers;
+
+		uint64_t m_FrameStartNs = 0;
+		FFrameStats m_CurrentFrameStats;
+		FFrameStats m_LastFrameStats;
+	};
+
+	/* records the time spent between its construction and its destruction */
+	class FProfileScope
+	{
+	public:
+		explicit FProfileScope(const char* InName)
+			: m_Name(InName)
+			, m_StartNs(FProfiler::Get().GetTimeNs())
+		{
+		}
+
+		~FProfileScope()
+		{
+			FProfiler& Profiler = FProfiler::Get();
+			Profiler.RecordEvent(m_Name, m_StartNs, Profiler.GetTimeNs());
+		}
+
+	private:
+		const char* m_Name;
+		uint64_t m_StartNs;
+	};
+
+	/* a profile scope that also accumulates its time in the stats of the current frame */
+	class FFramePhaseScope
+	{
+	public:
+		explicit FFramePhaseScope(EFramePhase InPhase)
+			: m_Phase(InPhase)
+			, m_StartNs(FProfiler::Get().GetTimeNs())
+		{
+		}
+
+		~FFramePhaseScope()
+		{
+			FProfiler& Profiler = FProfiler::Get();
+			const uint64_t EndNs = Profiler.GetTimeNs();
+			Profiler.RecordEvent(GetFramePhaseName(m_Phase), m_StartNs, EndNs);
+			Profiler.AddPhaseTime(m_Phase, EndNs - m_StartNs);
+		}
+
+	private:
+		EFramePhase m_Phase;
+		uint64_t m_StartNs;
+	};
+}
+
+#define ZERO_PROFILE_CONCAT_INNER(A, B) A##B
+#define ZERO_PROFILE_CONCAT(A, B) ZERO_PROFILE_CONCAT_INNER(A, B)
+
+#if ZERO_ENABLE_PROFILER
+#define ZERO_PROFILE_SCOPE(Name)			::ZeroUI::FProfileScope ZERO_PROFILE_CONCAT(ProfileScope_, __LINE__)(Name)
+#define ZERO_PROFILE_FUNCTION()				ZERO_PROFILE_SCOPE(__FUNCTION__)
+#define ZERO_PROFILE_FRAME_PHASE(Phase)		::ZeroUI::FFramePhaseScope ZERO_PROFILE_CONCAT(FramePhaseScope_, __LINE__)(::ZeroUI::EFramePhase::Phase)
+#define ZERO_PROFILE_BEGIN_FRAME()			::ZeroUI::FProfiler::Get().BeginFrame()
+#define ZERO_PROFILE_END_FRAME()			::ZeroUI::FProfiler::Get().EndFrame()
+#else
+#define ZERO_PROFILE_SCOPE(Name)
+#define ZERO_PROFILE_FUNCTION()
+#define ZERO_PROFILE_FRAME_PHASE(Phase)
+#define ZERO_PROFILE_BEGIN_FRAME()
+#define ZERO_PROFILE_END_FRAME()
+#endif
@@ -0,0 +1,430 @@
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace ZeroUI
+{
+	namespace Utils
+	{
+		/*
+		 * allocation free version of StringUtils::Format, same placeholder syntax: {Index[,Alignment][:Format]}, {{ writes a {
+		 * the format string is parsed and checked at compile time, a wrong index or an unclosed placeholder doesn't compile.
+		 * the text is written in a buffer of the caller, it's truncated when the buffer is too small.
+		 *
+		 *   char Label[64];
+		 *   StringUtils::FormatTo(Label, "{0} fps, {1,8} ms", Fps, FrameMs);
+		 */
+		namespace StringUtils
+		{
+			/* writes in a buffer of the caller, never allocates */
+			class FFormatWriter
+			{
+			public:
+				FFormatWriter(char* InData, size_t InCapacity)
+					: m_Data(InData)
+					, m_Capacity(InCapacity)
+				{
+				}
+
+				void Append(const char* Text, size_t Length)
+				{
+					const size_t Copied = std::min(Length, m_Capacity - m_Length);
+					std::memcpy(m_Data + m_Length, Text, Copied);
+					m_Length += Copied;
+					m_bTruncated |= Copied < Length;
+				}
+
+				void Append(std::string_view Text) { Append(Text.data(), Text.size()); }
+
+				void Append(char Character) { Append(&Character, 1); }
+
+				/* the number of characters written since Start is padded to Width, on the left when bRightAligned */
+				void Pad(size_t Start, size_t Width, bool bRightAligned);
+
+				/* the free space of the buffer, to write in it directly */
+				char* GetEnd() const { return m_Data + m_Length; }
+				char* GetBufferEnd() const { return m_Data + m_Capacity; }
+				void Advance(size_t Count) { m_Length += Count; }
+
+				size_t Len() const { return m_Length; }
+
+				/* some of the text didn't fit in the buffer */
+				bool IsTruncated() const { return m_bTruncated; }
+
+			private:
+				char* m_Data;
+				size_t m_Capacity;
+				size_t m_Length = 0;
+				bool m_bTruncated = false;
+			};
+
+			inline void FFormatWriter::Pad(size_t Start, size_t Width, bool bRightAligned)
+			{
+				const size_t Written = m_Length - Start;
+				if (Written >= Width)
+				{
+					return;
+				}
+
+				const size_t Padding = std::min(Width - Written, m_Capacity - m_Length);
+				if (bRightAligned)
+				{
+					std::memmove(m_Data + Start + Padding, m_Data + Start, Written);
+					std::memset(m_Data + Start, ' ', Padding);
+				}
+				else
+				{
+					std::memset(m_Data + m_Length, ' ', Padding);
+				}
+				m_Length += Padding;
+				m_bTruncated |= Padding < Width - Written;
+			}
+
+			namespace FormatPrivate
+			{
+				template<typename T>
+				concept CStreamable = requires(std::ostream& Stream, const T& Value) { Stream << Value; };
+
+				/* the types that know how to format themselves, found by argument dependent lookup */
+				template<typename T>
+				concept CCustomFormattable = requires(FFormatWriter& Writer, const T& Value) { FormatArgument(Writer, Value); };
+
+				template<typename T>
+				void WriteChars(FFormatWriter& Writer, const T& Value, int32_t Base = 10)
+				{
+					// the biggest double in the general format fits
+					char Buffer[32];
+					std::to_chars_result Result;
+					if constexpr (std::is_floating_point_v<T>)
+					{
+						// the default precision of the streams, the text matches StringUtils::Format
+						Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), Value, std::chars_format::general, 6);
+					}
+					else
+					{
+						Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), Value, Base);
+					}
+					Writer.Append(Buffer, static_cast<size_t>(Result.ptr - Buffer));
+				}
+
+				/* the character types are written as characters by a stream, uint8_t included */
+				template<typename T>
+				concept CCharacter = std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>;
+
+				/* T is a decayed type, an array argument is written as the pointer to its first element */
+				template<typename T>
+				void WriteValue(FFormatWriter& Writer, const T& Argument)
+				{
+					if constexpr (std::is_same_v<T, bool>)
+					{
+						Writer.Append(Argument ? '1' : '0');
+					}
+					else if constexpr (CCharacter<T>)
+					{
+						Writer.Append(static_cast<char>(Argument));
+					}
+					else if constexpr (std::is_arithmetic_v<T>)
+					{
+						WriteChars(Writer, Argument);
+					}
+					else if constexpr (std::is_enum_v<T>)
+					{
+						WriteChars(Writer, static_cast<std::underlying_type_t<T>>(Argument));
+					}
+					else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+					{
+						Writer.Append(std::string_view(Argument));
+					}
+					else if constexpr (std::is_pointer_v<T>)
+					{
+						// same as a stream
+						Writer.Append("0x", 2);
+						WriteChars(Writer, reinterpret_cast<uintptr_t>(Argument), 16);
+					}
+					else if constexpr (CCustomFormattable<T>)
+					{
+						FormatArgument(Writer, Argument);
+					}
+					else
+					{
+						static_assert(CStreamable<T>, "the argument can't be formatted, add a FormatArgument(FFormatWriter&, const T&) overload");
+
+						// slow path, the type only has a stream operator
+						std::ostringstream Stream;
+						Stream << Argument;
+						Writer.Append(Stream.view());
+					}
+				}
+
+				/* Value points to the argument as it was passed, e.g. a string literal is a char array and not a pointer */
+				template<typename T>
+				void WriteArgument(FFormatWriter& Writer, const void* Value)
+				{
+					const T& Argument = *static_cast<const T*>(Value);
+					WriteValue<std::decay_t<const T&>>(Writer, Argument);
+				}
+
+				/* the arguments are erased to call them by index without allocating nor virtual calls */
+				struct FArgument
+				{
+					const void* Value;
+					void(*Write)(FFormatWriter& Writer, const void* Value);
+				};
+
+				/* called during the compile time parsing, the name of the function is the error */
+				void Error_FormatPlaceholderIsNotClosed();
+				void Error_FormatPlaceholderIndexIsMissing();
+				void Error_FormatPlaceholderIndexIsOutOfRange();
+				void Error_FormatAlignmentIsNotANumber();
+				void Error_FormatHasTooManyPlaceholders();
+
+				consteval bool IsDigit(char Character) { return Character >= '0' && Character <= '9'; }
+			}
+
+			/*
+			 * a format string parsed at compile time
+			 * it's a list of items: a part of the text followed by an optional argument
+			 */
+			template<typename... ArgTypes>
+			class TFormatString
+			{
+			public:
+				static constexpr uint32_t MaxItems = 16;
+
+				struct FItem
+				{
+					uint16_t TextStart = 0;
+					uint16_t TextLength = 0;
+
+					/* -1 when the item is only text */
+					int16_t ArgumentIndex = -1;
+
+					/* positive is right aligned, negative left aligned */
+					int16_t Alignment = 0;
+				};
+
+				template<size_t N>
+				consteval TFormatString(const char (&InFormat)[N])
+					: m_Format(InFormat)
+				{
+					Parse(std::string_view(InFormat, N - 1));
+				}
+
+				const char* GetFormat() const { return m_Format; }
+
+				uint32_t GetNumItems() const { return m_NumItems; }
+
+				const FItem& GetItem(uint32_t Index) const { return m_Items[Index]; }
+
+			private:
+				consteval void AddItem(size_t TextStart, size_t TextEnd, int32_t ArgumentIndex, int32_t Alignment)
+				{
+					if (m_NumItems == MaxItems)
+					{
+						FormatPrivate::Error_FormatHasTooManyPlaceholders();
+					}
+					m_Items[m_NumItems++] = FItem{ static_cast<uint16_t>(TextStart), static_cast<uint16_t>(TextEnd - TextStart), static_cast<int16_t>(ArgumentIndex), static_cast<int16_t>(Alignment) };
+				}
+
+				consteval void Parse(std::string_view Format)
+				{
+					// without argument the text is copied as it is, like StringUtils::Format
+					if constexpr (sizeof...(ArgTypes) == 0)
+					{
+						AddItem(0, Format.size(), -1, 0);
+						return;
+					}
+
+					size_t TextStart = 0;
+					size_t Position = 0;
+					while (Position < Format.size())
+					{
+						if (Format[Position] != '{')
+						{
+							++Position;
+							continue;
+						}
+
+						if (Position + 1 < Format.size() && Format[Position + 1] == '{')
+						{
+							// the text ends with the first {, the second one is skipped
+							AddItem(TextStart, Position + 1, -1, 0);
+							Position += 2;
+							TextStart = Position;
+							continue;
+						}
+
+						const size_t TextEnd = Position++;
+
+						int32_t ArgumentIndex = 0;
+						if (Position >= Format.size() || !FormatPrivate::IsDigit(Format[Position]))
+						{
+							FormatPrivate::Error_FormatPlaceholderIndexIsMissing();
+						}
+						while (Position < Format.size() && FormatPrivate::IsDigit(Format[Position]))
+						{
+							ArgumentIndex = ArgumentIndex * 10 + (Format[Position++] - '0');
+						}
+						if (ArgumentIndex >= static_cast<int32_t>(sizeof...(ArgTypes)))
+						{
+							FormatPrivate::Error_FormatPlaceholderIndexIsOutOfRange();
+						}
+
+						int32_t Alignment = 0;
+						if (Position < Format.size() && Format[Position] == ',')
+						{
+							++Position;
+							const bool bNegative = Position < Format.size() && Format[Position] == '-';
+							Position += bNegative ? 1 : 0;
+							if (Position >= Format.size() || !FormatPrivate::IsDigit(Format[Position]))
+							{
+								FormatPrivate::Error_FormatAlignmentIsNotANumber();
+							}
+							while (Position < Format.size() && FormatPrivate::IsDigit(Format[Position]))
+							{
+								Alignment = Alignment * 10 + (Format[Position++] - '0');
+							}
+							Alignment = bNegative ? -Alignment : Alignment;
+						}
+
+						// the format of the argument is accepted and ignored, like StringUtils::Format
+						while (Position < Format.size() && Format[Position] != '}')
+						{
+							++Position;
+						}
+						if (Position >= Format.size())
+						{
+							FormatPrivate::Error_FormatPlaceholderIsNotClosed();
+						}
+
+						AddItem(TextStart, TextEnd, ArgumentIndex, Alignment);
+						TextStart = ++Position;
+					}
+
+					if (TextStart < Format.size())
+					{
+						AddItem(TextStart, Format.size(), -1, 0);
+					}
+				}
+
+			private:
+				const char* m_Format;
+				uint32_t m_NumItems = 0;
+				FItem m_Items[MaxItems] = {};
+			};
+
+			/* the arguments are not deduced from the format string */
+			template<typename... ArgTypes>
+			using FormatString = TFormatString<std::type_identity_t<ArgTypes>...>;
+
+			namespace FormatPrivate
+			{
+				template<typename... ArgTypes>
+				void FormatItems(FFormatWriter& Writer, const TFormatString<ArgTypes...>& Format, const FArgument* Arguments)
+				{
+					for (uint32_t ItemIndex = 0; ItemIndex < Format.GetNumItems(); ++ItemIndex)
+					{
+						const auto& Item = Format.GetItem(ItemIndex);
+						Writer.Append(Format.GetFormat() + Item.TextStart, Item.TextLength);
+						if (Item.ArgumentIndex < 0)
+						{
+							continue;
+						}
+
+						const size_t ArgumentStart = Writer.Len();
+						const FArgument& Argument = Arguments[Item.ArgumentIndex];
+						Argument.Write(Writer, Argument.Value);
+						if (Item.Alignment != 0)
+						{
+							Writer.Pad(ArgumentStart, static_cast<size_t>(Item.Alignment > 0 ? Item.Alignment : -Item.Alignment), Item.Alignment > 0);
+						}
+					}
+				}
+			}
+
+			template<typename... ArgTypes>
+			void FormatTo(FFormatWriter& Writer, FormatString<ArgTypes...> Format, const ArgTypes&... Args)
+			{
+				if constexpr (sizeof...(ArgTypes) == 0)
+				{
+					FormatPrivate::FormatItems(Writer, Format, nullptr);
+				}
+				else
+				{
+					const FormatPrivate::FArgument Arguments[] = { FormatPrivate::FArgument{ &Args, &FormatPrivate::WriteArgument<ArgTypes> }... };
+					FormatPrivate::FormatItems(Writer, Format, Arguments);
+				}
+			}
+
+			/* write a null terminated text in the buffer, returns its length without the null character */
+			template<typename... ArgTypes>
+			size_t FormatTo(char* Buffer, size_t Capacity, FormatString<ArgTypes...> Format, const ArgTypes&... Args)
+			{
+				if (Capacity == 0)
+				{
+					return 0;
+				}
+
+				FFormatWriter Writer(Buffer, Capacity - 1);
+				FormatTo<ArgTypes...>(Writer, Format, Args...);
+				Buffer[Writer.Len()] = '\0';
+				return Writer.Len();
+			}
+
+			template<size_t N, typename... ArgTypes>
+			size_t FormatTo(char (&Buffer)[N], FormatString<ArgTypes...> Format, const ArgTypes&... Args)
+			{
+				return FormatTo<ArgTypes...>(Buffer, N, Format, Args...);
+			}
+
+			/*
+			 * replace the content of a string that is kept between frames, e.g. the text of a label
+			 * the string only allocates when the text is longer than all the previous ones
+			 */
+			template<typename... ArgTypes>
+			void FormatTo(std::string& Out, FormatString<ArgTypes...> Format, const ArgTypes&... Args)
+			{
+				for (;;)
+				{
+					Out.resize(Out.capacity());
+					FFormatWriter Writer(Out.data(), Out.size());
+					FormatTo<ArgTypes...>(Writer, Format, Args...);
+					if (!Writer.IsTruncated())
+					{
+						Out.resize(Writer.Len());
+						return;
+					}
+					Out.reserve(Out.capacity() * 2);
+				}
+			}
+
+			/* a text formatted in a buffer on the stack */
+			template<size_t N>
+			class TFormatBuffer
+			{
+			public:
+				template<typename... ArgTypes>
+				TFormatBuffer(FormatString<ArgTypes...> Format, const ArgTypes&... Args)
+				{
+					m_Length = FormatTo<ArgTypes...>(m_Data, N, Format, Args...);
+				}
+
+				const char* c_str() const { return m_Data; }
+
+				std::string_view View() const { return std::string_view(m_Data, m_Length); }
+
+				size_t Len() const { return m_Length; }
+
+			private:
+				char m_Data[N];
+				size_t m_Length;
+			};
+		}
+	}
+}
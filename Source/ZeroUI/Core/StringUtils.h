@@ -1,6 +1,8 @@
 #pragma once
 #include "Header.h"
+#ifdef _WIN32
 #include <direct.h>
+#endif
 #include <iostream>
 
 namespace ZeroUI
@@ -2,9 +2,12 @@
 #include <crossguid/guid.hpp>
 #include "Math/ZMath.h"
 #include "stdio.h"
-
-namespace ZeroUI
-{
+#include <cstring>
+#include <filesystem>
+#include <set>
+#include <string>
+#include <locale>
+#include <codecvt>
 
 #ifdef _WIN32
 #include <direct.h>		//for mkdir rmdir
@@ -15,6 +18,9 @@ namespace ZeroUI
 #include <dirent.h>		//for DIR remove
 #endif
 
+namespace ZeroUI
+{
+
 #ifdef _WIN32
 #define ACCESS _access
 #define MKDIR(a) _mkdir((a))
@@ -29,6 +35,7 @@ namespace ZeroUI
 	{
 		using namespace xg;
 
+#ifdef _WIN32
 		static inline std::string WString2String(const std::wstring& Input)
 		{
 			_bstr_t t = Input.c_str();
@@ -56,6 +63,17 @@ namespace ZeroUI
 
 			return wcstring;
 		}
+#else
+		static inline std::string WString2String(const std::wstring& Input)
+		{
+			return std::wstring_convert<std::codecvt_utf8<wchar_t>>().to_bytes(Input);
+		}
+
+		static inline std::wstring String2WString(const std::string& Input)
+		{
+			return std::wstring_convert<std::codecvt_utf8<wchar_t>>().from_bytes(Input);
+		}
+#endif
 		
 		static std::string GetShaderPath(const std::string& FileName)
 		{
@@ -144,7 +162,7 @@ namespace ZeroUI
 						stat(fileName.c_str(), &st);
 						if (S_ISDIR(st.st_mode))
 						{
-							RmDir(fileName);
+							RemoveDir(fileName);
 						}
 						else
 						{
@@ -9,13 +9,17 @@
 #include <functional>
 #include <new>
 #include <cmath>
+#include <cassert>
+#include <limits>
 
 #include <string>
 #include <sstream>
 #include <fstream>
 #include <iostream>
 #include <codecvt>
+#if defined(_WIN32)
 #include <comdef.h>
+#endif
 #include <mutex>
 #include <filesystem>
 #include <compare>
@@ -26,6 +30,7 @@
 #include <stack>
 #include <array>
 #include <deque>
+#include <list>
 #include <queue>
 #include <stdexcept>
 #include <unordered_map>
@@ -36,6 +41,8 @@
 #include "Core/Math/AABB.h"
 #include "Core/Math/Ray.h"
 
+#if defined(_WIN32)
 #include <Windows.h>
 #include <wincodec.h>
 #include <windowsx.h>
+#endif
@@ -0,0 +1,494 @@
+#include "InputRecording.h"
+#include "SlateApplication.h"
+#include "ApplicationCore/GenericPlatform/GenericApplication.h"
+#include "ApplicationCore/GenericPlatform/ICursor.h"
+#include "SlateCore/Widgets/SWindow.h"
+
+namespace ZeroUI
+{
+	namespace
+	{
+		constexpr uint8_t RecordingMagic[4] = { 'Z', 'U', 'I', 'R' };
+		constexpr uint8_t RecordingVersion = 1;
+
+		constexpr uint8_t RepeatFlag = 0x80;
+
+		void WriteVarInt(std::vector<uint8_t>& Data, uint64_t Value)
+		{
+			while (Value >= 0x80)
+			{
+				Data.push_back(static_cast<uint8_t>(Value) | 0x80);
+				Value >>= 7;
+			}
+			Data.push_back(static_cast<uint8_t>(Value));
+		}
+
+		/* the small negative values stay small, e.g. INDEX_NONE is a single byte */
+		void WriteSignedVarInt(std::vector<uint8_t>& Data, int32_t Value)
+		{
+			WriteVarInt(Data, (static_cast<uint32_t>(Value) << 1) ^ static_cast<uint32_t>(Value >> 31));
+		}
+
+		void WriteFloat(std::vector<uint8_t>& Data, float Value)
+		{
+			uint8_t Bytes[sizeof(float)];
+			std::memcpy(Bytes, &Value, sizeof(float));
+			Data.insert(Data.end(), Bytes, Bytes + sizeof(float));
+		}
+
+		class FRecordReader
+		{
+		public:
+			FRecordReader(const uint8_t* InData, size_t InSize)
+				: m_Data(InData)
+				, m_End(InData + InSize)
+				, m_bError(false)
+			{
+			}
+
+			bool IsAtEnd() const { return m_Data == m_End; }
+
+			bool HasError() const { return m_bError; }
+
+			uint8_t ReadByte()
+			{
+				if (m_Data == m_End)
+				{
+					m_bError = true;
+					return 0;
+				}
+				return *m_Data++;
+			}
+
+			uint64_t ReadVarInt()
+			{
+				uint64_t Value = 0;
+				for (uint32_t Shift = 0; Shift < 64; Shift += 7)
+				{
+					const uint8_t Byte = ReadByte();
+					Value |= static_cast<uint64_t>(Byte & 0x7F) << Shift;
+					if ((Byte & 0x80) == 0)
+					{
+						return Value;
+					}
+				}
+				m_bError = true;
+				return Value;
+			}
+
+			int32_t ReadSignedVarInt()
+			{
+				const uint32_t Value = static_cast<uint32_t>(ReadVarInt());
+				return static_cast<int32_t>((Value >> 1) ^ (~(Value & 1) + 1));
+			}
+
+			float ReadFloat()
+			{
+				if (static_cast<size_t>(m_End - m_Data) < sizeof(float))
+				{
+					m_bError = true;
+					m_Data = m_End;
+					return 0.0f;
+				}
+				float Value;
+				std::memcpy(&Value, m_Data, sizeof(float));
+				m_Data += sizeof(float);
+				return Value;
+			}
+
+		private:
+			const uint8_t* m_Data;
+			const uint8_t* m_End;
+			bool m_bError;
+		};
+	}
+
+	const char* GetInputRecordTypeName(EInputRecordType Type)
+	{
+		switch (Type)
+		{
+		case EInputRecordType::KeyChar:				return "KeyChar";
+		case EInputRecordType::KeyDown:				return "KeyDown";
+		case EInputRecordType::KeyUp:				return "KeyUp";
+		case EInputRecordType::MouseDown:			return "MouseDown";
+		case EInputRecordType::MouseUp:				return "MouseUp";
+		case EInputRecordType::MouseDoubleClick:	return "MouseDoubleClick";
+		case EInputRecordType::MouseWheel:			return "MouseWheel";
+		case EInputRecordType::MouseMove:			return "MouseMove";
+		case EInputRecordType::RawMouseMove:		return "RawMouseMove";
+		default:									return "Unknown";
+		}
+	}
+
+	void FInputRecording::Serialize(std::vector<uint8_t>& OutData) const
+	{
+		OutData.insert(OutData.end(), std::begin(RecordingMagic), std::end(RecordingMagic));
+		OutData.push_back(RecordingVersion);
+
+		uint64_t PreviousTimeNs = 0;
+		for (const FInputRecord& Record : m_Records)
+		{
+			WriteVarInt(OutData, Record.TimeNs - PreviousTimeNs);
+			PreviousTimeNs = Record.TimeNs;
+
+			OutData.push_back(static_cast<uint8_t>(Record.Type) | (Record.bIsRepeat ? RepeatFlag : 0));
+
+			switch (Record.Type)
+			{
+			case EInputRecordType::KeyChar:
+				WriteVarInt(OutData, Record.CharacterCode);
+				break;
+
+			case EInputRecordType::KeyDown:
+			case EInputRecordType::KeyUp:
+				WriteSignedVarInt(OutData, Record.KeyCode);
+				WriteVarInt(OutData, Record.CharacterCode);
+				break;
+
+			case EInputRecordType::MouseDown:
+			case EInputRecordType::MouseDoubleClick:
+				OutData.push_back(static_cast<uint8_t>(Record.Button));
+				WriteSignedVarInt(OutData, Record.WindowIndex);
+				WriteFloat(OutData, Record.Position.x);
+				WriteFloat(OutData, Record.Position.y);
+				break;
+
+			case EInputRecordType::MouseUp:
+				OutData.push_back(static_cast<uint8_t>(Record.Button));
+				WriteFloat(OutData, Record.Position.x);
+				WriteFloat(OutData, Record.Position.y);
+				break;
+
+			case EInputRecordType::MouseWheel:
+				WriteFloat(OutData, Record.WheelDelta);
+				WriteFloat(OutData, Record.Position.x);
+				WriteFloat(OutData, Record.Position.y);
+				break;
+
+			case EInputRecordType::MouseMove:
+				WriteFloat(OutData, Record.Position.x);
+				WriteFloat(OutData, Record.Position.y);
+				break;
+
+			case EInputRecordType::RawMouseMove:
+				WriteSignedVarInt(OutData, static_cast<int32_t>(Record.Position.x));
+				WriteSignedVarInt(OutData, static_cast<int32_t>(Record.Position.y));
+				break;
+
+			default:
+				assert(false && "unknown input record type");
+				break;
+			}
+		}
+	}
+
+	bool FInputRecording::Deserialize(const uint8_t* Data, size_t Size)
+	{
+		// the records replace the current ones, nothing is kept on an error
+		m_Records.clear();
+
+		if (Size < sizeof(RecordingMagic) + 1 || std::memcmp(Data, RecordingMagic, sizeof(RecordingMagic)) != 0)
+		{
+			CORE_LOG_ERROR("Not an input recording");
+			return false;
+		}
+
+		if (Data[sizeof(RecordingMagic)] != RecordingVersion)
+		{
+			CORE_LOG_ERROR("Unsupported input recording version {0}", Data[sizeof(RecordingMagic)]);
+			return false;
+		}
+
+		FRecordReader Reader(Data + sizeof(RecordingMagic) + 1, Size - sizeof(RecordingMagic) - 1);
+		std::vector<FInputRecord> Records;
+		uint64_t TimeNs = 0;
+		while (!Reader.IsAtEnd())
+		{
+			FInputRecord Record;
+			TimeNs += Reader.ReadVarInt();
+			Record.TimeNs = TimeNs;
+
+			const uint8_t TypeByte = Reader.ReadByte();
+			Record.Type = static_cast<EInputRecordType>(TypeByte & ~RepeatFlag);
+			Record.bIsRepeat = (TypeByte & RepeatFlag) != 0;
+
+			switch (Record.Type)
+			{
+			case EInputRecordType::KeyChar:
+				Record.CharacterCode = static_cast<uint32_t>(Reader.ReadVarInt());
+				break;
+
+			case EInputRecordType::KeyDown:
+			case EInputRecordType::KeyUp:
+				Record.KeyCode = Reader.ReadSignedVarInt();
+				Record.CharacterCode = static_cast<uint32_t>(Reader.ReadVarInt());
+				break;
+
+			case EInputRecordType::MouseDown:
+			case EInputRecordType::MouseDoubleClick:
+				Record.Button = static_cast<EMouseButtons::Type>(Reader.ReadByte());
+				Record.WindowIndex = Reader.ReadSignedVarInt();
+				Record.Position.x = Reader.ReadFloat();
+				Record.Position.y = Reader.ReadFloat();
+				break;
+
+			case EInputRecordType::MouseUp:
+				Record.Button = static_cast<EMouseButtons::Type>(Reader.ReadByte());
+				Record.Position.x = Reader.ReadFloat();
+				Record.Position.y = Reader.ReadFloat();
+				break;
+
+			case EInputRecordType::MouseWheel:
+				Record.WheelDelta = Reader.ReadFloat();
+				Record.Position.x = Reader.ReadFloat();
+				Record.Position.y = Reader.ReadFloat();
+				break;
+
+			case EInputRecordType::MouseMove:
+				Record.Position.x = Reader.ReadFloat();
+				Record.Position.y = Reader.ReadFloat();
+				break;
+
+			case EInputRecordType::RawMouseMove:
+				Record.Position.x = static_cast<float>(Reader.ReadSignedVarInt());
+				Record.Position.y = static_cast<float>(Reader.ReadSignedVarInt());
+				break;
+
+			default:
+				CORE_LOG_ERROR("Unknown input record type {0}", TypeByte & ~RepeatFlag);
+				return false;
+			}
+
+			if (Reader.HasError())
+			{
+				CORE_LOG_ERROR("Truncated input recording");
+				return false;
+			}
+			Records.push_back(Record);
+		}
+
+		m_Records = std::move(Records);
+		return true;
+	}
+
+	bool FInputRecording::SaveToFile(const std::filesystem::path& FilePath) const
+	{
+		std::vector<uint8_t> Data;
+		Serialize(Data);
+
+		std::ofstream File(FilePath, std::ios::binary);
+		if (!File)
+		{
+			CORE_LOG_ERROR("Can't write the input recording {0}", FilePath.string());
+			return false;
+		}
+		File.write(reinterpret_cast<const char*>(Data.data()), static_cast<std::streamsize>(Data.size()));
+		return static_cast<bool>(File);
+	}
+
+	bool FInputRecording::LoadFromFile(const std::filesystem::path& FilePath)
+	{
+		std::ifstream File(FilePath, std::ios::binary);
+		if (!File)
+		{
+			CORE_LOG_ERROR("Can't open the input recording {0}", FilePath.string());
+			return false;
+		}
+
+		const std::vector<uint8_t> Data((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+		return Deserialize(Data.data(), Data.size());
+	}
+
+	FInputRecorder::FInputRecorder(const Ref<GenericApplication>& InPlatformApplication, const Ref<FGenericApplicationMessageHandler>& InTargetHandler)
+		: m_PlatformApplication(InPlatformApplication)
+		, m_TargetHandler(InTargetHandler)
+		, m_StartTime(std::chrono::steady_clock::now())
+		, m_bRecording(false)
+	{
+		assert(m_TargetHandler);
+	}
+
+	void FInputRecorder::Start()
+	{
+		m_Recording.Empty();
+		m_StartTime = std::chrono::steady_clock::now();
+		m_bRecording = true;
+	}
+
+	FInputRecord FInputRecorder::MakeRecord(EInputRecordType Type) const
+	{
+		FInputRecord Record;
+		Record.TimeNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_StartTime).count());
+		Record.Type = Type;
+		return Record;
+	}
+
+	void FInputRecorder::AddRecord(const FInputRecord& InRecord)
+	{
+		if (m_bRecording)
+		{
+			m_Recording.Add(InRecord);
+		}
+	}
+
+	ZMath::vec2 FInputRecorder::GetCursorPosition() const
+	{
+		const Ref<GenericApplication> PlatformApplication = m_PlatformApplication.lock();
+		return PlatformApplication && PlatformApplication->m_Cursor ? PlatformApplication->m_Cursor->GetPosition() : ZMath::vec2(0.0f, 0.0f);
+	}
+
+	int32_t FInputRecorder::FindWindowIndex(const Ref< FGenericWindow >& Window)
+	{
+		if (!Window || !FSlateApplication::IsInitialized())
+		{
+			return INDEX_NONE;
+		}
+
+		const std::vector<Ref<SWindow>>& Windows = FSlateApplication::Get().GetWindows();
+		for (size_t WindowIndex = 0; WindowIndex < Windows.size(); ++WindowIndex)
+		{
+			if (Windows[WindowIndex]->GetNativeWindow() == Window)
+			{
+				return static_cast<int32_t>(WindowIndex);
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	bool FInputRecorder::ShouldProcessUserInputMessages(const Ref< FGenericWindow >& PlatformWindow) const
+	{
+		return m_TargetHandler->ShouldProcessUserInputMessages(PlatformWindow);
+	}
+
+	bool FInputRecorder::OnKeyChar(const TCHAR Character, const bool IsRepeat)
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::KeyChar);
+		Record.CharacterCode = static_cast<uint32_t>(Character);
+		Record.bIsRepeat = IsRepeat;
+		AddRecord(Record);
+		return m_TargetHandler->OnKeyChar(Character, IsRepeat);
+	}
+
+	bool FInputRecorder::OnKeyDown(const int32_t KeyCode, const uint32_t CharacterCode, const bool IsRepeat)
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::KeyDown);
+		Record.KeyCode = KeyCode;
+		Record.CharacterCode = CharacterCode;
+		Record.bIsRepeat = IsRepeat;
+		AddRecord(Record);
+		return m_TargetHandler->OnKeyDown(KeyCode, CharacterCode, IsRepeat);
+	}
+
+	bool FInputRecorder::OnKeyUp(const int32_t KeyCode, const uint32_t CharacterCode, const bool IsRepeat)
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::KeyUp);
+		Record.KeyCode = KeyCode;
+		Record.CharacterCode = CharacterCode;
+		Record.bIsRepeat = IsRepeat;
+		AddRecord(Record);
+		return m_TargetHandler->OnKeyUp(KeyCode, CharacterCode, IsRepeat);
+	}
+
+	void FInputRecorder::OnInputLanguageChanged()
+	{
+		m_TargetHandler->OnInputLanguageChanged();
+	}
+
+	// the messages without a cursor position are recorded with the position of the platform cursor, they are replayed with it
+	bool FInputRecorder::OnMouseDown(const Ref< FGenericWindow >& Window, const EMouseButtons::Type Button)
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::MouseDown);
+		Record.Button = Button;
+		Record.WindowIndex = FindWindowIndex(Window);
+		Record.Position = GetCursorPosition();
+		AddRecord(Record);
+		return m_TargetHandler->OnMouseDown(Window, Button);
+	}
+
+	bool FInputRecorder::OnMouseDown(const Ref< FGenericWindow >& Window, const EMouseButtons::Type Button, const ZMath::vec2 CursorPos)
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::MouseDown);
+		Record.Button = Button;
+		Record.WindowIndex = FindWindowIndex(Window);
+		Record.Position = CursorPos;
+		AddRecord(Record);
+		return m_TargetHandler->OnMouseDown(Window, Button, CursorPos);
+	}
+
+	bool FInputRecorder::OnMouseUp(const EMouseButtons::Type Button)
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::MouseUp);
+		Record.Button = Button;
+		Record.Position = GetCursorPosition();
+		AddRecord(Record);
+		return m_TargetHandler->OnMouseUp(Button);
+	}
+
+	bool FInputRecorder::OnMouseUp(const EMouseButtons::Type Button, const ZMath::vec2 CursorPos)
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::MouseUp);
+		Record.Button = Button;
+		Record.Position = CursorPos;
+		AddRecord(Record);
+		return m_TargetHandler->OnMouseUp(Button, CursorPos);
+	}
+
+	bool FInputRecorder::OnMouseDoubleClick(const Ref< FGenericWindow >& Window, const EMouseButtons::Type Button)
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::MouseDoubleClick);
+		Record.Button = Button;
+		Record.WindowIndex = FindWindowIndex(Window);
+		Record.Position = GetCursorPosition();
+		AddRecord(Record);
+		return m_TargetHandler->OnMouseDoubleClick(Window, Button);
+	}
+
+	bool FInputRecorder::OnMouseDoubleClick(const Ref< FGenericWindow >& Window, const EMouseButtons::Type Button, const ZMath::vec2 CursorPos)
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::MouseDoubleClick);
+		Record.Button = Button;
+		Record.WindowIndex = FindWindowIndex(Window);
+		Record.Position = CursorPos;
+		AddRecord(Record);
+		return m_TargetHandler->OnMouseDoubleClick(Window, Button, CursorPos);
+	}
+
+	bool FInputRecorder::OnMouseWheel(const float Delta)
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::MouseWheel);
+		Record.WheelDelta = Delta;
+		Record.Position = GetCursorPosition();
+		AddRecord(Record);
+		return m_TargetHandler->OnMouseWheel(Delta);
+	}
+
+	bool FInputRecorder::OnMouseWheel(const float Delta, const ZMath::vec2 CursorPos)
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::MouseWheel);
+		Record.WheelDelta = Delta;
+		Record.Position = CursorPos;
+		AddRecord(Record);
+		return m_TargetHandler->OnMouseWheel(Delta, CursorPos);
+	}
+
+	bool FInputRecorder::OnMouseMove()
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::MouseMove);
+		Record.Position = GetCursorPosition();
+		AddRecord(Record);
+		return m_TargetHandler->OnMouseMove();
+	}
+
+	bool FInputRecorder::OnRawMouseMove(const int32_t X, const int32_t Y)
+	{
+		FInputRecord Record = MakeRecord(EInputRecordType::RawMouseMove);
+		Record.Position = ZMath::vec2(static_cast<float>(X), static_cast<float>(Y));
+		AddRecord(Record);
+		return m_TargetHandler->OnRawMouseMove(X, Y);
+	}
+
+	bool FInputRecorder::OnCursorSet()
+	{
+		return m_TargetHandler->OnCursorSet();
+	}
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Core.h"
+#include "ApplicationCore/GenericPlatform/GenericApplicationMessageHandler.h"
+#include <chrono>
+
+namespace ZeroUI
+{
+	class GenericApplication;
+
+	/** The messages of FGenericApplicationMessageHandler that are recorded */
+	enum class EInputRecordType : uint8_t
+	{
+		KeyChar,
+		KeyDown,
+		KeyUp,
+		MouseDown,
+		MouseUp,
+		MouseDoubleClick,
+		MouseWheel,
+		MouseMove,
+		RawMouseMove,
+		Num,
+	};
+
+	const char* GetInputRecordTypeName(EInputRecordType Type);
+
+	/** A recorded message, only the members used by its type are set */
+	struct FInputRecord
+	{
+		/** Nanoseconds since the start of the recording */
+		uint64_t TimeNs = 0;
+
+		EInputRecordType Type = EInputRecordType::MouseMove;
+
+		bool bIsRepeat = false;
+
+		EMouseButtons::Type Button = EMouseButtons::Invalid;
+
+		/** The index of the window in FSlateApplication::GetWindows, INDEX_NONE for no window */
+		int32_t WindowIndex = INDEX_NONE;
+
+		int32_t KeyCode = 0;
+
+		uint32_t CharacterCode = 0;
+
+		/** The cursor position of the mouse messages, the delta of a raw mouse move */
+		ZMath::vec2 Position = ZMath::vec2(0.0f, 0.0f);
+
+		float WheelDelta = 0.0f;
+	};
+
+	/**
+	 * The input messages of a session.
+	 *
+	 * The binary stream starts with a header, then every record is its time as a varint delta from the previous record,
+	 * a byte for the type and the repeat flag, and only the members of its type, e.g. the two floats of a mouse move.
+	 */
+	class FInputRecording
+	{
+	public:
+
+		void Add(const FInputRecord& Record) { m_Records.push_back(Record); }
+
+		const std::vector<FInputRecord>& GetRecords() const { return m_Records; }
+
+		void Empty() { m_Records.clear(); }
+
+		/** @return The time of the last record, in nanoseconds. */
+		uint64_t GetDurationNs() const { return m_Records.empty() ? 0 : m_Records.back().TimeNs; }
+
+		void Serialize(std::vector<uint8_t>& OutData) const;
+
+		/** Replaces the records. @return false if the data is not a recording or is truncated, the recording is empty then. */
+		bool Deserialize(const uint8_t* Data, size_t Size);
+
+		bool SaveToFile(const std::filesystem::path& FilePath) const;
+
+		bool LoadFromFile(const std::filesystem::path& FilePath);
+
+	private:
+
+		std::vector<FInputRecord> m_Records;
+	};
+
+	/**
+	 * Records the messages sent by the platform application, then forwards them to the handler it wraps.
+	 *
+	 *		Ref<FInputRecorder> Recorder = CreateRef<FInputRecorder>(Platform, Platform->GetMessageHandler());
+	 *		Platform->SetMessageHandler(Recorder);
+	 *		Recorder->Start();
+	 *
+	 * The windows are recorded as their index in FSlateApplication::GetWindows, a replayed session has to create its
+	 * windows in the same order.
+	 */
+	class FInputRecorder : public FGenericApplicationMessageHandler
+	{
+	public:
+
+		FInputRecorder(const Ref<GenericApplication>& InPlatformApplication, const Ref<FGenericApplicationMessageHandler>& InTargetHandler);
+
+		/** Starts a new recording, the time of the records is relative to this call. */
+		void Start();
+
+		void Stop() { m_bRecording = false; }
+
+		bool IsRecording() const { return m_bRecording; }
+
+		const FInputRecording& GetRecording() const { return m_Recording; }
+
+	public:
+		virtual bool ShouldProcessUserInputMessages(const Ref< FGenericWindow >& PlatformWindow) const override;
+		virtual bool OnKeyChar(const TCHAR Character, const bool IsRepeat) override;
+		virtual bool OnKeyDown(const int32_t KeyCode, const uint32_t CharacterCode, const bool IsRepeat) override;
+		virtual bool OnKeyUp(const int32_t KeyCode, const uint32_t CharacterCode, const bool IsRepeat) override;
+		virtual void OnInputLanguageChanged() override;
+		virtual bool OnMouseDown(const Ref< FGenericWindow >& Window, const EMouseButtons::Type Button) override;
+		virtual bool OnMouseDown(const Ref< FGenericWindow >& Window, const EMouseButtons::Type Button, const ZMath::vec2 CursorPos) override;
+		virtual bool OnMouseUp(const EMouseButtons::Type Button) override;
+		virtual bool OnMouseUp(const EMouseButtons::Type Button, const ZMath::vec2 CursorPos) override;
+		virtual bool OnMouseDoubleClick(const Ref< FGenericWindow >& Window, const EMouseButtons::Type Button) override;
+		virtual bool OnMouseDoubleClick(const Ref< FGenericWindow >& Window, const EMouseButtons::Type Button, const ZMath::vec2 CursorPos) override;
+		virtual bool OnMouseWheel(const float Delta) override;
+		virtual bool OnMouseWheel(const float Delta, const ZMath::vec2 CursorPos) override;
+		virtual bool OnMouseMove() override;
+		virtual bool OnRawMouseMove(const int32_t X, const int32_t Y) override;
+		virtual bool OnCursorSet() override;
+
+	private:
+
+		/** @return A record of the type at the current time. */
+		FInputRecord MakeRecord(EInputRecordType Type) const;
+
+		void AddRecord(const FInputRecord& InRecord);
+
+		/** @return The cursor position of the platform application. */
+		ZMath::vec2 GetCursorPosition() const;
+
+		static int32_t FindWindowIndex(const Ref< FGenericWindow >& Window);
+
+	private:
+
+		/** Weak, the platform application owns the recorder once it's its message handler */
+		Weak<GenericApplication> m_PlatformApplication;
+
+		Ref<FGenericApplicationMessageHandler> m_TargetHandler;
+
+		FInputRecording m_Recording;
+
+		std::chrono::steady_clock::time_point m_StartTime;
+
+		bool m_bRecording;
+	};
+}
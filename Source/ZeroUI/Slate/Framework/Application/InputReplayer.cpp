@@ -0,0 +1,156 @@
+#include "InputReplayer.h"
+#include "SlateApplication.h"
+#include "ApplicationCore/GenericPlatform/GenericApplication.h"
+#include "ApplicationCore/GenericPlatform/ICursor.h"
+#include "Core/Profiling/Profiler.h"
+#include "SlateCore/Widgets/SWindow.h"
+#include <sstream>
+#include <thread>
+
+namespace ZeroUI
+{
+	namespace
+	{
+		std::string FormatLatencyReport(const FInputReplayStats& Stats)
+		{
+			std::ostringstream Stream;
+			Stream.setf(std::ios::fixed);
+			Stream.precision(3);
+
+			Stream << "MessageType, Count, P50Ms, P99Ms, P999Ms\n";
+			for (size_t TypeIndex = 0; TypeIndex < Stats.Latencies.size(); ++TypeIndex)
+			{
+				const FLatencyHistogram& Latency = Stats.Latencies[TypeIndex];
+				if (Latency.Num() == 0)
+				{
+					continue;
+				}
+
+				Stream << GetInputRecordTypeName(static_cast<EInputRecordType>(TypeIndex))
+					<< ", " << Latency.Num()
+					<< ", " << Latency.GetPercentileNs(50.0) / 1e6
+					<< ", " << Latency.GetPercentileNs(99.0) / 1e6
+					<< ", " << Latency.GetPercentileNs(99.9) / 1e6
+					<< "\n";
+			}
+			return Stream.str();
+		}
+	}
+
+	void FInputReplayStats::Log() const
+	{
+		CORE_LOG_INFO("Input replay, {0} frames in {1:.3f} s, input to paint latency:\n{2}", NumFrames, WallTimeSeconds, FormatLatencyReport(*this));
+	}
+
+	FInputReplayer::FInputReplayer(const FInputRecording& InRecording, EInputReplaySpeed InSpeed, double InFrameDeltaTime)
+		: m_Recording(InRecording)
+		, m_Speed(InSpeed)
+		, m_FrameDeltaTime(InFrameDeltaTime)
+	{
+		assert(m_FrameDeltaTime > 0.0);
+	}
+
+	FInputReplayStats FInputReplayer::Run(FSlateApplication& Application)
+	{
+		FInputReplayStats Stats;
+
+		const std::vector<FInputRecord>& Records = m_Recording.GetRecords();
+		const uint64_t FrameDeltaNs = static_cast<uint64_t>(m_FrameDeltaTime * 1e9);
+		const std::chrono::steady_clock::time_point StartTime = std::chrono::steady_clock::now();
+
+		/* the messages sent before the tick of the frame, they are painted by it */
+		std::vector<std::pair<EInputRecordType, uint64_t>> Dispatched;
+
+		size_t NextRecord = 0;
+		while (NextRecord < Records.size())
+		{
+			const uint64_t ReplayTimeNs = m_Speed == EInputReplaySpeed::OriginalTiming
+				? static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - StartTime).count())
+				: Stats.NumFrames * FrameDeltaNs;
+
+			Dispatched.clear();
+			for (; NextRecord < Records.size() && Records[NextRecord].TimeNs <= ReplayTimeNs; ++NextRecord)
+			{
+				Dispatched.emplace_back(Records[NextRecord].Type, FProfiler::Get().GetTimeNs());
+				Dispatch(Application, Records[NextRecord]);
+			}
+
+			Application.Tick();
+			++Stats.NumFrames;
+
+			const uint64_t PaintTimeNs = Application.GetLastPaintTimeNs();
+			for (const auto& [Type, DispatchTimeNs] : Dispatched)
+			{
+				Stats.Latencies[static_cast<size_t>(Type)].Add(PaintTimeNs > DispatchTimeNs ? PaintTimeNs - DispatchTimeNs : 0);
+			}
+
+			if (m_Speed == EInputReplaySpeed::OriginalTiming)
+			{
+				std::this_thread::sleep_until(StartTime + std::chrono::nanoseconds(Stats.NumFrames * FrameDeltaNs));
+			}
+		}
+
+		Stats.WallTimeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+		return Stats;
+	}
+
+	void FInputReplayer::Dispatch(FSlateApplication& Application, const FInputRecord& Record)
+	{
+		const std::vector<Ref<SWindow>>& Windows = Application.GetWindows();
+		const Ref<FGenericWindow> Window = Record.WindowIndex >= 0 && Record.WindowIndex < static_cast<int32_t>(Windows.size())
+			? Windows[Record.WindowIndex]->GetNativeWindow()
+			: nullptr;
+
+		FGenericApplicationMessageHandler& MessageHandler = Application;
+		switch (Record.Type)
+		{
+		case EInputRecordType::KeyChar:
+			MessageHandler.OnKeyChar(static_cast<TCHAR>(Record.CharacterCode), Record.bIsRepeat);
+			break;
+
+		case EInputRecordType::KeyDown:
+			MessageHandler.OnKeyDown(Record.KeyCode, Record.CharacterCode, Record.bIsRepeat);
+			break;
+
+		case EInputRecordType::KeyUp:
+			MessageHandler.OnKeyUp(Record.KeyCode, Record.CharacterCode, Record.bIsRepeat);
+			break;
+
+		case EInputRecordType::MouseDown:
+			MessageHandler.OnMouseDown(Window, Record.Button, Record.Position);
+			break;
+
+		case EInputRecordType::MouseUp:
+			MessageHandler.OnMouseUp(Record.Button, Record.Position);
+			break;
+
+		case EInputRecordType::MouseDoubleClick:
+			MessageHandler.OnMouseDoubleClick(Window, Record.Button, Record.Position);
+			break;
+
+		case EInputRecordType::MouseWheel:
+			MessageHandler.OnMouseWheel(Record.WheelDelta, Record.Position);
+			break;
+
+		case EInputRecordType::MouseMove:
+		{
+			/* the mouse move message has no position, the handler reads the cursor */
+			const Ref<GenericApplication>& PlatformApplication = Application.GetPlatformApplication();
+			if (PlatformApplication && PlatformApplication->m_Cursor)
+			{
+				PlatformApplication->m_Cursor->SetPosition(static_cast<int32_t>(Record.Position.x), static_cast<int32_t>(Record.Position.y));
+			}
+			MessageHandler.OnMouseMove();
+			break;
+		}
+
+		case EInputRecordType::RawMouseMove:
+			MessageHandler.OnRawMouseMove(static_cast<int32_t>(Record.Position.x), static_cast<int32_t>(Record.Position.y));
+			break;
+
+		default:
+			assert(false && "unknown input record type");
+			break;
+		}
+	}
+}
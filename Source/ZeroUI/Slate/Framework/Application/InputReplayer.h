@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Core.h"
+#include "Core/Profiling/LatencyHistogram.h"
+#include "InputRecording.h"
+
+namespace ZeroUI
+{
+	class FSlateApplication;
+
+	enum class EInputReplaySpeed : uint8_t
+	{
+		/** The messages are sent at their recorded time, the frames run at the frame rate */
+		OriginalTiming,
+
+		/** The frames run back to back, every frame advances the recording time by the frame delta time */
+		AsFastAsPossible,
+	};
+
+	/** The results of a replay */
+	struct FInputReplayStats
+	{
+		/** The time from the dispatch of a message to the end of the paint of the frame that handled it, per message type */
+		std::array<FLatencyHistogram, static_cast<size_t>(EInputRecordType::Num)> Latencies;
+
+		uint64_t NumFrames = 0;
+
+		double WallTimeSeconds = 0.0;
+
+		const FLatencyHistogram& GetLatency(EInputRecordType Type) const { return Latencies[static_cast<size_t>(Type)]; }
+
+		/** Logs the p50, p99 and p999 latencies of every message type that was replayed. */
+		void Log() const;
+	};
+
+	/**
+	 * Sends the messages of a recording to the application, as the platform application would have, and measures the
+	 * input to paint latency of every message.
+	 *
+	 * The replay is deterministic when the platform application is a FNullApplication without an input script, its
+	 * virtual clock makes the frames of the replay see the same delta times whatever the speed:
+	 *
+	 *		FInputReplayer Replayer(Recording, EInputReplaySpeed::AsFastAsPossible);
+	 *		FInputReplayStats Stats = Replayer.Run(FSlateApplication::Get());
+	 *		Stats.Log();
+	 */
+	class FInputReplayer
+	{
+	public:
+
+		FInputReplayer(const FInputRecording& InRecording, EInputReplaySpeed InSpeed, double InFrameDeltaTime = 1.0 / 60.0);
+
+		/** Ticks the application until every message was sent and painted. */
+		FInputReplayStats Run(FSlateApplication& Application);
+
+	private:
+
+		/** Sends a record to the application, as its message handler. */
+		static void Dispatch(FSlateApplication& Application, const FInputRecord& Record);
+
+	private:
+
+		const FInputRecording& m_Recording;
+
+		EInputReplaySpeed m_Speed;
+
+		double m_FrameDeltaTime;
+	};
+}
@@ -1,7 +1,409 @@
 #include "SlateApplication.h"
+#include "ApplicationCore/GenericPlatform/GenericApplication.h"
+#include "ApplicationCore/GenericPlatform/GenericWindow.h"
+#include "ApplicationCore/GenericPlatform/GenericWindowDefinition.h"
+#include "ApplicationCore/GenericPlatform/ICursor.h"
+#include "Core/Profiling/Profiler.h"
+#include "SlateCore/Debugging/SlateInvalidationTrace.h"
+#include "SlateCore/Input/Events.h"
+#include "SlateCore/Layout/ParallelLayout.h"
+#include "SlateCore/Rendering/SlateRenderer.h"
+#include "SlateCore/Textures/SlateAsyncImageLoader.h"
+#include "SlateCore/Widgets/SWindow.h"
+
 namespace ZeroUI
 {
+	namespace
+	{
+		/** Sends the event to the widgets of the path, from the last one up to the window, until one of them handles it. */
+		template<typename HandlerType>
+		bool BubbleEvent(const FWidgetPath& Path, HandlerType&& Handler)
+		{
+			for (int32_t Index = Path.Widgets.Num() - 1; Index >= 0; --Index)
+			{
+				const FArrangedWidget& ArrangedWidget = Path.Widgets[Index];
+				if (Handler(*ArrangedWidget.GetWidgetPtr(), ArrangedWidget.GetGeometry()))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+	}
+
+	Ref<FSlateApplication> FSlateApplication::s_CurrentApplication = nullptr;
+
+	FSlateApplication& FSlateApplication::Create(const Ref<GenericApplication>& InPlatformApplication)
+	{
+		assert(!IsInitialized());
+		s_CurrentApplication = Ref<FSlateApplication>(new FSlateApplication());
+		s_CurrentApplication->m_PlatformApplication = InPlatformApplication;
+		s_CurrentApplication->m_LastVirtualTime = InPlatformApplication->GetVirtualTime();
+		InPlatformApplication->SetMessageHandler(s_CurrentApplication);
+		return *s_CurrentApplication;
+	}
+
+	FSlateApplication& FSlateApplication::Get()
+	{
+		assert(IsInitialized());
+		return *s_CurrentApplication;
+	}
+
+	void FSlateApplication::Shutdown()
+	{
+		if (IsInitialized())
+		{
+			s_CurrentApplication->m_Windows.clear();
+			s_CurrentApplication.reset();
+		}
+	}
+
+	FSlateApplication::FSlateApplication()
+		: m_CurrentTime(0.0)
+		, m_LastTickTime(std::chrono::steady_clock::now())
+		, m_LastVirtualTime(0.0)
+		, m_DeltaTime(0.0f)
+		, m_LastPaintTimeNs(0)
+		, m_LastCursorPosition(0.0f, 0.0f)
+	{
+	}
+
 	FSlateApplication::~FSlateApplication()
 	{
 	}
-}
\ No newline at end of file
+
+	void FSlateApplication::AddWindow(const Ref<SWindow>& InWindow, bool bShowImmediately)
+	{
+		if (!InWindow->GetNativeWindow() && m_PlatformApplication)
+		{
+			Ref<FGenericWindowDefinition> Definition = CreateRef<FGenericWindowDefinition>();
+			Definition->Type = EWindowType::Normal;
+			Definition->XDesiredPositionOnScreen = 0.0f;
+			Definition->YDesiredPositionOnScreen = 0.0f;
+			Definition->WidthDesiredOnScreen = InWindow->GetSizeInScreen().x;
+			Definition->HeightDesiredOnScreen = InWindow->GetSizeInScreen().y;
+
+			Ref<FGenericWindow> NativeWindow = m_PlatformApplication->MakeWindow();
+			m_PlatformApplication->InitializeWindow(NativeWindow, Definition, nullptr, bShowImmediately);
+			InWindow->SetNativeWindow(NativeWindow);
+		}
+
+		m_Windows.push_back(InWindow);
+	}
+
+	void FSlateApplication::RemoveWindow(const Ref<SWindow>& InWindow)
+	{
+		m_Windows.erase(std::remove(m_Windows.begin(), m_Windows.end(), InWindow), m_Windows.end());
+		m_WindowsToPaint.erase(std::remove(m_WindowsToPaint.begin(), m_WindowsToPaint.end(), InWindow), m_WindowsToPaint.end());
+		m_FrameScheduler.RemoveWindow(*InWindow);
+
+		// the weak paths let the window go, the arranged ones hold its widgets
+		if (m_FocusWidgetPath.GetWindow() == InWindow)
+		{
+			m_FocusWidgetPath.Empty();
+		}
+		if (m_PointerWidgetPath.GetWindow() == InWindow)
+		{
+			m_PointerWidgetPath.Empty();
+		}
+	}
+
+	void FSlateApplication::SetKeyboardFocus(const FWidgetPath& InFocusPath)
+	{
+		m_FocusPath = FWeakWidgetPath(InFocusPath);
+		m_FocusWidgetPath.Empty();
+	}
+
+	void FSlateApplication::ClearKeyboardFocus()
+	{
+		m_FocusPath.Empty();
+		m_FocusWidgetPath.Empty();
+	}
+
+	Ref<SWindow> FSlateApplication::FindWindow(const Ref<FGenericWindow>& InNativeWindow) const
+	{
+		for (const Ref<SWindow>& Window : m_Windows)
+		{
+			if (Window->GetNativeWindow() == InNativeWindow)
+			{
+				return Window;
+			}
+		}
+		return nullptr;
+	}
+
+	FModifierKeysState FSlateApplication::GetModifierKeys() const
+	{
+		return m_PlatformApplication ? m_PlatformApplication->GetModifierKeys() : FModifierKeysState();
+	}
+
+	template<typename HandlerType>
+	bool FSlateApplication::RouteKeyEvent(FKeyEvent& InKeyEvent, HandlerType&& Handler)
+	{
+		// an unchanged path is only revalidated, it's looked up again when the window was arranged since the last event
+		if (!m_FocusPath.UpdateWidgetPath(m_FocusWidgetPath))
+		{
+			return false;
+		}
+
+		InKeyEvent.SetEventPath(m_FocusWidgetPath);
+		return BubbleEvent(m_FocusWidgetPath, [&InKeyEvent, &Handler](SWidget& Widget, const FGeometry& Geometry)
+		{
+			return Handler(Widget, Geometry, InKeyEvent);
+		});
+	}
+
+	bool FSlateApplication::OnKeyChar(const TCHAR Character, const bool IsRepeat)
+	{
+		FKeyEvent CharacterEvent(EKeys::Invalid, GetModifierKeys(), 0, IsRepeat, static_cast<uint32_t>(Character), 0);
+		return RouteKeyEvent(CharacterEvent, [](SWidget& Widget, const FGeometry& Geometry, const FKeyEvent& Event)
+		{
+			return Widget.OnKeyChar(Geometry, Event);
+		});
+	}
+
+	FKey FSlateApplication::TranslateKeyCodeToKey(const int32_t KeyCode, const uint32_t CharacterCode) const
+	{
+		const FKey Key = m_PlatformApplication ? m_PlatformApplication->GetKeyFromCodes(KeyCode, CharacterCode) : EKeys::Invalid;
+		return Key.IsValid() ? Key : TranslateCharacterCodeToKey(CharacterCode);
+	}
+
+	bool FSlateApplication::OnKeyDown(const int32_t KeyCode, const uint32_t CharacterCode, const bool IsRepeat)
+	{
+		FKeyEvent KeyEvent(TranslateKeyCodeToKey(KeyCode, CharacterCode), GetModifierKeys(), 0, IsRepeat, CharacterCode, static_cast<uint32_t>(KeyCode));
+		return RouteKeyEvent(KeyEvent, [](SWidget& Widget, const FGeometry& Geometry, const FKeyEvent& Event)
+		{
+			return Widget.OnKeyDown(Geometry, Event);
+		});
+	}
+
+	bool FSlateApplication::OnKeyUp(const int32_t KeyCode, const uint32_t CharacterCode, const bool IsRepeat)
+	{
+		FKeyEvent KeyEvent(TranslateKeyCodeToKey(KeyCode, CharacterCode), GetModifierKeys(), 0, IsRepeat, CharacterCode, static_cast<uint32_t>(KeyCode));
+		return RouteKeyEvent(KeyEvent, [](SWidget& Widget, const FGeometry& Geometry, const FKeyEvent& Event)
+		{
+			return Widget.OnKeyUp(Geometry, Event);
+		});
+	}
+
+	bool FSlateApplication::OnMouseDown(const Ref< FGenericWindow >& Window, const EMouseButtons::Type Button)
+	{
+		return OnMouseDown(Window, Button, m_LastCursorPosition);
+	}
+
+	bool FSlateApplication::OnMouseDown(const Ref< FGenericWindow >& Window, const EMouseButtons::Type Button, const ZMath::vec2 CursorPos)
+	{
+		const ZMath::vec2 LastCursorPosition = m_LastCursorPosition;
+		m_LastCursorPosition = CursorPos;
+
+		const FKey ButtonKey = TranslateMouseButtonToKey(Button);
+		m_PressedMouseButtons.Add(ButtonKey);
+
+		const Ref<SWindow> SlateWindow = FindWindow(Window);
+		if (!SlateWindow)
+		{
+			return false;
+		}
+
+		// the hit test is done on the arranged widgets of the last frame, the widgets the user sees
+		const FArrangedWidgetTree& Tree = SlateWindow->GetArrangedWidgets();
+		const int32_t HitIndex = Tree.HitTest(CursorPos);
+		if (HitIndex == INDEX_NONE)
+		{
+			return false;
+		}
+
+		const FWidgetPath WidgetPath(SlateWindow, Tree, HitIndex);
+		FPointerEvent MouseEvent(0, CursorPos, LastCursorPosition, m_PressedMouseButtons, ButtonKey, 0.0f, GetModifierKeys());
+		MouseEvent.SetEventPath(WidgetPath);
+		const bool bHandled = BubbleEvent(WidgetPath, [&MouseEvent](SWidget& Widget, const FGeometry& Geometry)
+		{
+			return Widget.OnMouseButtonDown(Geometry, MouseEvent);
+		});
+
+		// the deepest focusable widget under the cursor takes the focus
+		for (int32_t Index = WidgetPath.Widgets.Num() - 1; Index >= 0; --Index)
+		{
+			const SWidget* Widget = WidgetPath.Widgets[Index].GetWidgetPtr();
+			if (Widget->SupportsKeyboardFocus())
+			{
+				SetKeyboardFocus(WidgetPath.GetPathDownTo(Widget));
+				break;
+			}
+		}
+
+		m_PointerPath = FWeakWidgetPath(WidgetPath);
+		m_PointerWidgetPath.Empty();
+		return bHandled;
+	}
+
+	bool FSlateApplication::OnMouseUp(const EMouseButtons::Type Button)
+	{
+		return OnMouseUp(Button, m_LastCursorPosition);
+	}
+
+	bool FSlateApplication::OnMouseUp(const EMouseButtons::Type Button, const ZMath::vec2 CursorPos)
+	{
+		const ZMath::vec2 LastCursorPosition = m_LastCursorPosition;
+		m_LastCursorPosition = CursorPos;
+
+		const FKey ButtonKey = TranslateMouseButtonToKey(Button);
+		m_PressedMouseButtons.Remove(ButtonKey);
+
+		// the widgets that got the mouse down get the mouse up, even when the cursor left them
+		bool bHandled = false;
+		if (m_PointerPath.UpdateWidgetPath(m_PointerWidgetPath))
+		{
+			FPointerEvent MouseEvent(0, CursorPos, LastCursorPosition, m_PressedMouseButtons, ButtonKey, 0.0f, GetModifierKeys());
+			MouseEvent.SetEventPath(m_PointerWidgetPath);
+			bHandled = BubbleEvent(m_PointerWidgetPath, [&MouseEvent](SWidget& Widget, const FGeometry& Geometry)
+			{
+				return Widget.OnMouseButtonUp(Geometry, MouseEvent);
+			});
+		}
+
+		if (m_PressedMouseButtons.IsEmpty())
+		{
+			m_PointerPath.Empty();
+			m_PointerWidgetPath.Empty();
+		}
+		return bHandled;
+	}
+
+	bool FSlateApplication::OnMouseMove()
+	{
+		// the platform only signals the move, the position is read from its cursor for the events that don't have one
+		if (m_PlatformApplication && m_PlatformApplication->m_Cursor)
+		{
+			m_LastCursorPosition = m_PlatformApplication->m_Cursor->GetPosition();
+		}
+
+		// the moves are not routed to the widgets yet
+		return false;
+	}
+
+	void FSlateApplication::Tick()
+	{
+		ZERO_PROFILE_BEGIN_FRAME();
+
+		if (m_PlatformApplication && m_PlatformApplication->UsesVirtualTime())
+		{
+			// replayed sessions run as fast as possible, the frames only see the time of the platform
+			const double Now = m_PlatformApplication->GetVirtualTime();
+			m_DeltaTime = static_cast<float>(Now - m_LastVirtualTime);
+			m_LastVirtualTime = Now;
+		}
+		else
+		{
+			const std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+			m_DeltaTime = std::chrono::duration<float>(Now - m_LastTickTime).count();
+			m_LastTickTime = Now;
+		}
+		m_CurrentTime += m_DeltaTime;
+
+		DrainInput();
+		TickPlatform();
+		ScheduleWindows();
+		PrepassWindows();
+		ArrangeWindows();
+		PaintWindows();
+		BatchWindows();
+		PresentWindows();
+
+		FSlateInvalidationTrace::Get().AdvanceFrame();
+		ZERO_PROFILE_END_FRAME();
+	}
+
+	void FSlateApplication::DrainInput()
+	{
+		ZERO_PROFILE_FRAME_PHASE(InputDrain);
+
+		if (m_PlatformApplication)
+		{
+			m_PlatformApplication->PollGameDeviceState(m_DeltaTime);
+			m_PlatformApplication->PumpMessages(m_DeltaTime);
+			m_PlatformApplication->ProcessDeferredEvents(m_DeltaTime);
+		}
+	}
+
+	void FSlateApplication::TickPlatform()
+	{
+		ZERO_PROFILE_FRAME_PHASE(Tick);
+
+		if (m_PlatformApplication)
+		{
+			m_PlatformApplication->Tick(m_DeltaTime);
+		}
+
+		// the images decoded since the last frame invalidate their widgets before the prepass
+		FSlateAsyncImageLoader::Get().Tick();
+	}
+
+	void FSlateApplication::ScheduleWindows()
+	{
+		m_FrameScheduler.ScheduleFrame(m_Windows, m_PlatformApplication.get(), m_CurrentTime);
+	}
+
+	void FSlateApplication::PrepassWindows()
+	{
+		ZERO_PROFILE_FRAME_PHASE(Prepass);
+
+		for (const Ref<SWindow>& Window : m_FrameScheduler.GetScheduledWindows())
+		{
+			Window->SlatePrepass(Window->GetDPIScaleFactor());
+		}
+	}
+
+	void FSlateApplication::ArrangeWindows()
+	{
+		ZERO_PROFILE_FRAME_PHASE(Arrange);
+
+		m_WindowsToPaint.clear();
+		for (const Ref<SWindow>& Window : m_FrameScheduler.GetScheduledWindows())
+		{
+			FSlateParallelLayout::ArrangeTree(Window, Window->GetWindowGeometryInWindow(), Window->GetArrangedWidgets());
+			Window->UpdateDamageRegion();
+
+			// the windows that didn't change keep the elements and the batches of their last paint
+			if (!Window->GetDamageRegion().IsEmpty())
+			{
+				m_WindowsToPaint.push_back(Window);
+			}
+		}
+	}
+
+	void FSlateApplication::PaintWindows()
+	{
+		ZERO_PROFILE_FRAME_PHASE(Paint);
+
+		for (const Ref<SWindow>& Window : m_WindowsToPaint)
+		{
+			FSlateWindowElementList& ElementList = Window->GetElementList();
+			ElementList.ResetElementList();
+			Window->Paint(Window->GetWindowGeometryInWindow(), Window->GetClippingRectangleInWindow(), ElementList, 0);
+		}
+
+		m_LastPaintTimeNs = FProfiler::Get().GetTimeNs();
+	}
+
+	void FSlateApplication::BatchWindows()
+	{
+		ZERO_PROFILE_FRAME_PHASE(Batch);
+
+		for (const Ref<SWindow>& Window : m_WindowsToPaint)
+		{
+			// the vertices of the widgets that didn't change are kept from the last batch of the window
+			m_ElementBatcher.AddElements(Window->GetBatchData(), Window->GetElementList(), Window->GetInvalidatedWidgets());
+		}
+	}
+
+	void FSlateApplication::PresentWindows()
+	{
+		ZERO_PROFILE_FRAME_PHASE(Present);
+
+		if (m_Renderer)
+		{
+			m_Renderer->DrawWindows(m_WindowsToPaint);
+		}
+	}
+}
@@ -2,17 +2,196 @@
 
 #include "Core.h"
 #include "ApplicationCore/GenericPlatform/GenericApplicationMessageHandler.h"
+#include "Core/InputCore/InputCoreTypes.h"
+#include "Core/InputCore/KeyMap.h"
 #include "SlateCore/Application/SlateApplicationBase.h"
+#include "SlateCore/Layout/WidgetPath.h"
+#include "SlateCore/Rendering/ElementBatcher.h"
+#include "SlateFrameScheduler.h"
+#include <chrono>
 
 namespace ZeroUI
 {
+	class SWindow;
+	class SWidget;
+	struct FKeyEvent;
+	class FModifierKeysState;
+
 	class FSlateApplication
 	: public FSlateApplicationBase
 	, public FGenericApplicationMessageHandler
 	{
 	public:
 
+		/** Creates the application, the application becomes the message handler of the platform application. */
+		static FSlateApplication& Create(const Ref<GenericApplication>& InPlatformApplication);
+
+		/** @return The application, Create must have been called. */
+		static FSlateApplication& Get();
+
+		static bool IsInitialized() { return s_CurrentApplication != nullptr; }
+
+		/** Destroys the application. */
+		static void Shutdown();
+
 		/** Virtual destructor. */
 		virtual ~FSlateApplication();
+
+		/** Adds a top level window, its native window is created by the platform application when it doesn't have one. */
+		void AddWindow(const Ref<SWindow>& InWindow, bool bShowImmediately = true);
+
+		void RemoveWindow(const Ref<SWindow>& InWindow);
+
+		const std::vector<Ref<SWindow>>& GetWindows() const { return m_Windows; }
+
+		/**
+		 * Runs a frame: input drain, tick, prepass, arrange, paint, batch and present.
+		 * Every phase is a profile scope, see FProfiler::GetLastFrameStats for the time spent in each of them.
+		 * Only the windows picked by the frame scheduler are laid out, and only those that changed are painted and presented.
+		 */
+		void Tick();
+
+		/** @return The scheduler that picks the windows updated by each frame, e.g. to change the background frame rate. */
+		FSlateFrameScheduler& GetFrameScheduler() { return m_FrameScheduler; }
+
+		/** @return The key of a mouse button reported by the platform application, EKeys::Invalid for EMouseButtons::Invalid. */
+		static constexpr FKey TranslateMouseButtonToKey(const EMouseButtons::Type Button)
+		{
+			switch (Button)
+			{
+			case EMouseButtons::Left:		return EKeys::LeftMouseButton;
+			case EMouseButtons::Middle:		return EKeys::MiddleMouseButton;
+			case EMouseButtons::Right:		return EKeys::RightMouseButton;
+			case EMouseButtons::Thumb01:	return EKeys::ThumbMouseButton;
+			case EMouseButtons::Thumb02:	return EKeys::ThumbMouseButton2;
+			default:						return EKeys::Invalid;
+			}
+		}
+
+		/** @return The key of a letter or a digit, EKeys::Invalid for the other characters. */
+		static constexpr FKey TranslateCharacterCodeToKey(const uint32_t CharacterCode)
+		{
+			if (CharacterCode >= 'a' && CharacterCode <= 'z')
+			{
+				return TranslateCharacterCodeToKey(CharacterCode - 'a' + 'A');
+			}
+			if (CharacterCode >= 'A' && CharacterCode <= 'Z')
+			{
+				return FKey(static_cast<uint16_t>(EKeys::A.GetIndex() + (CharacterCode - 'A')));
+			}
+			if (CharacterCode >= '0' && CharacterCode <= '9')
+			{
+				return FKey(static_cast<uint16_t>(EKeys::Zero.GetIndex() + (CharacterCode - '0')));
+			}
+			return EKeys::Invalid;
+		}
+
+		/**
+		 * @return The key of a key event of the platform application.
+		 * The key codes are mapped by the platform application, see GenericApplication::GetKeyFromCodes. The key is
+		 * found from the character code when the platform doesn't know the key code.
+		 */
+		FKey TranslateKeyCodeToKey(const int32_t KeyCode, const uint32_t CharacterCode) const;
+
+		/**
+		 * Gives the keyboard focus to the widget the path leads to, the key events are routed along the path.
+		 * The path is kept between the frames, it's revalidated by each key event and only looked up again in the
+		 * arranged widgets when the window was arranged since the last event.
+		 */
+		void SetKeyboardFocus(const FWidgetPath& InFocusPath);
+
+		void ClearKeyboardFocus();
+
+		/** @return The focused widget, null when no widget has the focus or the focused widget is destroyed. */
+		SWidget* GetKeyboardFocusedWidget() const { return m_FocusPath.GetLastWidget(); }
+
+		/** @return The mouse buttons that are pressed. */
+		const FKeySet& GetPressedMouseButtons() const { return m_PressedMouseButtons; }
+
+		/** @return The delta time of the last frame, in seconds. */
+		float GetDeltaTime() const { return m_DeltaTime; }
+
+		/** @return The end of the paint of the last frame, in nanoseconds on the clock of FProfiler::GetTimeNs. */
+		uint64_t GetLastPaintTimeNs() const { return m_LastPaintTimeNs; }
+
+	public:
+		virtual bool OnKeyChar(const TCHAR Character, const bool IsRepeat) override;
+		virtual bool OnKeyDown(const int32_t KeyCode, const uint32_t CharacterCode, const bool IsRepeat) override;
+		virtual bool OnKeyUp(const int32_t KeyCode, const uint32_t CharacterCode, const bool IsRepeat) override;
+		virtual bool OnMouseDown(const Ref< FGenericWindow >& Window, const EMouseButtons::Type Button) override;
+		virtual bool OnMouseDown(const Ref< FGenericWindow >& Window, const EMouseButtons::Type Button, const ZMath::vec2 CursorPos) override;
+		virtual bool OnMouseUp(const EMouseButtons::Type Button) override;
+		virtual bool OnMouseUp(const EMouseButtons::Type Button, const ZMath::vec2 CursorPos) override;
+		virtual bool OnMouseMove() override;
+
+	private:
+		FSlateApplication();
+
+		/** @return The window of the native window, null when it's not a window of the application. */
+		Ref<SWindow> FindWindow(const Ref<FGenericWindow>& InNativeWindow) const;
+
+		FModifierKeysState GetModifierKeys() const;
+
+		/** Routes a key event along the focus path, it bubbles from the focused widget up to the window. */
+		template<typename HandlerType>
+		bool RouteKeyEvent(FKeyEvent& InKeyEvent, HandlerType&& Handler);
+
+		void DrainInput();
+
+		void ScheduleWindows();
+
+		void TickPlatform();
+
+		void PrepassWindows();
+
+		void ArrangeWindows();
+
+		void PaintWindows();
+
+		void BatchWindows();
+
+		void PresentWindows();
+
+	private:
+		static Ref<FSlateApplication> s_CurrentApplication;
+
+		/** The top level windows, in creation order */
+		std::vector<Ref<SWindow>> m_Windows;
+
+		/** Shared by the windows, it keeps its sort buffer between the frames */
+		FSlateElementBatcher m_ElementBatcher;
+
+		FSlateFrameScheduler m_FrameScheduler;
+
+		/** The scheduled windows that changed this frame, in scheduling order */
+		std::vector<Ref<SWindow>> m_WindowsToPaint;
+
+		/** The sum of the delta times, in seconds */
+		double m_CurrentTime;
+
+		std::chrono::steady_clock::time_point m_LastTickTime;
+
+		/** The time of the platform at the last frame, when the platform uses a virtual time */
+		double m_LastVirtualTime;
+
+		float m_DeltaTime;
+
+		uint64_t m_LastPaintTimeNs;
+
+		/** The path of the focused widget */
+		FWeakWidgetPath m_FocusPath;
+
+		/** The arranged path of the focus, updated from m_FocusPath when a key event is routed */
+		FWidgetPath m_FocusWidgetPath;
+
+		/** The path of the widget under the cursor at the last mouse down, the mouse up is routed along it */
+		FWeakWidgetPath m_PointerPath;
+
+		FWidgetPath m_PointerWidgetPath;
+
+		FKeySet m_PressedMouseButtons;
+
+		/** The cursor position of the last mouse event, in window space */
+		ZMath::vec2 m_LastCursorPosition;
 	};
-}
\ No newline at end of file
+}
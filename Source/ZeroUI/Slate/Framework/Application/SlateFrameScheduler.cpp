@@ -0,0 +1,122 @@
+#include "SlateFrameScheduler.h"
+#include "ApplicationCore/GenericPlatform/GenericApplication.h"
+#include "ApplicationCore/GenericPlatform/GenericWindow.h"
+#include "ApplicationCore/GenericPlatform/GenericWindowDefinition.h"
+#include "SlateCore/Widgets/SWindow.h"
+
+namespace ZeroUI
+{
+	void FSlateFrameScheduler::ScheduleFrame(const std::vector<Ref<SWindow>>& Windows, const GenericApplication* PlatformApplication, double Time)
+	{
+		m_ScheduledWindows.clear();
+
+		const bool bApplicationMinimized = PlatformApplication && PlatformApplication->IsMinimized();
+		const size_t NumWindows = Windows.size();
+
+		// the foreground windows are scheduled in the first pass, the throttled windows that are due in the second one
+		for (int32_t Pass = 0; Pass < 2; ++Pass)
+		{
+			for (size_t WindowIndex = 0; WindowIndex < NumWindows; ++WindowIndex)
+			{
+				const Ref<SWindow>& Window = Windows[WindowIndex];
+				const EWindowUpdatePriority Priority = GetWindowPriority(*Window, bApplicationMinimized);
+				if ((Priority == EWindowUpdatePriority::Foreground) != (Pass == 0))
+				{
+					continue;
+				}
+
+				const auto [ScheduleIt, bNewWindow] = m_Schedules.try_emplace(Window.get());
+				FWindowSchedule& Schedule = ScheduleIt->second;
+				const double Interval = GetUpdateInterval(Priority);
+
+				// every window is updated on its first frame, and when it's restored
+				if (bNewWindow || (Schedule.Priority == EWindowUpdatePriority::Minimized && Priority != EWindowUpdatePriority::Minimized))
+				{
+					Schedule.bUpdateRequested = true;
+				}
+
+				// each window has its own phase in the interval, the throttled windows don't update on the same frame
+				const double Phase = Interval > 0.0 ? Interval * static_cast<double>(WindowIndex) / static_cast<double>(NumWindows) : 0.0;
+				const double NextSlotTime = Interval > 0.0 ? Phase + Interval * (std::floor((Time - Phase) / Interval) + 1.0) : Time;
+
+				// a window that was just throttled was updated by the last frame, it waits for its slot
+				if (Schedule.Priority != Priority && Interval > 0.0)
+				{
+					Schedule.NextUpdateTime = NextSlotTime;
+				}
+				Schedule.Priority = Priority;
+
+				const bool bDue = Schedule.bUpdateRequested
+					|| Interval == 0.0
+					|| (Interval > 0.0 && Time >= Schedule.NextUpdateTime);
+				if (!bDue)
+				{
+					continue;
+				}
+
+				Schedule.bUpdateRequested = false;
+				Schedule.NextUpdateTime = NextSlotTime;
+				m_ScheduledWindows.push_back(Window);
+			}
+		}
+	}
+
+	void FSlateFrameScheduler::RequestUpdate(const SWindow& Window)
+	{
+		m_Schedules[&Window].bUpdateRequested = true;
+	}
+
+	void FSlateFrameScheduler::RemoveWindow(const SWindow& Window)
+	{
+		m_Schedules.erase(&Window);
+		m_ScheduledWindows.erase(std::remove_if(m_ScheduledWindows.begin(), m_ScheduledWindows.end(),
+			[&Window](const Ref<SWindow>& ScheduledWindow) { return ScheduledWindow.get() == &Window; }), m_ScheduledWindows.end());
+	}
+
+	EWindowUpdatePriority FSlateFrameScheduler::GetWindowPriority(const SWindow& Window, bool bApplicationMinimized)
+	{
+		if (bApplicationMinimized)
+		{
+			return EWindowUpdatePriority::Minimized;
+		}
+
+		// a window without a native window can't tell, it's never throttled
+		const Ref<FGenericWindow>& NativeWindow = Window.GetNativeWindow();
+		if (!NativeWindow)
+		{
+			return EWindowUpdatePriority::Foreground;
+		}
+
+		if (NativeWindow->IsMinimized())
+		{
+			return EWindowUpdatePriority::Minimized;
+		}
+
+		if (NativeWindow->IsForegroundWindow())
+		{
+			return EWindowUpdatePriority::Foreground;
+		}
+
+		// the popups follow the cursor or the keyboard focus, they are as latency sensitive as the window that opened them
+		const Ref<FGenericWindowDefinition>& Definition = NativeWindow->GetDefinition();
+		if (Definition && (Definition->Type == EWindowType::Menu || Definition->Type == EWindowType::ToolTip || Definition->Type == EWindowType::CursorDecorator))
+		{
+			return EWindowUpdatePriority::Foreground;
+		}
+
+		return EWindowUpdatePriority::Background;
+	}
+
+	double FSlateFrameScheduler::GetUpdateInterval(EWindowUpdatePriority Priority) const
+	{
+		switch (Priority)
+		{
+		case EWindowUpdatePriority::Background:
+			return m_Settings.BackgroundFrameRate > 0.0f ? 1.0 / m_Settings.BackgroundFrameRate : 0.0;
+		case EWindowUpdatePriority::Minimized:
+			return m_Settings.MinimizedFrameRate > 0.0f ? 1.0 / m_Settings.MinimizedFrameRate : -1.0;
+		default:
+			return 0.0;
+		}
+	}
+}
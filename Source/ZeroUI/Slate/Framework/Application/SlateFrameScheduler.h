@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Core.h"
+
+namespace ZeroUI
+{
+	class SWindow;
+	class GenericApplication;
+
+	/** How often a window is updated */
+	enum class EWindowUpdatePriority : uint8_t
+	{
+		/** The foreground window and its menus, tooltips and cursor decorators, updated every frame */
+		Foreground,
+
+		/** The other windows, updated at the background frame rate */
+		Background,
+
+		/** The minimized windows, or every window when the application is minimized */
+		Minimized,
+	};
+
+	struct FSlateFrameSchedulerSettings
+	{
+		/** The update rate of the background windows, in frames per second. 0 updates them every frame. */
+		float BackgroundFrameRate = 10.0f;
+
+		/** The update rate of the minimized windows, in frames per second. 0 never updates them until they are restored. */
+		float MinimizedFrameRate = 1.0f;
+	};
+
+	/**
+	 * Picks the windows that are updated by a frame.
+	 *
+	 * The foreground window is updated by every frame, the other windows are throttled to a low rate and their updates
+	 * are spread over the frames, so many windows don't all lay out and paint on the same frame. A throttled window
+	 * keeps its pending invalidations, its next update catches up with them.
+	 * The scheduled windows are in priority order, the foreground window is laid out, painted and presented first.
+	 */
+	class FSlateFrameScheduler
+	{
+	public:
+
+		FSlateFrameSchedulerSettings& GetSettings() { return m_Settings; }
+
+		/**
+		 * Schedules the windows of the frame.
+		 *
+		 * @param Windows              The top level windows, in creation order.
+		 * @param PlatformApplication  Tells if the whole application is minimized, can be null.
+		 * @param Time                 The time of the frame, in seconds.
+		 */
+		void ScheduleFrame(const std::vector<Ref<SWindow>>& Windows, const GenericApplication* PlatformApplication, double Time);
+
+		/** @return The windows updated by the frame, the foreground windows first. */
+		const std::vector<Ref<SWindow>>& GetScheduledWindows() const { return m_ScheduledWindows; }
+
+		/** Updates the window on the next frame, whatever its priority. */
+		void RequestUpdate(const SWindow& Window);
+
+		/** Forgets a window that was removed from the application. */
+		void RemoveWindow(const SWindow& Window);
+
+		/** @return The priority of the window, from the state of its native window. */
+		static EWindowUpdatePriority GetWindowPriority(const SWindow& Window, bool bApplicationMinimized);
+
+	private:
+
+		/** @return The time between two updates of a window of the priority, 0 for every frame, a negative value for never. */
+		double GetUpdateInterval(EWindowUpdatePriority Priority) const;
+
+	private:
+
+		struct FWindowSchedule
+		{
+			/** The time of the next update of a throttled window */
+			double NextUpdateTime = 0.0;
+
+			/** The priority of the window during the last frame */
+			EWindowUpdatePriority Priority = EWindowUpdatePriority::Foreground;
+
+			bool bUpdateRequested = false;
+		};
+
+		FSlateFrameSchedulerSettings m_Settings;
+
+		std::unordered_map<const SWindow*, FWindowSchedule> m_Schedules;
+
+		std::vector<Ref<SWindow>> m_ScheduledWindows;
+	};
+}
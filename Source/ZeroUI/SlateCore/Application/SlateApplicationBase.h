@@ -5,6 +5,8 @@
 namespace ZeroUI
 {
 	class FSlateRenderer;
+	class GenericApplication;
+
 	/**
 	 * Base class for Slate applications.
 	 *
@@ -19,5 +21,20 @@ namespace ZeroUI
 		FSlateApplicationBase();
 		virtual ~FSlateApplicationBase() { }
 
+		/** @return The platform application that pumps the messages and creates the native windows. */
+		const Ref<GenericApplication>& GetPlatformApplication() const { return m_PlatformApplication; }
+
+		/** @return The renderer that presents the windows, can be null. */
+		FSlateRenderer* GetRenderer() const { return m_Renderer.get(); }
+
+		/** Sets the renderer used by the present phase of the frame. */
+		void SetRenderer(const Ref<FSlateRenderer>& InRenderer) { m_Renderer = InRenderer; }
+
+	protected:
+		/** The platform application, set when the application is created. */
+		Ref<GenericApplication> m_PlatformApplication;
+
+		/** The renderer, null when nothing is presented(e.g. the benchmarks). */
+		Ref<FSlateRenderer> m_Renderer;
 	};	
 }
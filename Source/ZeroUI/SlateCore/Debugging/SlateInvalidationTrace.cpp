@@ -0,0 +1,148 @@
+#include "SlateInvalidationTrace.h"
+#include "SlateCore/Widgets/SWidgets.h"
+#include "SlateCore/Widgets/WidgetClassStats.h"
+
+namespace ZeroUI
+{
+	FSlateInvalidationTrace& FSlateInvalidationTrace::Get()
+	{
+		static FSlateInvalidationTrace Instance;
+		return Instance;
+	}
+
+	FSlateInvalidationTrace::FSlateInvalidationTrace()
+		: m_Slots(Capacity)
+		, m_WriteCount(0)
+		, m_FrameNumber(0)
+		, m_bEnabled(false)
+	{
+	}
+
+	void FSlateInvalidationTrace::Record(const SWidget& Widget, const FSlateAttributeDescriptor::FAttribute* Attribute, EInvalidateWidgetReason Reason)
+	{
+		const uint64_t EventIndex = m_WriteCount.fetch_add(1, std::memory_order_relaxed);
+		FSlot& Slot = m_Slots[EventIndex & (Capacity - 1)];
+
+		// the slot is marked as being written, a reader that copies it in the mean time drops the copy
+		Slot.Sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		Slot.Event.Widget = &Widget;
+		Slot.Event.WidgetClass = &Widget.GetWidgetClass();
+		Slot.Event.Attribute = Attribute;
+		Slot.Event.Reason = Reason;
+		Slot.Event.FrameNumber = GetFrameNumber();
+
+		Slot.Sequence.store(EventIndex + 1, std::memory_order_release);
+	}
+
+	std::vector<FInvalidationTraceEvent> FSlateInvalidationTrace::GetEvents(uint64_t FrameNumber) const
+	{
+		std::vector<FInvalidationTraceEvent> Events;
+
+		const uint64_t WriteCount = m_WriteCount.load(std::memory_order_acquire);
+		const uint64_t FirstEvent = WriteCount > Capacity ? WriteCount - Capacity : 0;
+		for (uint64_t EventIndex = FirstEvent; EventIndex < WriteCount; ++EventIndex)
+		{
+			const FSlot& Slot = m_Slots[EventIndex & (Capacity - 1)];
+			if (Slot.Sequence.load(std::memory_order_acquire) != EventIndex + 1)
+			{
+				// not published yet, or already overwritten
+				continue;
+			}
+
+			const FInvalidationTraceEvent Event = Slot.Event;
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (Slot.Sequence.load(std::memory_order_relaxed) != EventIndex + 1)
+			{
+				continue;
+			}
+
+			if (Event.FrameNumber == FrameNumber)
+			{
+				Events.push_back(Event);
+			}
+		}
+		return Events;
+	}
+
+	std::vector<FInvalidatorStats> FSlateInvalidationTrace::GetTopInvalidators(uint64_t FrameNumber, int32_t MaxResults) const
+	{
+		using FInvalidatorKey = std::pair<const SWidget*, const FSlateAttributeDescriptor::FAttribute*>;
+
+		std::map<FInvalidatorKey, FInvalidatorStats> Invalidators;
+		for (const FInvalidationTraceEvent& Event : GetEvents(FrameNumber))
+		{
+			FInvalidatorStats& Stats = Invalidators[FInvalidatorKey(Event.Widget, Event.Attribute)];
+			if (Stats.Count == 0)
+			{
+				Stats.Widget = Event.Widget;
+				Stats.WidgetType = Event.WidgetClass->GetWidgetType();
+				Stats.AttributeName = Event.Attribute ? Event.Attribute->Get_Name() : NAME_None;
+			}
+			Stats.Reasons |= Event.Reason;
+			++Stats.Count;
+		}
+
+		std::vector<FInvalidatorStats> Result;
+		Result.reserve(Invalidators.size());
+		for (auto& [Key, Stats] : Invalidators)
+		{
+			Result.push_back(std::move(Stats));
+		}
+
+		std::stable_sort(Result.begin(), Result.end(), [](const FInvalidatorStats& A, const FInvalidatorStats& B) { return A.Count > B.Count; });
+		if (MaxResults >= 0 && Result.size() > static_cast<size_t>(MaxResults))
+		{
+			Result.resize(MaxResults);
+		}
+		return Result;
+	}
+
+	std::string FSlateInvalidationTrace::ReportToString(uint32_t NumFrames, int32_t MaxResults) const
+	{
+		std::ostringstream Stream;
+
+		// the current frame is still being recorded
+		const uint64_t CurrentFrame = GetFrameNumber();
+		const uint64_t FirstFrame = CurrentFrame > NumFrames ? CurrentFrame - NumFrames : 0;
+		for (uint64_t FrameNumber = FirstFrame; FrameNumber < CurrentFrame; ++FrameNumber)
+		{
+			Stream << "Frame " << FrameNumber << "\n";
+			for (const FInvalidatorStats& Stats : GetTopInvalidators(FrameNumber, MaxResults))
+			{
+				Stream << "    " << Stats.Count << "x " << Stats.WidgetType << "(" << Stats.Widget << ")";
+				if (!Stats.AttributeName.IsNone())
+				{
+					Stream << "." << Stats.AttributeName;
+				}
+
+				Stream << " :";
+				for (uint32_t BitIndex = 0; BitIndex < NumInvalidateWidgetReasons; ++BitIndex)
+				{
+					if (static_cast<uint8_t>(Stats.Reasons) & (1 << BitIndex))
+					{
+						Stream << " " << GetInvalidateWidgetReasonName(BitIndex);
+					}
+				}
+				Stream << "\n";
+			}
+		}
+		return Stream.str();
+	}
+
+	void FSlateInvalidationTrace::Report(uint32_t NumFrames, int32_t MaxResults) const
+	{
+		CORE_LOG_INFO("Top invalidators:\n{0}", ReportToString(NumFrames, MaxResults));
+	}
+
+	void FSlateInvalidationTrace::Reset()
+	{
+		for (FSlot& Slot : m_Slots)
+		{
+			Slot.Sequence.store(0, std::memory_order_relaxed);
+		}
+		m_WriteCount.store(0, std::memory_order_release);
+	}
+}
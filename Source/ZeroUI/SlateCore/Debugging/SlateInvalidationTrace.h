@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Core.h"
+#include "Core/Profiling/Profiler.h"
+#include "SlateCore/Types/SlateAttributeDescriptor.h"
+#include "SlateCore/Widgets/InvalidateWidgetReason.h"
+#include <atomic>
+
+/* the invalidation trace is part of the profiling build */
+#ifndef ZERO_ENABLE_INVALIDATION_TRACE
+#define ZERO_ENABLE_INVALIDATION_TRACE ZERO_ENABLE_PROFILER
+#endif
+
+namespace ZeroUI
+{
+	class SWidget;
+	class FSlateWidgetClassData;
+
+	/* an invalidation, the widget is only used as an identity and must not be dereferenced, it can be destroyed */
+	struct FInvalidationTraceEvent
+	{
+		const SWidget* Widget = nullptr;
+		const FSlateWidgetClassData* WidgetClass = nullptr;
+
+		/* the slate attribute that invalidated the widget, null when the widget was invalidated directly */
+		const FSlateAttributeDescriptor::FAttribute* Attribute = nullptr;
+
+		EInvalidateWidgetReason Reason = EInvalidateWidgetReason::None;
+
+		uint64_t FrameNumber = 0;
+	};
+
+	/* the invalidations of a frame grouped by widget and attribute */
+	struct FInvalidatorStats
+	{
+		const SWidget* Widget = nullptr;
+		FName WidgetType;
+
+		/* none when the widget was invalidated directly */
+		FName AttributeName;
+
+		/* all the reasons of the group */
+		EInvalidateWidgetReason Reasons = EInvalidateWidgetReason::None;
+
+		uint32_t Count = 0;
+	};
+
+	/*
+	 * records who invalidated which widget, why and when
+	 * the events are written in a fixed ring buffer, a thread reserves a slot with an atomic increment and publishes it
+	 * with the sequence of the slot, so recording never locks. the oldest events are overwritten.
+	 *
+	 * a layout storm shows up in the report as a single attribute that invalidates the layout many times per frame
+	 */
+	class FSlateInvalidationTrace
+	{
+	public:
+		/* a power of 2 */
+		static constexpr uint32_t Capacity = 1 << 16;
+
+		static FSlateInvalidationTrace& Get();
+
+		FSlateInvalidationTrace();
+
+		FSlateInvalidationTrace(const FSlateInvalidationTrace&) = delete;
+		FSlateInvalidationTrace& operator=(const FSlateInvalidationTrace&) = delete;
+
+		void SetEnabled(bool bInEnabled) { m_bEnabled.store(bInEnabled, std::memory_order_relaxed); }
+
+		bool IsEnabled() const { return ZERO_ENABLE_INVALIDATION_TRACE && m_bEnabled.load(std::memory_order_relaxed); }
+
+		/* record an invalidation in the current frame */
+		void Record(const SWidget& Widget, const FSlateAttributeDescriptor::FAttribute* Attribute, EInvalidateWidgetReason Reason);
+
+		/* called by the application at the end of a frame */
+		void AdvanceFrame() { m_FrameNumber.fetch_add(1, std::memory_order_relaxed); }
+
+		uint64_t GetFrameNumber() const { return m_FrameNumber.load(std::memory_order_relaxed); }
+
+		/* the events of a frame that are still in the buffer, in recording order */
+		std::vector<FInvalidationTraceEvent> GetEvents(uint64_t FrameNumber) const;
+
+		/* the widgets and attributes that invalidated the most during a frame, the biggest first */
+		std::vector<FInvalidatorStats> GetTopInvalidators(uint64_t FrameNumber, int32_t MaxResults = 10) const;
+
+		/* the top invalidators of the last NumFrames complete frames, one line per invalidator */
+		std::string ReportToString(uint32_t NumFrames = 1, int32_t MaxResults = 10) const;
+
+		/* write the report in the core log */
+		void Report(uint32_t NumFrames = 1, int32_t MaxResults = 10) const;
+
+		/* forget all the recorded events, call it between two frames while nothing is invalidated */
+		void Reset();
+
+	private:
+		struct FSlot
+		{
+			/* index of the event + 1 once it's written, 0 while it's empty */
+			std::atomic<uint64_t> Sequence = 0;
+			FInvalidationTraceEvent Event;
+		};
+
+	private:
+		std::vector<FSlot> m_Slots;
+
+		/* number of events reserved since the creation of the trace */
+		std::atomic<uint64_t> m_WriteCount;
+
+		std::atomic<uint64_t> m_FrameNumber;
+
+		std::atomic<bool> m_bEnabled;
+	};
+}
@@ -2,6 +2,7 @@
 
 #include "Core.h"
 #include "Core/InputCore/InputCoreTypes.h"
+#include "Core/InputCore/KeyMap.h"
 #include "ApplicationCore/GenericPlatform/GenericApplication.h"
 
 namespace ZeroUI
@@ -54,6 +55,24 @@ namespace ZeroUI
 			m_EventPath = &InEventPath;
 		}
 
+		/*returns the path the event is routed along, null before the event is routed*/
+		const FWidgetPath* GetEventPath() const
+		{
+			return m_EventPath;
+		}
+
+		/*returns the state of the modifier keys when the event happened*/
+		const FModifierKeysState& GetModifierKeys() const
+		{
+			return m_ModifierKeys;
+		}
+
+		/*returns true if this key was auto-repeated*/
+		bool IsRepeat() const
+		{
+			return m_bIsRepeat;
+		}
+
 		/*
 		 * returns the index of the user that generated this event
 		 */
@@ -107,8 +126,15 @@ namespace ZeroUI
 		, m_CharacterCode(InCharacterCode)
 		, m_KeyCode(InKeyCode)
 		{}
+
+		/*returns the key that was pressed*/
+		FKey GetKey() const { return m_Key; }
+
+		uint32_t GetCharacterCode() const { return m_CharacterCode; }
+
+		uint32_t GetKeyCode() const { return m_KeyCode; }
 	private:
-		//name of the key that was pressed
+		//the key that was pressed
 		FKey m_Key;
 
 		//the character code of the key that was pressed, only applicable to typed character keys, 0 otherwise
@@ -139,6 +165,8 @@ namespace ZeroUI
 			, m_ScreenSpacePosition(InScreenSpacePosition)
 			, m_LastScreenSpacePosition(InLastscreenSpacePosition)
 			, m_CursorDelta(InScreenSpacePosition - InLastscreenSpacePosition)
+			, m_PressedButtons(nullptr)
+			, m_EffectingButton(EKeys::Invalid)
 			, m_PointerIndex(InPointerIndex)
 		{}
 
@@ -146,7 +174,7 @@ namespace ZeroUI
 			uint32_t InPointerIndex,
 			const ZMath::vec2& InScreenSpacePosition,
 			const ZMath::vec2& InLastscreenSpacePosition,
-			const std::set<FKey>& InPressedButtons,
+			const FKeySet& InPressedButtons,
 			FKey InEffectingButton,
 			float InWheelDelta,
 			const FModifierKeysState& in_modifier_keys
@@ -165,7 +193,7 @@ namespace ZeroUI
 			uint32_t InPointerIndex,
 			const ZMath::vec2& InScreenSpacePosition,
 			const ZMath::vec2& InLastscreenSpacePosition,
-			const std::set<FKey>& InPressedButtons,
+			const FKeySet& InPressedButtons,
 			FKey InEffectingButton,
 			float InWheelDelta,
 			const FModifierKeysState& in_modifier_keys
@@ -179,6 +207,12 @@ namespace ZeroUI
 			, m_PointerIndex(InPointerIndex)
 		{}
 
+		/*returns true if the button is pressed*/
+		bool IsMouseButtonDown(FKey MouseButton) const { return m_PressedButtons && m_PressedButtons->Contains(MouseButton); }
+
+		/*returns the button that caused this event, EKeys::Invalid when the event was not caused by a button*/
+		FKey GetEffectingButton() const { return m_EffectingButton; }
+
 		/*returns the position of the cursor in screen space*/
 		const ZMath::vec2 get_screen_space_position() const { return m_ScreenSpacePosition; }
 
@@ -197,11 +231,9 @@ namespace ZeroUI
 		ZMath::vec2 m_CursorDelta;
 
 
-		const std::set<FKey>* m_PressedButtons;
+		const FKeySet* m_PressedButtons;
 		FKey m_EffectingButton;
 
-		//todo:implement TSet<FKey>
-		//todo:implement FKey
 		uint32_t m_PointerIndex;
 
 		//todo:implement other information and members
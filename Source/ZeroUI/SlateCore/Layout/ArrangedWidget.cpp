@@ -0,0 +1,10 @@
+#include "ArrangedWidget.h"
+#include "SlateCore/Widgets/SWidgets.h"
+
+namespace ZeroUI
+{
+	void FArrangedChildren::AddWidget(const FArrangedWidget& InWidgetGeometry)
+	{
+		AddWidget(InWidgetGeometry.GetWidget()->GetVisibility(), InWidgetGeometry);
+	}
+}
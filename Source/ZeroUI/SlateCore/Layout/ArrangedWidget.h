@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Core.h"
+#include "Core/Containers/InlineVector.h"
+#include "SlateCore/Layout/Geometry.h"
+#include "SlateCore/Layout/Visibility.h"
+
+namespace ZeroUI
+{
+	class SWidget;
+
+	/*
+	 * a pair of widget and its geometry
+	 * widgets populate a list of FArrangedWidget when they arrange their children
+	 */
+	class FArrangedWidget
+	{
+	public:
+		FArrangedWidget(Ref<SWidget> InWidget, const FGeometry& InGeometry)
+			: m_Geometry(InGeometry)
+			, m_Widget(std::move(InWidget))
+		{
+		}
+
+		SWidget* GetWidgetPtr() const { return m_Widget.get(); }
+
+		const Ref<SWidget>& GetWidget() const { return m_Widget; }
+
+		const FGeometry& GetGeometry() const { return m_Geometry; }
+
+		bool operator==(const FArrangedWidget& Other) const
+		{
+			return m_Widget == Other.m_Widget;
+		}
+
+	private:
+		/* the widget's geometry */
+		FGeometry m_Geometry;
+
+		/* the widget that is being arranged */
+		Ref<SWidget> m_Widget;
+	};
+
+	/*
+	 * the results of an ArrangeChildren are always returned as an FArrangedChildren
+	 * FArrangedChildren supports a filter that is useful for excluding widgets with unwanted visibilities
+	 */
+	class FArrangedChildren
+	{
+	public:
+		/* most widgets have a few children, they are arranged without allocating */
+		static constexpr uint32_t NumInlineWidgets = 8;
+
+		using FArrangedWidgetArray = TInlineVector<FArrangedWidget, NumInlineWidgets>;
+
+		/*
+		 * construct a new container for arranged children that only accepts children that match the VisibilityFilter
+		 * e.g. FArrangedChildren ArrangedChildren(VIS_All); // accept children regardless of visibility
+		 */
+		explicit FArrangedChildren(EVisibility InVisibilityFilter)
+			: m_VisibilityFilter(InVisibilityFilter)
+		{
+		}
+
+		/* add an arranged widget(i.e. widget and its resulting geometry) to the list of arranged children, the widget visibility is checked against the filter */
+		void AddWidget(const FArrangedWidget& InWidgetGeometry);
+
+		/* add an arranged widget with a visibility that overrides the widget's own visibility */
+		void AddWidget(EVisibility VisibilityOverride, const FArrangedWidget& InWidgetGeometry)
+		{
+			if (Accepts(VisibilityOverride))
+			{
+				m_Array.push_back(InWidgetGeometry);
+			}
+		}
+
+		/* returns true if a widget with the visibility would be added to this container */
+		bool Accepts(EVisibility InVisibility) const
+		{
+			return EVisibility::DoesVisibilityPassFilter(InVisibility, m_VisibilityFilter);
+		}
+
+		EVisibility GetFilter() const { return m_VisibilityFilter; }
+
+		int32_t Num() const { return static_cast<int32_t>(m_Array.size()); }
+
+		bool IsValidIndex(int32_t Index) const { return Index >= 0 && Index < Num(); }
+
+		const FArrangedWidget& operator[](int32_t Index) const { return m_Array[Index]; }
+
+		FArrangedWidget& operator[](int32_t Index) { return m_Array[Index]; }
+
+		const FArrangedWidget& Last() const { return m_Array.back(); }
+
+		void Reserve(int32_t Count) { m_Array.reserve(Count); }
+
+		void Empty() { m_Array.clear(); }
+
+		/* reverse the order of the arranged children */
+		void Reverse() { std::reverse(m_Array.begin(), m_Array.end()); }
+
+		const FArrangedWidgetArray& GetInternalArray() const { return m_Array; }
+
+		FArrangedWidgetArray::iterator begin() { return m_Array.begin(); }
+		FArrangedWidgetArray::iterator end() { return m_Array.end(); }
+		FArrangedWidgetArray::const_iterator begin() const { return m_Array.begin(); }
+		FArrangedWidgetArray::const_iterator end() const { return m_Array.end(); }
+
+	private:
+		/* the widgets with a visibility that doesn't pass the filter are not added */
+		EVisibility m_VisibilityFilter;
+
+		FArrangedWidgetArray m_Array;
+	};
+}
@@ -0,0 +1,51 @@
+#include "Children.h"
+#include "SlateCore/SlotBase.h"
+#include "SlateCore/Widgets/SWidgets.h"
+
+namespace ZeroUI
+{
+	FNoChildren FNoChildren::NoChildrenInstance;
+
+	void FChildren::EndBatchUpdate()
+	{
+		assert(m_BatchUpdateDepth > 0);
+		if (--m_BatchUpdateDepth == 0 && m_PendingInvalidation != EInvalidateWidgetReason::None)
+		{
+			const EInvalidateWidgetReason PendingInvalidation = m_PendingInvalidation;
+			m_PendingInvalidation = EInvalidateWidgetReason::None;
+			InvalidateOwner(PendingInvalidation);
+		}
+	}
+
+	void FChildren::InvalidateOwner(EInvalidateWidgetReason InvalidateReason) const
+	{
+		if (m_BatchUpdateDepth > 0)
+		{
+			m_PendingInvalidation |= InvalidateReason;
+		}
+		else if (m_Owner)
+		{
+			m_Owner->Invalidate(InvalidateReason);
+		}
+	}
+
+	Ref<SWidget> FNoChildren::GetChildAt(int32_t Index)
+	{
+		// nobody should be getting a child when there aren't any children
+		assert(false);
+		return nullptr;
+	}
+
+	Ref<const SWidget> FNoChildren::GetChildAt(int32_t Index) const
+	{
+		assert(false);
+		return nullptr;
+	}
+
+	const FSlotBase& FNoChildren::GetSlotAt(int32_t ChildIndex) const
+	{
+		assert(false);
+		static FSlotBase NullSlot;
+		return NullSlot;
+	}
+}
@@ -1,5 +1,7 @@
 #pragma once
 #include "Core.h"
+#include "Core/Misc/Name.h"
+#include "SlateCore/SlotBase.h"
 
 namespace ZeroUI
 {
@@ -21,7 +23,7 @@ namespace ZeroUI
 		{
 		}
 
-		FChildren(SWidget* InOwner, std::string InName)
+		FChildren(SWidget* InOwner, FName InName)
 			: m_Owner(InOwner)
 			, m_Name(InName)
 		{
@@ -71,15 +73,456 @@ namespace ZeroUI
 		}
 
 		/*option to give a name to children to slot attribute purposes or for debugging*/
-		std::string GetName() const
+		FName GetName() const
 		{
 			return m_Name;
 		}
 
+		/*
+		 * the invalidations of the owner are accumulated until the matching EndBatchUpdate, the calls can be nested
+		 * @see FScopedChildrenUpdate
+		 */
+		void BeginBatchUpdate() { ++m_BatchUpdateDepth; }
+
+		void EndBatchUpdate();
+
+		bool IsInBatchUpdate() const { return m_BatchUpdateDepth > 0; }
+
+	protected:
+		/* the slots invalidate the owner through the children, so their invalidations are batched too */
+		friend class FSlotBase;
+
+		/* invalidate the widget that own the children, if any, deferred during a batch update */
+		void InvalidateOwner(EInvalidateWidgetReason InvalidateReason) const;
+
 	protected:
 		SWidget* m_Owner;
 
 	private:
-		std::string m_Name;
+		FName m_Name;
+
+		uint16_t m_BatchUpdateDepth = 0;
+
+		/* the invalidations requested during the batch update, the slots only see const children */
+		mutable EInvalidateWidgetReason m_PendingInvalidation = EInvalidateWidgetReason::None;
+	};
+
+	/*
+	 * batch the changes of a children container, the owner is invalidated once at the end of the scope
+	 * so the next prepass measures the children once, however many slots were added, removed or sorted
+	 *
+	 *   {
+	 *       FScopedChildrenUpdate ScopedUpdate(Children);
+	 *       for (const FRow& Row : Rows) { Children.AddSlot(MakeRowWidget(Row)); }
+	 *   }
+	 */
+	class FScopedChildrenUpdate
+	{
+	public:
+		explicit FScopedChildrenUpdate(FChildren& InChildren)
+			: m_Children(InChildren)
+		{
+			m_Children.BeginBatchUpdate();
+		}
+
+		~FScopedChildrenUpdate()
+		{
+			m_Children.EndBatchUpdate();
+		}
+
+		FScopedChildrenUpdate(const FScopedChildrenUpdate&) = delete;
+		FScopedChildrenUpdate& operator=(const FScopedChildrenUpdate&) = delete;
+
+	private:
+		FChildren& m_Children;
+	};
+
+	/*
+	 * widgets with no children can return an instance of FNoChildren
+	 * for convenience there is a shared instance FNoChildren::NoChildrenInstance that can be used
+	 */
+	class FNoChildren : public FChildren
+	{
+	public:
+		static FNoChildren NoChildrenInstance;
+
+		FNoChildren()
+			: FChildren(nullptr, "NoChildren")
+		{
+		}
+
+		FNoChildren(SWidget* InOwner)
+			: FChildren(InOwner, "NoChildren")
+		{
+		}
+
+		virtual int32_t Num() const override { return 0; }
+
+		virtual Ref<SWidget> GetChildAt(int32_t Index) override;
+
+		virtual Ref<const SWidget> GetChildAt(int32_t Index) const override;
+
+		virtual const FSlotBase& GetSlotAt(int32_t ChildIndex) const override;
+	};
+
+	/*
+	 * children of the widgets that hold a single widget, the children is also its own slot
+	 * the slot is empty until a widget is attached
+	 */
+	class FSingleWidgetChildrenWithSlot : public FChildren, public TSlotBase<FSingleWidgetChildrenWithSlot>
+	{
+	public:
+		FSingleWidgetChildrenWithSlot(SWidget* InOwner)
+			: FChildren(InOwner)
+			, TSlotBase<FSingleWidgetChildrenWithSlot>(static_cast<const FChildren&>(*this))
+		{
+		}
+
+		virtual int32_t Num() const override { return GetWidget() ? 1 : 0; }
+
+		virtual Ref<SWidget> GetChildAt(int32_t Index) override
+		{
+			assert(Index == 0);
+			return GetWidget();
+		}
+
+		virtual Ref<const SWidget> GetChildAt(int32_t Index) const override
+		{
+			assert(Index == 0);
+			return GetWidget();
+		}
+
+		virtual const FSlotBase& GetSlotAt(int32_t ChildIndex) const override
+		{
+			assert(ChildIndex == 0);
+			return *this;
+		}
+	};
+
+	/* a slot of a TPanelChildren, it stays valid until the slot is removed, the index of the slot can change */
+	struct FPanelSlotHandle
+	{
+		uint32_t StorageIndex = ~0u;
+		uint32_t Generation = 0;
+
+		bool operator==(const FPanelSlotHandle& Other) const = default;
+	};
+
+	/*
+	 * children of the panels, the slots are stored by value in chunks of contiguous memory
+	 * a slot never moves once created, the order of the children is an array of storage indices so reordering the
+	 * children doesn't touch the slots. the storage of a removed slot is reused by the next added slot, the handle
+	 * of the removed slot becomes invalid because the generation of the storage changed.
+	 *
+	 * the batch functions (AddSlots, RemoveSlots, Sort...) invalidate the owner once, Reserve before a bulk add
+	 * allocates the storage of all the slots at once. a FScopedChildrenUpdate batches any sequence of changes.
+	 */
+	template<typename SlotType>
+	class TPanelChildren : public FChildren
+	{
+	public:
+		using FChildren::FChildren;
+
+		~TPanelChildren()
+		{
+			for (FSlotRecord& Record : m_Records)
+			{
+				if (Record.Position != INDEX_NONE)
+				{
+					DestroySlot(Record);
+				}
+			}
+		}
+
+		TPanelChildren(const TPanelChildren&) = delete;
+		TPanelChildren& operator=(const TPanelChildren&) = delete;
+
+		virtual int32_t Num() const override { return static_cast<int32_t>(m_Order.size()); }
+
+		virtual Ref<SWidget> GetChildAt(int32_t Index) override { return (*this)[Index].GetWidget(); }
+
+		virtual Ref<const SWidget> GetChildAt(int32_t Index) const override { return (*this)[Index].GetWidget(); }
+
+		virtual const FSlotBase& GetSlotAt(int32_t ChildIndex) const override { return (*this)[ChildIndex]; }
+
+		SlotType& operator[](int32_t Index) { return *m_Records[m_Order[Index]].Slot; }
+
+		const SlotType& operator[](int32_t Index) const { return *m_Records[m_Order[Index]].Slot; }
+
+		FPanelSlotHandle GetHandle(int32_t Index) const
+		{
+			const uint32_t StorageIndex = m_Order[Index];
+			return FPanelSlotHandle{ StorageIndex, m_Records[StorageIndex].Generation };
+		}
+
+		bool IsValidHandle(FPanelSlotHandle Handle) const
+		{
+			return Handle.StorageIndex < m_Records.size()
+				&& m_Records[Handle.StorageIndex].Generation == Handle.Generation
+				&& m_Records[Handle.StorageIndex].Position != INDEX_NONE;
+		}
+
+		/* null when the slot was removed */
+		SlotType* Find(FPanelSlotHandle Handle) const { return IsValidHandle(Handle) ? m_Records[Handle.StorageIndex].Slot : nullptr; }
+
+		/* the index of the slot in the children, INDEX_NONE when the slot was removed */
+		int32_t IndexOf(FPanelSlotHandle Handle) const { return IsValidHandle(Handle) ? m_Records[Handle.StorageIndex].Position : INDEX_NONE; }
+
+		/* make room for NumSlots more slots, the missing storage is allocated in a single chunk */
+		void Reserve(int32_t NumSlots)
+		{
+			const int32_t Missing = NumSlots - GetSlack();
+			if (Missing > 0)
+			{
+				AllocateChunk(static_cast<uint32_t>(Missing));
+			}
+			m_Order.reserve(m_Order.size() + NumSlots);
+		}
+
+		FPanelSlotHandle AddSlot(const Ref<SWidget>& Widget)
+		{
+			return InsertSlot(Widget, Num());
+		}
+
+		FPanelSlotHandle InsertSlot(const Ref<SWidget>& Widget, int32_t Index)
+		{
+			assert(Index >= 0 && Index <= Num());
+			const uint32_t StorageIndex = CreateSlot(Widget);
+			m_Order.insert(m_Order.begin() + Index, StorageIndex);
+			UpdatePositions(Index);
+			InvalidateOwner(EInvalidateWidgetReason::Child_Order);
+			return FPanelSlotHandle{ StorageIndex, m_Records[StorageIndex].Generation };
+		}
+
+		/* add a slot per widget at the end, the handles of the new slots are appended to OutHandles when given */
+		template<typename WidgetRangeType>
+		void AddSlots(const WidgetRangeType& Widgets, std::vector<FPanelSlotHandle>* OutHandles = nullptr)
+		{
+			const int32_t FirstIndex = Num();
+			Reserve(static_cast<int32_t>(std::size(Widgets)));
+			for (const Ref<SWidget>& Widget : Widgets)
+			{
+				const uint32_t StorageIndex = CreateSlot(Widget);
+				m_Order.push_back(StorageIndex);
+				if (OutHandles)
+				{
+					OutHandles->push_back(FPanelSlotHandle{ StorageIndex, m_Records[StorageIndex].Generation });
+				}
+			}
+			UpdatePositions(FirstIndex);
+
+			if (Num() != FirstIndex)
+			{
+				InvalidateOwner(EInvalidateWidgetReason::Child_Order);
+			}
+		}
+
+		/* returns false when the slot was already removed */
+		bool RemoveSlot(FPanelSlotHandle Handle)
+		{
+			return RemoveSlots(&Handle, 1) == 1;
+		}
+
+		void RemoveAt(int32_t Index)
+		{
+			RemoveSlot(GetHandle(Index));
+		}
+
+		/* returns the number of slots removed, the handles of the slots already removed are ignored */
+		int32_t RemoveSlots(const FPanelSlotHandle* Handles, int32_t NumHandles)
+		{
+			if (NumHandles == 1)
+			{
+				// the position is known, no need to search the removed slots
+				if (!IsValidHandle(Handles[0]))
+				{
+					return 0;
+				}
+
+				FSlotRecord& Record = m_Records[Handles[0].StorageIndex];
+				const int32_t Position = Record.Position;
+				DestroySlot(Record);
+				m_FreeRecords.push_back(Handles[0].StorageIndex);
+				m_Order.erase(m_Order.begin() + Position);
+				UpdatePositions(Position);
+				InvalidateOwner(EInvalidateWidgetReason::Child_Order);
+				return 1;
+			}
+
+			int32_t NumRemoved = 0;
+			for (int32_t HandleIndex = 0; HandleIndex < NumHandles; ++HandleIndex)
+			{
+				if (IsValidHandle(Handles[HandleIndex]))
+				{
+					DestroySlot(m_Records[Handles[HandleIndex].StorageIndex]);
+					m_FreeRecords.push_back(Handles[HandleIndex].StorageIndex);
+					++NumRemoved;
+				}
+			}
+
+			if (NumRemoved > 0)
+			{
+				std::erase_if(m_Order, [this](uint32_t StorageIndex) { return m_Records[StorageIndex].Position == INDEX_NONE; });
+				UpdatePositions(0);
+				InvalidateOwner(EInvalidateWidgetReason::Child_Order);
+			}
+			return NumRemoved;
+		}
+
+		int32_t RemoveSlots(const std::vector<FPanelSlotHandle>& Handles)
+		{
+			return RemoveSlots(Handles.data(), static_cast<int32_t>(Handles.size()));
+		}
+
+		/* remove all the slots, the storage is kept for the next slots */
+		void Empty()
+		{
+			if (m_Order.empty())
+			{
+				return;
+			}
+
+			for (uint32_t StorageIndex : m_Order)
+			{
+				DestroySlot(m_Records[StorageIndex]);
+				m_FreeRecords.push_back(StorageIndex);
+			}
+			m_Order.clear();
+			InvalidateOwner(EInvalidateWidgetReason::Child_Order);
+		}
+
+		/* move the child at FromIndex so it ends at ToIndex */
+		void Move(int32_t FromIndex, int32_t ToIndex)
+		{
+			if (FromIndex == ToIndex)
+			{
+				return;
+			}
+
+			const uint32_t StorageIndex = m_Order[FromIndex];
+			m_Order.erase(m_Order.begin() + FromIndex);
+			m_Order.insert(m_Order.begin() + ToIndex, StorageIndex);
+			UpdatePositions(std::min(FromIndex, ToIndex));
+			InvalidateOwner(EInvalidateWidgetReason::Child_Order);
+		}
+
+		void Swap(int32_t IndexA, int32_t IndexB)
+		{
+			if (IndexA == IndexB)
+			{
+				return;
+			}
+
+			std::swap(m_Order[IndexA], m_Order[IndexB]);
+			m_Records[m_Order[IndexA]].Position = IndexA;
+			m_Records[m_Order[IndexB]].Position = IndexB;
+			InvalidateOwner(EInvalidateWidgetReason::Child_Order);
+		}
+
+		/* stable sort of the children, the predicate compares two const SlotType& */
+		template<typename PredicateType>
+		void Sort(PredicateType Predicate)
+		{
+			std::stable_sort(m_Order.begin(), m_Order.end(), [this, &Predicate](uint32_t A, uint32_t B)
+			{
+				return Predicate(static_cast<const SlotType&>(*m_Records[A].Slot), static_cast<const SlotType&>(*m_Records[B].Slot));
+			});
+			UpdatePositions(0);
+			InvalidateOwner(EInvalidateWidgetReason::Child_Order);
+		}
+
+		/* the number of slots that can be stored without allocating */
+		int32_t GetSlack() const { return static_cast<int32_t>(m_FreeRecords.size() + m_Records.size() - m_NumUsedRecords); }
+
+	private:
+		struct FSlotStorage
+		{
+			alignas(SlotType) uint8_t Bytes[sizeof(SlotType)];
+		};
+
+		struct FSlotRecord
+		{
+			SlotType* Slot;
+
+			/* incremented each time the slot is destroyed */
+			uint32_t Generation;
+
+			/* the index of the slot in the children, INDEX_NONE while the storage is free */
+			int32_t Position;
+		};
+
+		/* the records of the new chunk are used in order after the records of the previous chunks */
+		void AllocateChunk(uint32_t NumSlots)
+		{
+			FSlotStorage* Chunk = m_Chunks.emplace_back(new FSlotStorage[NumSlots]).get();
+
+			m_Records.reserve(m_Records.size() + NumSlots);
+			for (uint32_t SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+			{
+				m_Records.push_back(FSlotRecord{ reinterpret_cast<SlotType*>(Chunk + SlotIndex), 0, INDEX_NONE });
+			}
+		}
+
+		uint32_t CreateSlot(const Ref<SWidget>& Widget)
+		{
+			uint32_t StorageIndex;
+			if (!m_FreeRecords.empty())
+			{
+				StorageIndex = m_FreeRecords.back();
+				m_FreeRecords.pop_back();
+			}
+			else
+			{
+				if (m_NumUsedRecords == m_Records.size())
+				{
+					// grows like a vector, but the slots already created don't move
+					AllocateChunk(std::max<uint32_t>(MinChunkSize, static_cast<uint32_t>(m_Records.size())));
+				}
+				StorageIndex = m_NumUsedRecords++;
+			}
+
+			FSlotRecord& Record = m_Records[StorageIndex];
+			Record.Slot = new (Record.Slot) SlotType();
+			Record.Position = 0;
+			Record.Slot->SetOwner(*this);
+			if (Widget)
+			{
+				Record.Slot->AttachWidget(Widget);
+			}
+			return StorageIndex;
+		}
+
+		void DestroySlot(FSlotRecord& Record)
+		{
+			Record.Slot->DetachWidget();
+			Record.Slot->~SlotType();
+			Record.Position = INDEX_NONE;
+			++Record.Generation;
+		}
+
+		void UpdatePositions(int32_t FirstIndex)
+		{
+			for (int32_t Index = FirstIndex; Index < Num(); ++Index)
+			{
+				m_Records[m_Order[Index]].Position = Index;
+			}
+		}
+
+	private:
+		static constexpr uint32_t MinChunkSize = 8;
+
+		std::vector<std::unique_ptr<FSlotStorage[]>> m_Chunks;
+
+		/* one record per storage, indexed by the storage index of the handles */
+		std::vector<FSlotRecord> m_Records;
+
+		/* the records after it were never used */
+		uint32_t m_NumUsedRecords = 0;
+
+		/* the records of the removed slots */
+		std::vector<uint32_t> m_FreeRecords;
+
+		/* the storage index of the children, in order */
+		std::vector<uint32_t> m_Order;
 	};
-}
\ No newline at end of file
+}
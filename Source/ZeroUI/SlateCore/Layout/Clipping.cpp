@@ -0,0 +1,295 @@
+#include "Clipping.h"
+
+namespace ZeroUI
+{
+	namespace
+	{
+		/* 2d cross product of (B - A) and (P - A), the sign tells on which side of the edge AB the point P is */
+		float EdgeSide(const ZMath::vec2& A, const ZMath::vec2& B, const ZMath::vec2& P)
+		{
+			return (B.x - A.x) * (P.y - A.y) - (B.y - A.y) * (P.x - A.x);
+		}
+	}
+
+	FSlateClippingZone::FSlateClippingZone(const FSlateRect& AxisAlignedRect)
+		: m_bIsAxisAligned(true)
+		, m_bIntersect(true)
+		, m_bAlwaysClip(false)
+	{
+		m_TopLeft = ZMath::vec2(AxisAlignedRect.Left, AxisAlignedRect.Top);
+		m_TopRight = ZMath::vec2(AxisAlignedRect.Right, AxisAlignedRect.Top);
+		m_BottomLeft = ZMath::vec2(AxisAlignedRect.Left, AxisAlignedRect.Bottom);
+		m_BottomRight = ZMath::vec2(AxisAlignedRect.Right, AxisAlignedRect.Bottom);
+	}
+
+	FSlateClippingZone::FSlateClippingZone(const FGeometry& BoundingGeometry)
+		: m_bIsAxisAligned(true)
+		, m_bIntersect(true)
+		, m_bAlwaysClip(false)
+	{
+		const ZMath::vec2& LocalSize = BoundingGeometry.GetLocalSize();
+		const FSlateRenderTransform& RenderTransform = BoundingGeometry.GetAccumulatedRenderTransform();
+
+		InitializeFromArbitraryPoints(
+			RenderTransform.TransformPoint(ZMath::vec2(0.0f, 0.0f)),
+			RenderTransform.TransformPoint(ZMath::vec2(LocalSize.x, 0.0f)),
+			RenderTransform.TransformPoint(ZMath::vec2(0.0f, LocalSize.y)),
+			RenderTransform.TransformPoint(LocalSize));
+	}
+
+	FSlateClippingZone::FSlateClippingZone(const ZMath::vec2& InTopLeft, const ZMath::vec2& InTopRight, const ZMath::vec2& InBottomLeft, const ZMath::vec2& InBottomRight)
+		: m_bIsAxisAligned(true)
+		, m_bIntersect(true)
+		, m_bAlwaysClip(false)
+	{
+		InitializeFromArbitraryPoints(InTopLeft, InTopRight, InBottomLeft, InBottomRight);
+	}
+
+	void FSlateClippingZone::InitializeFromArbitraryPoints(const ZMath::vec2& InTopLeft, const ZMath::vec2& InTopRight, const ZMath::vec2& InBottomLeft, const ZMath::vec2& InBottomRight)
+	{
+		m_bIsAxisAligned = InTopLeft.x == InBottomLeft.x && InTopRight.x == InBottomRight.x
+			&& InTopLeft.y == InTopRight.y && InBottomLeft.y == InBottomRight.y;
+
+		if (m_bIsAxisAligned)
+		{
+			// a flipped geometry is still axis aligned, store the corners so the rect is always well ordered
+			const FSlateRect Bounds(ZMath::min(InTopLeft, InBottomRight), ZMath::max(InTopLeft, InBottomRight));
+			m_TopLeft = ZMath::vec2(Bounds.Left, Bounds.Top);
+			m_TopRight = ZMath::vec2(Bounds.Right, Bounds.Top);
+			m_BottomLeft = ZMath::vec2(Bounds.Left, Bounds.Bottom);
+			m_BottomRight = ZMath::vec2(Bounds.Right, Bounds.Bottom);
+		}
+		else
+		{
+			m_TopLeft = InTopLeft;
+			m_TopRight = InTopRight;
+			m_BottomLeft = InBottomLeft;
+			m_BottomRight = InBottomRight;
+		}
+	}
+
+	FSlateClippingZone FSlateClippingZone::Intersect(const FSlateClippingZone& Other) const
+	{
+		assert(IsAxisAligned() && Other.IsAxisAligned());
+
+		bool bOverlapping = false;
+		const FSlateRect Intersected = GetBoundingBox().IntersectionWith(Other.GetBoundingBox(), bOverlapping);
+
+		FSlateClippingZone Result(Intersected);
+		Result.m_bIntersect = Other.m_bIntersect;
+		Result.m_bAlwaysClip = m_bAlwaysClip || Other.m_bAlwaysClip;
+		return Result;
+	}
+
+	FSlateRect FSlateClippingZone::GetBoundingBox() const
+	{
+		if (m_bIsAxisAligned)
+		{
+			return FSlateRect(m_TopLeft, m_BottomRight);
+		}
+
+		const ZMath::vec2 Min = ZMath::min(ZMath::min(m_TopLeft, m_TopRight), ZMath::min(m_BottomLeft, m_BottomRight));
+		const ZMath::vec2 Max = ZMath::max(ZMath::max(m_TopLeft, m_TopRight), ZMath::max(m_BottomLeft, m_BottomRight));
+		return FSlateRect(Min, Max);
+	}
+
+	bool FSlateClippingZone::IsPointInside(const ZMath::vec2& Point) const
+	{
+		if (m_bIsAxisAligned)
+		{
+			return GetBoundingBox().ContainsPoint(Point);
+		}
+
+		// the quad is convex, the point is inside when it's on the same side of all the edges
+		const float S0 = EdgeSide(m_TopLeft, m_TopRight, Point);
+		const float S1 = EdgeSide(m_TopRight, m_BottomRight, Point);
+		const float S2 = EdgeSide(m_BottomRight, m_BottomLeft, Point);
+		const float S3 = EdgeSide(m_BottomLeft, m_TopLeft, Point);
+
+		const bool bAllPositive = S0 >= 0.0f && S1 >= 0.0f && S2 >= 0.0f && S3 >= 0.0f;
+		const bool bAllNegative = S0 <= 0.0f && S1 <= 0.0f && S2 <= 0.0f && S3 <= 0.0f;
+		return bAllPositive || bAllNegative;
+	}
+
+	bool FSlateClippingZone::HasZeroArea() const
+	{
+		if (m_bIsAxisAligned)
+		{
+			return GetBoundingBox().IsEmpty();
+		}
+
+		// shoelace formula on TL -> TR -> BR -> BL
+		const float DoubleArea =
+			(m_TopLeft.x * m_TopRight.y - m_TopRight.x * m_TopLeft.y) +
+			(m_TopRight.x * m_BottomRight.y - m_BottomRight.x * m_TopRight.y) +
+			(m_BottomRight.x * m_BottomLeft.y - m_BottomLeft.x * m_BottomRight.y) +
+			(m_BottomLeft.x * m_TopLeft.y - m_TopLeft.x * m_BottomLeft.y);
+		return std::abs(DoubleArea) <= std::numeric_limits<float>::epsilon();
+	}
+
+	bool FSlateClippingState::IsPointInside(const ZMath::vec2& Point) const
+	{
+		if (m_ScissorRect.has_value())
+		{
+			return m_ScissorRect->IsPointInside(Point);
+		}
+
+		for (const FSlateClippingZone& StencilQuad : m_StencilQuads)
+		{
+			if (!StencilQuad.IsPointInside(Point))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool FSlateClippingState::HasZeroArea() const
+	{
+		if (m_ScissorRect.has_value())
+		{
+			return m_ScissorRect->HasZeroArea();
+		}
+
+		if (m_StencilQuads.empty())
+		{
+			return false;
+		}
+
+		bool bOverlapping = true;
+		FSlateRect Bounds = m_StencilQuads[0].GetBoundingBox();
+		for (size_t Index = 1; Index < m_StencilQuads.size() && bOverlapping; ++Index)
+		{
+			Bounds = Bounds.IntersectionWith(m_StencilQuads[Index].GetBoundingBox(), bOverlapping);
+		}
+
+		if (!bOverlapping)
+		{
+			return true;
+		}
+
+		return std::any_of(m_StencilQuads.begin(), m_StencilQuads.end(), [](const FSlateClippingZone& Zone) { return Zone.HasZeroArea(); });
+	}
+
+	FSlateRect FSlateClippingState::GetBoundingBox() const
+	{
+		if (m_ScissorRect.has_value())
+		{
+			return m_ScissorRect->GetBoundingBox();
+		}
+
+		// the visible area is the intersection of all the stencil quads, their bounding boxes intersection is a conservative estimation
+		FSlateRect Bounds = m_StencilQuads.empty() ? FSlateRect(0.0f, 0.0f, 0.0f, 0.0f) : m_StencilQuads[0].GetBoundingBox();
+		for (size_t Index = 1; Index < m_StencilQuads.size(); ++Index)
+		{
+			Bounds = Bounds.IntersectionWith(m_StencilQuads[Index].GetBoundingBox());
+		}
+		return Bounds;
+	}
+
+	FSlateClippingManager::FSlateClippingManager()
+	{
+	}
+
+	int32_t FSlateClippingManager::PushClip(const FSlateClippingZone& InClippingZone)
+	{
+		// a zone that fully covers the active state doesn't clip anything more once intersected with it,
+		// reuse the active state so the batcher doesn't split on it
+		const int32_t ActiveIndex = GetClippingIndex();
+		if (ActiveIndex != INDEX_NONE && !InClippingZone.GetAlwaysClip() && InClippingZone.GetShouldIntersectParent() && InClippingZone.IsAxisAligned())
+		{
+			if (FSlateRect::IsRectangleContained(InClippingZone.GetBoundingBox(), m_ClippingStates[ActiveIndex].GetBoundingBox()))
+			{
+				m_ClippingStack.push_back(ActiveIndex);
+				return ActiveIndex;
+			}
+		}
+
+		FSlateClippingState NewState = CreateClippingState(InClippingZone);
+
+		// a zone that ends up with the same state as the active one, e.g. a window re-pushing its own bounds
+		if (ActiveIndex != INDEX_NONE && !NewState.GetAlwaysClip() && m_ClippingStates[ActiveIndex] == NewState)
+		{
+			m_ClippingStack.push_back(ActiveIndex);
+			return ActiveIndex;
+		}
+
+		m_ClippingStates.push_back(std::move(NewState));
+		const int32_t NewIndex = static_cast<int32_t>(m_ClippingStates.size()) - 1;
+		m_ClippingStack.push_back(NewIndex);
+		return NewIndex;
+	}
+
+	int32_t FSlateClippingManager::PushClippingState(const FSlateClippingState& InClippingState)
+	{
+		m_ClippingStates.push_back(InClippingState);
+		const int32_t NewIndex = static_cast<int32_t>(m_ClippingStates.size()) - 1;
+		m_ClippingStack.push_back(NewIndex);
+		return NewIndex;
+	}
+
+	void FSlateClippingManager::PopClip()
+	{
+		if (!m_ClippingStack.empty())
+		{
+			m_ClippingStack.pop_back();
+		}
+	}
+
+	int32_t FSlateClippingManager::GetClippingIndex() const
+	{
+		return m_ClippingStack.empty() ? INDEX_NONE : m_ClippingStack.back();
+	}
+
+	const FSlateClippingState* FSlateClippingManager::GetActiveClippingState() const
+	{
+		const int32_t ActiveIndex = GetClippingIndex();
+		return ActiveIndex == INDEX_NONE ? nullptr : &m_ClippingStates[ActiveIndex];
+	}
+
+	bool FSlateClippingManager::IsCulled(const FSlateRect& AbsoluteBounds) const
+	{
+		const FSlateClippingState* ActiveState = GetActiveClippingState();
+		if (ActiveState == nullptr)
+		{
+			return false;
+		}
+
+		return ActiveState->HasZeroArea() || !FSlateRect::DoRectanglesIntersect(ActiveState->GetBoundingBox(), AbsoluteBounds);
+	}
+
+	void FSlateClippingManager::ResetClippingState()
+	{
+		m_ClippingStack.clear();
+		m_ClippingStates.clear();
+	}
+
+	FSlateClippingState FSlateClippingManager::CreateClippingState(const FSlateClippingZone& InClippingZone) const
+	{
+		const FSlateClippingState* ParentState = InClippingZone.GetShouldIntersectParent() ? GetActiveClippingState() : nullptr;
+
+		FSlateClippingState NewState(InClippingZone.GetAlwaysClip());
+
+		// fast path, everything is axis aligned so the new state is a single rect intersection
+		if (InClippingZone.IsAxisAligned() && (ParentState == nullptr || ParentState->GetClippingMethod() == EClippingMethod::Scissor))
+		{
+			NewState.m_ScissorRect = ParentState ? ParentState->m_ScissorRect->Intersect(InClippingZone) : InClippingZone;
+			return NewState;
+		}
+
+		// a rotated zone is involved, fallback to the stencil and keep every zone of the stack
+		if (ParentState)
+		{
+			if (ParentState->GetClippingMethod() == EClippingMethod::Scissor)
+			{
+				NewState.m_StencilQuads.push_back(ParentState->m_ScissorRect.value());
+			}
+			else
+			{
+				NewState.m_StencilQuads = ParentState->m_StencilQuads;
+			}
+		}
+		NewState.m_StencilQuads.push_back(InClippingZone);
+		return NewState;
+	}
+}
@@ -0,0 +1,222 @@
+#pragma once
+
+#include "Core.h"
+#include "SlateCore/Layout/SlteRect.h"
+#include "SlateCore/Layout/Geometry.h"
+
+namespace ZeroUI
+{
+	/*
+	 * this enum controls clipping of widgets in slate
+	 * by default all SWidgets do not need to clip, in most cases the content of the widget never escapes the bounds
+	 */
+	enum class EWidgetClipping : uint8_t
+	{
+		/*
+		 * this widget does not clip children, it and all children inherit the clipping area of the last widget that clipped
+		 */
+		Inherit,
+
+		/*
+		 * this widget clips content to the bounds of this widget, it intersects those bounds with any previous clipping area
+		 */
+		ClipToBounds,
+
+		/*
+		 * this widget clips to its bounds, it does not intersect with any previous bounds from parents
+		 * note: this flag does not allow avoiding clipping, it just means the clipping area is not intersected with the parent one
+		 */
+		ClipToBoundsWithoutIntersecting,
+
+		/*
+		 * this widget clips to its bounds, it intersects those bounds with any previous clipping area
+		 * the clipping state is kept even when the widget fully contains it's children
+		 */
+		ClipToBoundsAlways,
+
+		/*
+		 * this widget clips to its bounds when it's desired size is larger than the allotted geometry
+		 * when that happens it works like ClipToBounds
+		 */
+		OnDemand
+	};
+
+	/* the method used to clip the draw elements of a clipping state */
+	enum class EClippingMethod : uint8_t
+	{
+		/* axis aligned clipping, a single scissor rect, cheap */
+		Scissor,
+
+		/* arbitrary clipping zones, requires a stencil buffer, only used with rotated/skewed render transforms */
+		Stencil
+	};
+
+	/*
+	 * the clipping zone represents some arbitrary plane segment that can be used to clip the geometry in slate
+	 * zones are defined by their four corners in window space, when all corners line up on the x/y axis the zone is axis aligned
+	 */
+	class FSlateClippingZone
+	{
+	public:
+		ZMath::vec2 m_TopLeft;
+		ZMath::vec2 m_TopRight;
+		ZMath::vec2 m_BottomLeft;
+		ZMath::vec2 m_BottomRight;
+
+		/* creates an axis aligned zone from a window space rectangle */
+		explicit FSlateClippingZone(const FSlateRect& AxisAlignedRect);
+
+		/* creates a zone from the render transformed bounds of a geometry */
+		explicit FSlateClippingZone(const FGeometry& BoundingGeometry);
+
+		/* creates a zone from four arbitrary corners */
+		FSlateClippingZone(const ZMath::vec2& InTopLeft, const ZMath::vec2& InTopRight, const ZMath::vec2& InBottomLeft, const ZMath::vec2& InBottomRight);
+
+		/*
+		 * intersect two axis aligned zones
+		 * only valid when both zones are axis aligned, the other cases are handled by the stencil path
+		 */
+		FSlateClippingZone Intersect(const FSlateClippingZone& Other) const;
+
+		/* returns the axis aligned bounding box of the zone */
+		FSlateRect GetBoundingBox() const;
+
+		/* returns true when the zone can be represented by a scissor rect */
+		bool IsAxisAligned() const { return m_bIsAxisAligned; }
+
+		/* should this zone be intersected with the clipping zone of the parent */
+		bool GetShouldIntersectParent() const { return m_bIntersect; }
+
+		void SetShouldIntersectParent(bool bValue) { m_bIntersect = bValue; }
+
+		/* should the clipping state survive even if a child is fully inside of it */
+		bool GetAlwaysClip() const { return m_bAlwaysClip; }
+
+		void SetAlwaysClip(bool bValue) { m_bAlwaysClip = bValue; }
+
+		/* returns true when the point, in window space, is inside the zone */
+		bool IsPointInside(const ZMath::vec2& Point) const;
+
+		/* returns true if the zone covers no area, everything clipped by it is culled */
+		bool HasZeroArea() const;
+
+		bool operator==(const FSlateClippingZone& Other) const
+		{
+			return m_bIsAxisAligned == Other.m_bIsAxisAligned
+				&& m_bIntersect == Other.m_bIntersect
+				&& m_bAlwaysClip == Other.m_bAlwaysClip
+				&& m_TopLeft == Other.m_TopLeft
+				&& m_TopRight == Other.m_TopRight
+				&& m_BottomLeft == Other.m_BottomLeft
+				&& m_BottomRight == Other.m_BottomRight;
+		}
+
+	private:
+		void InitializeFromArbitraryPoints(const ZMath::vec2& InTopLeft, const ZMath::vec2& InTopRight, const ZMath::vec2& InBottomLeft, const ZMath::vec2& InBottomRight);
+
+	private:
+		uint8_t m_bIsAxisAligned : 1;
+		uint8_t m_bIntersect : 1;
+		uint8_t m_bAlwaysClip : 1;
+	};
+
+	/*
+	 * captures everything about a single draw call's clipping
+	 * axis aligned states are a single scissor rect, the other states are a list of stencil quads that are all rendered into the stencil buffer
+	 */
+	class FSlateClippingState
+	{
+	public:
+		FSlateClippingState(bool bInAlwaysClip = false)
+			: m_bAlwaysClip(bInAlwaysClip)
+		{
+		}
+
+		/* the method used to clip with this state */
+		EClippingMethod GetClippingMethod() const
+		{
+			return m_ScissorRect.has_value() ? EClippingMethod::Scissor : EClippingMethod::Stencil;
+		}
+
+		/* returns true when the point, in window space, survives the clipping */
+		bool IsPointInside(const ZMath::vec2& Point) const;
+
+		/* returns true if the state clips everything */
+		bool HasZeroArea() const;
+
+		/* returns the axis aligned bounding box of the area that can be drawn to, used for culling */
+		FSlateRect GetBoundingBox() const;
+
+		bool GetAlwaysClip() const { return m_bAlwaysClip; }
+
+		bool operator==(const FSlateClippingState& Other) const
+		{
+			return m_bAlwaysClip == Other.m_bAlwaysClip
+				&& m_ScissorRect == Other.m_ScissorRect
+				&& m_StencilQuads == Other.m_StencilQuads;
+		}
+
+	public:
+		/* axis aligned rect, set when the state is clipped by a scissor */
+		std::optional<FSlateClippingZone> m_ScissorRect;
+
+		/* the stencil quads, used when any of the zones in the stack is not axis aligned */
+		std::vector<FSlateClippingZone> m_StencilQuads;
+
+	private:
+		bool m_bAlwaysClip;
+	};
+
+	/*
+	 * the clipping manager maintain the running clip state
+	 * it's used by the element list to track the clipping zone pushed by the widgets while they paint
+	 * every push produces a clipping state, the draw elements store the index of the active state so the batcher can split batches on clip changes
+	 */
+	class FSlateClippingManager
+	{
+	public:
+		FSlateClippingManager();
+
+		/*
+		 * push a new clipping zone, it's intersected with the active state when the zone asks for it
+		 * @return the index of the clipping state that is now active
+		 */
+		int32_t PushClip(const FSlateClippingZone& InClippingZone);
+
+		/* push an already built clipping state, used by cached widgets that recorded their state */
+		int32_t PushClippingState(const FSlateClippingState& InClippingState);
+
+		/* pop the last pushed zone, the previous clipping state becomes active again */
+		void PopClip();
+
+		/* returns the index of the active clipping state or INDEX_NONE when nothing is clipped */
+		int32_t GetClippingIndex() const;
+
+		/* returns the active clipping state if there is one */
+		const FSlateClippingState* GetActiveClippingState() const;
+
+		const std::vector<FSlateClippingState>& GetClippingStates() const { return m_ClippingStates; }
+
+		/* number of zones currently pushed */
+		int32_t GetStackDepth() const { return static_cast<int32_t>(m_ClippingStack.size()); }
+
+		/*
+		 * returns true when the rectangle, in window space, can't be seen through the active clipping state
+		 * the test uses the bounding box of the state, stencil states are conservative
+		 */
+		bool IsCulled(const FSlateRect& AbsoluteBounds) const;
+
+		/* clear the stack and the states, called at the start of each frame */
+		void ResetClippingState();
+
+	private:
+		FSlateClippingState CreateClippingState(const FSlateClippingZone& InClippingZone) const;
+
+	private:
+		/* stack of the clipping state index */
+		std::vector<int32_t> m_ClippingStack;
+
+		/* all the clipping states that were created this frame */
+		std::vector<FSlateClippingState> m_ClippingStates;
+	};
+}
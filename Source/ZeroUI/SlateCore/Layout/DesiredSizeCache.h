@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Core.h"
+
+namespace ZeroUI
+{
+	/*
+	 * the desired size of a widget, and the sizes it had at the last layout scales it was measured with
+	 * a tree shown on monitors with different dpi goes back to the size of a scale without measuring it again,
+	 * e.g. when a window is dragged back and forth between the monitors
+	 * the size of the current scale is kept inline, the other scales are allocated the first time the widget is measured
+	 * at a second scale. only the layout scale dependent widgets are, the others are cached at a single scale.
+	 */
+	class FDesiredSizeCache
+	{
+	public:
+		/* the scales kept, the current one included */
+		static constexpr int32_t MaxScales = 4;
+
+		bool HasDesiredSize() const { return m_bHasDesiredSize; }
+
+		const ZMath::vec2& GetDesiredSize() const { return m_DesiredSize; }
+
+		void SetDesiredSize(const ZMath::vec2& InDesiredSize)
+		{
+			m_DesiredSize = InDesiredSize;
+			m_bHasDesiredSize = true;
+		}
+
+		/*
+		 * makes the size cached for the scale the desired size
+		 * @return false when the scale isn't cached, the desired size is unchanged
+		 */
+		bool Restore(float LayoutScale)
+		{
+			if (m_LayoutScale == LayoutScale && m_LayoutScale != NoLayoutScale)
+			{
+				return true;
+			}
+
+			// taken out before the current size is pushed, a full cache would drop it
+			FScaleEntry Entry;
+			const bool bFound = m_OtherScales && m_OtherScales->Pop(LayoutScale, Entry);
+
+			// the current size goes back in the other scales, it's the most recently used
+			if (m_LayoutScale != NoLayoutScale)
+			{
+				if (!m_OtherScales)
+				{
+					m_OtherScales = CreateScope<FOtherScales>();
+				}
+				m_OtherScales->Push(FScaleEntry{ m_LayoutScale, m_DesiredSize });
+				m_LayoutScale = NoLayoutScale;
+			}
+
+			if (bFound)
+			{
+				m_LayoutScale = Entry.LayoutScale;
+				SetDesiredSize(Entry.DesiredSize);
+			}
+			return bFound;
+		}
+
+		/* caches the desired size for the scale, the least recently used scale is dropped when the cache is full */
+		void Store(float LayoutScale)
+		{
+			assert(m_bHasDesiredSize && m_LayoutScale == NoLayoutScale);
+			m_LayoutScale = LayoutScale;
+		}
+
+		/* drops the cached scales, the desired size is kept so the next measure can tell if it changed */
+		void InvalidateScales()
+		{
+			m_LayoutScale = NoLayoutScale;
+			if (m_OtherScales)
+			{
+				m_OtherScales->NumScales = 0;
+			}
+		}
+
+	private:
+		/* the current size isn't cached, e.g. its content changed */
+		static constexpr float NoLayoutScale = 0.0f;
+
+		struct FScaleEntry
+		{
+			float LayoutScale = NoLayoutScale;
+			ZMath::vec2 DesiredSize = ZMath::vec2(0.0f, 0.0f);
+		};
+
+		/* the scales other than the current one, the most recently used first */
+		struct FOtherScales
+		{
+			std::array<FScaleEntry, MaxScales - 1> Scales;
+			int32_t NumScales = 0;
+
+			void Push(const FScaleEntry& Entry)
+			{
+				NumScales = std::min(NumScales + 1, MaxScales - 1);
+				std::copy_backward(Scales.begin(), Scales.begin() + NumScales - 1, Scales.begin() + NumScales);
+				Scales[0] = Entry;
+			}
+
+			bool Pop(float LayoutScale, FScaleEntry& OutEntry)
+			{
+				for (int32_t Index = 0; Index < NumScales; ++Index)
+				{
+					if (Scales[Index].LayoutScale == LayoutScale)
+					{
+						OutEntry = Scales[Index];
+						std::copy(Scales.begin() + Index + 1, Scales.begin() + NumScales, Scales.begin() + Index);
+						--NumScales;
+						return true;
+					}
+				}
+				return false;
+			}
+		};
+
+		Scope<FOtherScales> m_OtherScales;
+
+		ZMath::vec2 m_DesiredSize = ZMath::vec2(0.0f, 0.0f);
+
+		/* the scale of the desired size, NoLayoutScale when it must be measured again */
+		float m_LayoutScale = NoLayoutScale;
+
+		bool m_bHasDesiredSize = false;
+	};
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "Core.h"
+#include "SlateCore/Layout/SlteRect.h"
+#include "SlateCore/Layout/PaintGeometry.h"
+#include "SlateCore/Rendering/SlateLayoutTransform.h"
+#include "SlateCore/Rendering/SlateRenderTransform.h"
+
+namespace ZeroUI
+{
+	/*
+	 * represents the position, size, and absolute position of a widget in slate
+	 * the absolute location of a geometry is usually screen space or window space depending on where the geometry originated
+	 * geometries are usually paired with a SWidget pointer in order to provide information about a specific widget(see FArrangedWidget)
+	 * a geometry's parent is generally thought to be the geometry of the widget containing it
+	 */
+	struct FGeometry
+	{
+	public:
+		/* default ctor, creates a geometry with identity transforms and a zero size */
+		FGeometry()
+			: m_Size(0.0f, 0.0f)
+			, m_AccumulatedLayoutTransform(ZMath::vec2(0.0f, 0.0f))
+			, m_AccumulatedRenderTransform()
+			, m_bHasRenderTransform(false)
+		{
+		}
+
+		/*
+		 * make a root geometry, it is usually the geometry of a window
+		 *
+		 * @param InLocalSize the size of the root in local space
+		 * @param InLayoutTransform the transform from the local space of the root to the absolute space
+		 */
+		static FGeometry MakeRoot(const ZMath::vec2& InLocalSize, const FSlateLayoutTransform& InLayoutTransform)
+		{
+			return FGeometry(InLocalSize, InLayoutTransform, FSlateRenderTransform(InLayoutTransform.GetScale(), InLayoutTransform.GetTranslation()), false);
+		}
+
+		/*
+		 * create a child geometry relative to this one with a given local space size and layout transform
+		 *
+		 * @param InLocalSize the size of the child in it's local space
+		 * @param InLayoutTransform the layout transform of the child relative to this geometry
+		 */
+		FGeometry MakeChild(const ZMath::vec2& InLocalSize, const FSlateLayoutTransform& InLayoutTransform) const
+		{
+			const FSlateLayoutTransform ChildLayoutTransform = InLayoutTransform.Concatenate(m_AccumulatedLayoutTransform);
+			const FSlateRenderTransform ChildRenderTransform = FSlateRenderTransform(InLayoutTransform.GetScale(), InLayoutTransform.GetTranslation()).Concatenate(m_AccumulatedRenderTransform);
+			return FGeometry(InLocalSize, ChildLayoutTransform, ChildRenderTransform, m_bHasRenderTransform);
+		}
+
+		/*
+		 * create a child geometry that also carries a render transform
+		 * the render transform is applied around the pivot, expressed in normalized local space(0.5, 0.5 is the center)
+		 */
+		FGeometry MakeChild(const ZMath::vec2& InLocalSize, const FSlateLayoutTransform& InLayoutTransform, const FSlateRenderTransform& InRenderTransform, const ZMath::vec2& InRenderTransformPivot) const
+		{
+			const ZMath::vec2 Pivot = InRenderTransformPivot * InLocalSize;
+			const FSlateRenderTransform LocalRenderTransform = FSlateRenderTransform(-Pivot).Concatenate(InRenderTransform).Concatenate(FSlateRenderTransform(Pivot));
+
+			const FSlateLayoutTransform ChildLayoutTransform = InLayoutTransform.Concatenate(m_AccumulatedLayoutTransform);
+			const FSlateRenderTransform ChildRenderTransform = LocalRenderTransform
+				.Concatenate(FSlateRenderTransform(InLayoutTransform.GetScale(), InLayoutTransform.GetTranslation()))
+				.Concatenate(m_AccumulatedRenderTransform);
+			return FGeometry(InLocalSize, ChildLayoutTransform, ChildRenderTransform, true);
+		}
+
+		/* create a child geometry that is offset by the given local position and has the given size */
+		FGeometry MakeChild(const ZMath::vec2& InLocalPosition, const ZMath::vec2& InLocalSize) const
+		{
+			return MakeChild(InLocalSize, FSlateLayoutTransform(InLocalPosition));
+		}
+
+		/* the size of the geometry in local space */
+		const ZMath::vec2& GetLocalSize() const { return m_Size; }
+
+		/* the accumulated layout transform, from the local space to the absolute space */
+		const FSlateLayoutTransform& GetAccumulatedLayoutTransform() const { return m_AccumulatedLayoutTransform; }
+
+		/* the accumulated render transform, from the local space to the window space */
+		const FSlateRenderTransform& GetAccumulatedRenderTransform() const { return m_AccumulatedRenderTransform; }
+
+		/* true if a render transform was applied to this geometry or one of it's ancestors */
+		bool HasRenderTransform() const { return m_bHasRenderTransform; }
+
+		/*
+		 * true when the render transform only contains a scale and a translation
+		 * axis aligned geometries can be clipped with a scissor rect, the other ones need a stencil
+		 */
+		bool IsRenderTransformAxisAligned() const
+		{
+			float A, B, C, D;
+			m_AccumulatedRenderTransform.GetMatrix().GetMatrix(A, B, C, D);
+			return B == 0.0f && C == 0.0f;
+		}
+
+		/* the absolute position of the top left corner of the geometry */
+		ZMath::vec2 GetAbsolutePosition() const
+		{
+			return m_AccumulatedLayoutTransform.GetTranslation();
+		}
+
+		/* the absolute size of the geometry, ignoring render transforms */
+		ZMath::vec2 GetAbsoluteSize() const
+		{
+			return m_AccumulatedLayoutTransform.TransformVector(m_Size);
+		}
+
+		/* the rectangle covered by the geometry in layout space, render transforms are ignored */
+		FSlateRect GetLayoutBoundingRect() const
+		{
+			const ZMath::vec2 TopLeft = GetAbsolutePosition();
+			return FSlateRect(TopLeft, TopLeft + GetAbsoluteSize());
+		}
+
+		/* the axis aligned bounding box of the geometry once the render transform is applied */
+		FSlateRect GetRenderBoundingRect() const
+		{
+			if (!m_bHasRenderTransform)
+			{
+				return GetLayoutBoundingRect();
+			}
+
+			const ZMath::vec2 TopLeft = m_AccumulatedRenderTransform.TransformPoint(ZMath::vec2(0.0f, 0.0f));
+			const ZMath::vec2 TopRight = m_AccumulatedRenderTransform.TransformPoint(ZMath::vec2(m_Size.x, 0.0f));
+			const ZMath::vec2 BottomLeft = m_AccumulatedRenderTransform.TransformPoint(ZMath::vec2(0.0f, m_Size.y));
+			const ZMath::vec2 BottomRight = m_AccumulatedRenderTransform.TransformPoint(m_Size);
+
+			const ZMath::vec2 Min = ZMath::min(ZMath::min(TopLeft, TopRight), ZMath::min(BottomLeft, BottomRight));
+			const ZMath::vec2 Max = ZMath::max(ZMath::max(TopLeft, TopRight), ZMath::max(BottomLeft, BottomRight));
+			return FSlateRect(Min, Max);
+		}
+
+		/* convert the geometry to a paint geometry that the draw elements can consume */
+		FPaintGeometry ToPaintGeometry() const
+		{
+			return FPaintGeometry(m_AccumulatedLayoutTransform, m_AccumulatedRenderTransform, m_Size, m_bHasRenderTransform);
+		}
+
+	private:
+		FGeometry(const ZMath::vec2& InLocalSize, const FSlateLayoutTransform& InLayoutTransform, const FSlateRenderTransform& InRenderTransform, bool bInHasRenderTransform)
+			: m_Size(InLocalSize)
+			, m_AccumulatedLayoutTransform(InLayoutTransform)
+			, m_AccumulatedRenderTransform(InRenderTransform)
+			, m_bHasRenderTransform(bInHasRenderTransform)
+		{
+		}
+
+	private:
+		/* size of the geometry in local space */
+		ZMath::vec2 m_Size;
+
+		/* the accumulated layout transform from the root */
+		FSlateLayoutTransform m_AccumulatedLayoutTransform;
+
+		/* the accumulated render transform from the root */
+		FSlateRenderTransform m_AccumulatedRenderTransform;
+
+		uint8_t m_bHasRenderTransform : 1;
+	};
+}
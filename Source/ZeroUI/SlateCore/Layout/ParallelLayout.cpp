@@ -0,0 +1,193 @@
+#include "ParallelLayout.h"
+#include "SlateCore/Layout/Children.h"
+#include "SlateCore/Widgets/SWidgets.h"
+#include "Core/Async/JobSystem.h"
+#include "Core/Containers/InlineVector.h"
+#include "Core/Profiling/Profiler.h"
+
+namespace ZeroUI
+{
+	int32_t FArrangedWidgetTree::AddNode(const FArrangedWidget& ArrangedWidget, int32_t ParentIndex)
+	{
+		m_Nodes.emplace_back(ArrangedWidget, ParentIndex);
+		return Num() - 1;
+	}
+
+	void FArrangedWidgetTree::AppendSubtree(FArrangedWidgetTree&& Subtree, int32_t ParentIndex)
+	{
+		if (Subtree.m_Nodes.empty())
+		{
+			return;
+		}
+
+		const int32_t Offset = Num();
+		m_Nodes.reserve(m_Nodes.size() + Subtree.m_Nodes.size());
+		for (FArrangedWidgetNode& Node : Subtree.m_Nodes)
+		{
+			Node.ParentIndex = Node.ParentIndex == INDEX_NONE ? ParentIndex : Node.ParentIndex + Offset;
+			Node.SubtreeEnd += Offset;
+			m_Nodes.push_back(std::move(Node));
+		}
+		Subtree.m_Nodes.clear();
+	}
+
+	int32_t FArrangedWidgetTree::HitTest(const ZMath::vec2& AbsolutePoint) const
+	{
+		// the nodes are in paint order, the last widget hit is the one on top
+		int32_t HitIndex = INDEX_NONE;
+		int32_t NodeIndex = 0;
+		while (NodeIndex < Num())
+		{
+			const FArrangedWidgetNode& Node = m_Nodes[NodeIndex];
+			const EVisibility Visibility = Node.ArrangedWidget.GetWidgetPtr()->GetVisibility();
+			if (!Visibility.IsVisible() || !Node.ArrangedWidget.GetGeometry().GetRenderBoundingRect().ContainsPoint(AbsolutePoint))
+			{
+				NodeIndex = Node.SubtreeEnd;
+				continue;
+			}
+
+			if (Visibility.IsHitTestVisible())
+			{
+				HitIndex = NodeIndex;
+			}
+
+			NodeIndex = Visibility.AreChildrenHitTestVisible() ? NodeIndex + 1 : Node.SubtreeEnd;
+		}
+		return HitIndex;
+	}
+
+	FParallelLayoutSettings& FSlateParallelLayout::GetSettings()
+	{
+		static FParallelLayoutSettings Settings;
+		return Settings;
+	}
+
+	bool FSlateParallelLayout::ShouldRunAsTask(const SWidget& Widget)
+	{
+		const FParallelLayoutSettings& Settings = GetSettings();
+		return Settings.bEnabled
+			&& Widget.IsSubtreeThreadSafeLayout()
+			&& Widget.GetSubtreeWidgetCount() >= Settings.MinSubtreeWidgetCount
+			&& FJobSystem::Get().IsInitialized();
+	}
+
+	FSubtreeLayoutStats FSlateParallelLayout::PrepassChildren(SWidget& Widget, FChildren& Children, float LayoutScaleMultiplier)
+	{
+		FSubtreeLayoutStats Stats;
+		FJobCounter Counter;
+
+		const int32_t NumChildren = Children.Num();
+		for (int32_t ChildIndex = 0; ChildIndex < NumChildren; ++ChildIndex)
+		{
+			Ref<SWidget> Child = Children.GetChildAt(ChildIndex);
+
+			// collapsed widgets take no space, they are not measured
+			if (Child->GetVisibility() == EVisibility::Collapsed)
+			{
+				continue;
+			}
+
+			const float ChildLayoutScaleMultiplier = LayoutScaleMultiplier * Widget.GetRelativeLayoutScale(ChildIndex, LayoutScaleMultiplier);
+			if (ShouldRunAsTask(*Child))
+			{
+				FJobSystem::Get().Dispatch(Counter, [Child, ChildLayoutScaleMultiplier]()
+				{
+					ZERO_PROFILE_SCOPE("PrepassSubtree");
+					Child->SlatePrepass(ChildLayoutScaleMultiplier);
+				});
+			}
+			else
+			{
+				Child->SlatePrepass(ChildLayoutScaleMultiplier);
+			}
+		}
+
+		FJobSystem::Get().Wait(Counter);
+
+		// the children are all measured, gather the stats for the next prepass
+		for (int32_t ChildIndex = 0; ChildIndex < NumChildren; ++ChildIndex)
+		{
+			Ref<SWidget> Child = Children.GetChildAt(ChildIndex);
+			if (Child->GetVisibility() != EVisibility::Collapsed)
+			{
+				Stats.WidgetCount += Child->GetSubtreeWidgetCount();
+				Stats.bThreadSafe = Stats.bThreadSafe && Child->IsSubtreeThreadSafeLayout();
+				Stats.bDesiredSizeChanged = Stats.bDesiredSizeChanged || Child->DidDesiredSizeChange();
+			}
+		}
+
+		return Stats;
+	}
+
+	void FSlateParallelLayout::ArrangeTree(const Ref<SWidget>& Root, const FGeometry& RootGeometry, FArrangedWidgetTree& OutTree)
+	{
+		OutTree.Empty();
+		++OutTree.m_ArrangeSerial;
+		OutTree.m_Nodes.reserve(Root->GetSubtreeWidgetCount());
+		ArrangeSubtree(FArrangedWidget(Root, RootGeometry), INDEX_NONE, OutTree);
+	}
+
+	void FSlateParallelLayout::ArrangeSubtree(const FArrangedWidget& ArrangedWidget, int32_t ParentIndex, FArrangedWidgetTree& OutTree)
+	{
+		const int32_t NodeIndex = OutTree.AddNode(ArrangedWidget, ParentIndex);
+
+		FArrangedChildren ArrangedChildren(EVisibility::All);
+		ArrangedWidget.GetWidgetPtr()->ArrangeChildren(ArrangedWidget.GetGeometry(), ArrangedChildren);
+
+		// decided once per child, the dispatched children and the children arranged inline must be the complement
+		TInlineVector<bool, 16> ChildRunsAsTask;
+		ChildRunsAsTask.reserve(ArrangedChildren.Num());
+		bool bHasTask = false;
+		for (const FArrangedWidget& Child : ArrangedChildren)
+		{
+			const bool bRunAsTask = ShouldRunAsTask(*Child.GetWidgetPtr());
+			ChildRunsAsTask.push_back(bRunAsTask);
+			bHasTask = bHasTask || bRunAsTask;
+		}
+
+		if (!bHasTask)
+		{
+			for (const FArrangedWidget& Child : ArrangedChildren)
+			{
+				ArrangeSubtree(Child, NodeIndex, OutTree);
+			}
+		}
+		else
+		{
+			// every child is arranged in its own tree, then the trees are merged in the children order
+			std::vector<FArrangedWidgetTree> ChildTrees(ArrangedChildren.Num());
+			FJobCounter Counter;
+			for (int32_t ChildIndex = 0; ChildIndex < ArrangedChildren.Num(); ++ChildIndex)
+			{
+				const FArrangedWidget& Child = ArrangedChildren[ChildIndex];
+				FArrangedWidgetTree& ChildTree = ChildTrees[ChildIndex];
+				if (ChildRunsAsTask[ChildIndex])
+				{
+					FJobSystem::Get().Dispatch(Counter, [&Child, &ChildTree]()
+					{
+						ZERO_PROFILE_SCOPE("ArrangeSubtree");
+						ArrangeSubtree(Child, INDEX_NONE, ChildTree);
+					});
+				}
+			}
+
+			for (int32_t ChildIndex = 0; ChildIndex < ArrangedChildren.Num(); ++ChildIndex)
+			{
+				if (!ChildRunsAsTask[ChildIndex])
+				{
+					ArrangeSubtree(ArrangedChildren[ChildIndex], INDEX_NONE, ChildTrees[ChildIndex]);
+				}
+			}
+
+			FJobSystem::Get().Wait(Counter);
+
+			for (FArrangedWidgetTree& ChildTree : ChildTrees)
+			{
+				OutTree.AppendSubtree(std::move(ChildTree), NodeIndex);
+			}
+		}
+
+		// the reference can't be kept, the array may have grown while the children were added
+		OutTree.m_Nodes[NodeIndex].SubtreeEnd = OutTree.Num();
+	}
+}
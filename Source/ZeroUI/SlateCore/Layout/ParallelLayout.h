@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Core.h"
+#include "SlateCore/Layout/ArrangedWidget.h"
+
+namespace ZeroUI
+{
+	class SWidget;
+	class FChildren;
+
+	struct FParallelLayoutSettings
+	{
+		/* measure and arrange the big subtrees on the job system, it has no effect when the job system is not initialized */
+		bool bEnabled = true;
+
+		/*
+		 * a child subtree becomes a task when it has at least this many widgets
+		 * smaller subtrees are cheaper to do inline than to schedule
+		 */
+		uint32_t MinSubtreeWidgetCount = 512;
+	};
+
+	/* the widget count and thread safety of a subtree, gathered during the prepass */
+	struct FSubtreeLayoutStats
+	{
+		uint32_t WidgetCount = 0;
+		bool bThreadSafe = true;
+
+		/* the desired size of a child changed, the parent has to be measured again */
+		bool bDesiredSizeChanged = false;
+	};
+
+	/* a node of a flattened arranged tree */
+	struct FArrangedWidgetNode
+	{
+		FArrangedWidgetNode(const FArrangedWidget& InArrangedWidget, int32_t InParentIndex)
+			: ArrangedWidget(InArrangedWidget)
+			, ParentIndex(InParentIndex)
+			, SubtreeEnd(INDEX_NONE)
+		{
+		}
+
+		FArrangedWidget ArrangedWidget;
+
+		/* index of the parent node, INDEX_NONE for the root */
+		int32_t ParentIndex;
+
+		/* index following the last node of the subtree, the whole subtree can be skipped by jumping to it */
+		int32_t SubtreeEnd;
+	};
+
+	/*
+	 * the arranged widgets of a whole tree, in depth first order
+	 * the order doesn't depend on how the tree was arranged, the parallel arrange gives the same array as the serial one
+	 */
+	class FArrangedWidgetTree
+	{
+	public:
+		int32_t Num() const { return static_cast<int32_t>(m_Nodes.size()); }
+
+		const FArrangedWidgetNode& operator[](int32_t Index) const { return m_Nodes[Index]; }
+
+		const std::vector<FArrangedWidgetNode>& GetNodes() const { return m_Nodes; }
+
+		void Empty() { m_Nodes.clear(); }
+
+		/* changes every time the tree is arranged, a node index is only valid for the arrange it was found in */
+		uint32_t GetArrangeSerial() const { return m_ArrangeSerial; }
+
+		/*
+		 * find the top most hit test visible widget under the point, the subtrees that don't contain the point are skipped
+		 * @return the index of the node, INDEX_NONE when nothing is hit
+		 */
+		int32_t HitTest(const ZMath::vec2& AbsolutePoint) const;
+
+	private:
+		friend class FSlateParallelLayout;
+
+		int32_t AddNode(const FArrangedWidget& ArrangedWidget, int32_t ParentIndex);
+
+		/* append a tree that was arranged on its own, its root becomes a child of ParentIndex */
+		void AppendSubtree(FArrangedWidgetTree&& Subtree, int32_t ParentIndex);
+
+	private:
+		std::vector<FArrangedWidgetNode> m_Nodes;
+
+		/* 0 until the tree is arranged */
+		uint32_t m_ArrangeSerial = 0;
+	};
+
+	/*
+	 * layout of the widget tree on the job system
+	 * the children of a widget that head a big, thread safe, subtree are measured/arranged as tasks while the rest is done
+	 * on the calling thread. a widget only writes its own state so siblings never race, and the parent waits for all of
+	 * its children before it's measured, which keeps the bottom-up order of the serial prepass.
+	 * the subtree stats come from the previous prepass, so the first prepass of a new tree is serial.
+	 */
+	class FSlateParallelLayout
+	{
+	public:
+		static FParallelLayoutSettings& GetSettings();
+
+		/*
+		 * prepass the children of a widget, called by SWidget::SlatePrepass
+		 * @return the stats of the children subtrees, the widget itself is not included
+		 */
+		static FSubtreeLayoutStats PrepassChildren(SWidget& Widget, FChildren& Children, float LayoutScaleMultiplier);
+
+		/* arrange the whole tree under the root, the tree must have been prepassed */
+		static void ArrangeTree(const Ref<SWidget>& Root, const FGeometry& RootGeometry, FArrangedWidgetTree& OutTree);
+
+	private:
+		/* returns true when the subtree of the widget is worth being a task */
+		static bool ShouldRunAsTask(const SWidget& Widget);
+
+		static void ArrangeSubtree(const FArrangedWidget& ArrangedWidget, int32_t ParentIndex, FArrangedWidgetTree& OutTree);
+	};
+}
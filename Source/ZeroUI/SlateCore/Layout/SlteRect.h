@@ -46,6 +46,95 @@ namespace ZeroUI
 			return ZMath::vec2(Right, Bottom);
 		}
 
+		/*
+		 * returns the size of the rectangle
+		 * @return the size
+		 */
+		ZMath::vec2 GetSize() const
+		{
+			return ZMath::vec2(Right - Left, Bottom - Top);
+		}
+
+		/* returns the area of the rectangle, 0 for degenerate rectangles */
+		float GetArea() const
+		{
+			return IsEmpty() ? 0.0f : (Right - Left) * (Bottom - Top);
+		}
+
+		/*
+		 * determines if the rectangle has positive dimensions
+		 * the default constructed rectangle(-1, -1, -1, -1) is not valid
+		 */
+		bool IsValid() const
+		{
+			return !(Left == -1 && Right == -1 && Bottom == -1 && Top == -1) && Right >= Left && Bottom >= Top;
+		}
+
+		/* returns true if the rectangle covers no area */
+		bool IsEmpty() const
+		{
+			return Right <= Left || Bottom <= Top;
+		}
+
+		/*
+		 * returns whether or not a point is inside the rectangle
+		 * note: the lower right and bottom sides of the rectangle are not inclusive
+		 */
+		bool ContainsPoint(const ZMath::vec2& Point) const
+		{
+			return Point.x >= Left && Point.x < Right && Point.y >= Top && Point.y < Bottom;
+		}
+
+		/*
+		 * returns the rectangle that is the intersection of this rectangle and other
+		 * @param bOutOverlapping set to false when the two rectangles don't overlap, the returned rectangle is then empty
+		 */
+		FSlateRect IntersectionWith(const FSlateRect& Other, bool& bOutOverlapping) const
+		{
+			FSlateRect Intersected(std::max(Left, Other.Left), std::max(Top, Other.Top), std::min(Right, Other.Right), std::min(Bottom, Other.Bottom));
+			if (Intersected.Right <= Intersected.Left || Intersected.Bottom <= Intersected.Top)
+			{
+				bOutOverlapping = false;
+				return FSlateRect(0.0f, 0.0f, 0.0f, 0.0f);
+			}
+			bOutOverlapping = true;
+			return Intersected;
+		}
+
+		FSlateRect IntersectionWith(const FSlateRect& Other) const
+		{
+			bool bOverlapping;
+			return IntersectionWith(Other, bOverlapping);
+		}
+
+		/* returns the smallest rectangle that contains both this rectangle and other */
+		FSlateRect Expand(const FSlateRect& Other) const
+		{
+			return FSlateRect(std::min(Left, Other.Left), std::min(Top, Other.Top), std::max(Right, Other.Right), std::max(Bottom, Other.Bottom));
+		}
+
+		/* returns true if the rectangle A and B overlap, touching edges are not considered as overlapping */
+		static bool DoRectanglesIntersect(const FSlateRect& A, const FSlateRect& B)
+		{
+			return A.Left < B.Right && B.Left < A.Right && A.Top < B.Bottom && B.Top < A.Bottom;
+		}
+
+		/* returns true if the rectangle inner is completely inside the rectangle outer */
+		static bool IsRectangleContained(const FSlateRect& Outer, const FSlateRect& Inner)
+		{
+			return Outer.Left <= Inner.Left && Outer.Right >= Inner.Right && Outer.Top <= Inner.Top && Outer.Bottom >= Inner.Bottom;
+		}
+
+		bool operator==(const FSlateRect& Other) const
+		{
+			return Left == Other.Left && Top == Other.Top && Right == Other.Right && Bottom == Other.Bottom;
+		}
+
+		bool operator!=(const FSlateRect& Other) const
+		{
+			return !(*this == Other);
+		}
+
 	private:
 
 	};
@@ -0,0 +1,204 @@
+#include "WidgetPath.h"
+#include "SlateCore/Layout/ParallelLayout.h"
+#include "SlateCore/Widgets/SWindow.h"
+
+namespace ZeroUI
+{
+	FWidgetPath::FWidgetPath()
+		: Widgets(EVisibility::All)
+	{
+	}
+
+	FWidgetPath::FWidgetPath(const Ref<SWindow>& InTopLevelWindow, const FArrangedWidgetTree& Tree, int32_t NodeIndex)
+		: Widgets(EVisibility::All)
+		, TopLevelWindow(InTopLevelWindow)
+	{
+		// the parent links lead from the node up to the root, the path is reversed once it's complete
+		for (; NodeIndex != INDEX_NONE; NodeIndex = Tree[NodeIndex].ParentIndex)
+		{
+			Widgets.AddWidget(Tree[NodeIndex].ArrangedWidget);
+		}
+		Widgets.Reverse();
+	}
+
+	int32_t FWidgetPath::FindWidgetIndex(const SWidget* Widget) const
+	{
+		for (int32_t Index = 0; Index < Widgets.Num(); ++Index)
+		{
+			if (Widgets[Index].GetWidgetPtr() == Widget)
+			{
+				return Index;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	const FArrangedWidget* FWidgetPath::FindArrangedWidget(const SWidget* Widget) const
+	{
+		const int32_t Index = FindWidgetIndex(Widget);
+		return Index != INDEX_NONE ? &Widgets[Index] : nullptr;
+	}
+
+	FWidgetPath FWidgetPath::GetPathDownTo(const SWidget* MarkerWidget) const
+	{
+		FWidgetPath Path;
+		const int32_t MarkerIndex = FindWidgetIndex(MarkerWidget);
+		if (MarkerIndex != INDEX_NONE)
+		{
+			Path.TopLevelWindow = TopLevelWindow;
+			Path.Widgets.Reserve(MarkerIndex + 1);
+			for (int32_t Index = 0; Index <= MarkerIndex; ++Index)
+			{
+				Path.Widgets.AddWidget(Widgets[Index]);
+			}
+		}
+		return Path;
+	}
+
+	void FWidgetPath::Empty()
+	{
+		Widgets.Empty();
+		TopLevelWindow.reset();
+	}
+
+	FWeakWidgetPath::FWeakWidgetPath()
+		: m_ArrangeSerial(0)
+	{
+	}
+
+	FWeakWidgetPath::FWeakWidgetPath(const FWidgetPath& InWidgetPath)
+		: m_Window(InWidgetPath.TopLevelWindow)
+		, m_ArrangeSerial(0)
+	{
+		m_Handles.reserve(InWidgetPath.Widgets.Num());
+		for (const FArrangedWidget& ArrangedWidget : InWidgetPath.Widgets)
+		{
+			m_Handles.push_back(ArrangedWidget.GetWidgetPtr()->GetHandle());
+		}
+		// the nodes are looked up by the first update
+		m_NodeIndices.resize(m_Handles.size(), INDEX_NONE);
+	}
+
+	bool FWeakWidgetPath::ContainsWidget(const SWidget* Widget) const
+	{
+		return Widget && std::find(m_Handles.begin(), m_Handles.end(), Widget->GetHandle()) != m_Handles.end();
+	}
+
+	int32_t FWeakWidgetPath::Revalidate()
+	{
+		const Ref<SWindow> Window = m_Window.lock();
+
+		uint32_t NumValid = 0;
+		const SWidget* Parent = nullptr;
+		for (; Window && NumValid < m_Handles.size(); ++NumValid)
+		{
+			// a stale generation means the widget is destroyed, another parent means it was moved
+			const SWidget* Widget = m_Handles[NumValid].Resolve();
+			if (!Widget || (NumValid == 0 ? Widget != Window.get() : Widget->GetParentWidget() != Parent))
+			{
+				break;
+			}
+			Parent = Widget;
+		}
+
+		m_Handles.resize(NumValid);
+		m_NodeIndices.resize(NumValid);
+		return static_cast<int32_t>(NumValid);
+	}
+
+	bool FWeakWidgetPath::UpdateWidgetPath(FWidgetPath& InOutPath)
+	{
+		Revalidate();
+
+		const Ref<SWindow> Window = m_Window.lock();
+		if (!Window || m_Handles.empty())
+		{
+			Empty();
+			InOutPath.Empty();
+			return false;
+		}
+
+		// the window isn't arranged yet, the path is kept until it is
+		const FArrangedWidgetTree& Tree = Window->GetArrangedWidgets();
+		if (Tree.Num() == 0)
+		{
+			InOutPath.Empty();
+			return false;
+		}
+
+		if (m_ArrangeSerial == Tree.GetArrangeSerial()
+			&& InOutPath.TopLevelWindow == Window
+			&& InOutPath.Widgets.Num() == Num()
+			&& InOutPath.GetLastWidget().GetWidgetPtr() == GetLastWidget())
+		{
+			return true;
+		}
+
+		if (m_ArrangeSerial != Tree.GetArrangeSerial())
+		{
+			// the nodes that still hold their widget under the same parent node are kept, the others are looked up
+			for (uint32_t Index = 0; Index < m_Handles.size(); ++Index)
+			{
+				const SWidget* Widget = m_Handles[Index].Resolve();
+				const int32_t ParentNodeIndex = Index == 0 ? INDEX_NONE : m_NodeIndices[Index - 1];
+
+				int32_t NodeIndex = m_NodeIndices[Index];
+				const bool bNodeIsValid = NodeIndex >= 0 && NodeIndex < Tree.Num()
+					&& Tree[NodeIndex].ArrangedWidget.GetWidgetPtr() == Widget
+					&& Tree[NodeIndex].ParentIndex == ParentNodeIndex;
+				if (!bNodeIsValid)
+				{
+					NodeIndex = Index == 0
+						? (Tree[0].ArrangedWidget.GetWidgetPtr() == Widget ? 0 : INDEX_NONE)
+						: FindChildNode(Tree, ParentNodeIndex, Widget);
+				}
+
+				// the widget isn't arranged anymore, e.g. it's collapsed
+				if (NodeIndex == INDEX_NONE)
+				{
+					m_Handles.resize(Index);
+					m_NodeIndices.resize(Index);
+					break;
+				}
+				m_NodeIndices[Index] = NodeIndex;
+			}
+			m_ArrangeSerial = Tree.GetArrangeSerial();
+		}
+
+		InOutPath.Empty();
+		if (m_Handles.empty())
+		{
+			return false;
+		}
+
+		InOutPath.TopLevelWindow = Window;
+		InOutPath.Widgets.Reserve(Num());
+		for (const int32_t NodeIndex : m_NodeIndices)
+		{
+			InOutPath.Widgets.AddWidget(Tree[NodeIndex].ArrangedWidget);
+		}
+		return true;
+	}
+
+	void FWeakWidgetPath::Empty()
+	{
+		m_Window.reset();
+		m_Handles.clear();
+		m_NodeIndices.clear();
+		m_ArrangeSerial = 0;
+	}
+
+	int32_t FWeakWidgetPath::FindChildNode(const FArrangedWidgetTree& Tree, int32_t ParentNodeIndex, const SWidget* Widget)
+	{
+		// the children of a node follow it, the subtree of each child is skipped
+		const int32_t SubtreeEnd = Tree[ParentNodeIndex].SubtreeEnd;
+		for (int32_t ChildIndex = ParentNodeIndex + 1; ChildIndex < SubtreeEnd; ChildIndex = Tree[ChildIndex].SubtreeEnd)
+		{
+			if (Tree[ChildIndex].ArrangedWidget.GetWidgetPtr() == Widget)
+			{
+				return ChildIndex;
+			}
+		}
+		return INDEX_NONE;
+	}
+}
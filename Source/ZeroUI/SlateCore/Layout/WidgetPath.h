@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Core.h"
+#include "Core/Containers/InlineVector.h"
+#include "SlateCore/Layout/ArrangedWidget.h"
+#include "SlateCore/Widgets/WidgetHandle.h"
+
+namespace ZeroUI
+{
+	class SWidget;
+	class SWindow;
+	class FArrangedWidgetTree;
+
+	/*
+	 * the arranged widgets from a window down to a widget, the events are routed along it
+	 * the widgets are in a contiguous array, the root first, bubbling an event walks it backward from the last widget
+	 */
+	class FWidgetPath
+	{
+	public:
+		FWidgetPath();
+
+		/* the path from the root of the tree down to the node, the tree is the arranged tree of the window */
+		FWidgetPath(const Ref<SWindow>& InTopLevelWindow, const FArrangedWidgetTree& Tree, int32_t NodeIndex);
+
+		/* returns true when the path leads to a widget */
+		bool IsValid() const { return Widgets.Num() > 0; }
+
+		const Ref<SWindow>& GetWindow() const { return TopLevelWindow; }
+
+		/* the widget the path leads to, the path must be valid */
+		const FArrangedWidget& GetLastWidget() const { return Widgets.Last(); }
+
+		/* returns the index of the widget in the path, INDEX_NONE when it's not in the path */
+		int32_t FindWidgetIndex(const SWidget* Widget) const;
+
+		bool ContainsWidget(const SWidget* Widget) const { return FindWidgetIndex(Widget) != INDEX_NONE; }
+
+		/* returns the arranged widget of the widget in the path, null when it's not in the path */
+		const FArrangedWidget* FindArrangedWidget(const SWidget* Widget) const;
+
+		/* the path from the root down to the widget included, an invalid path when the widget is not in this path */
+		FWidgetPath GetPathDownTo(const SWidget* MarkerWidget) const;
+
+		void Empty();
+
+	public:
+		/* root first, the widgets are added whatever their visibility */
+		FArrangedChildren Widgets;
+
+		Ref<SWindow> TopLevelWindow;
+	};
+
+	/*
+	 * a widget path that is kept between the frames, e.g. the path of the focused widget
+	 * the widgets are referenced by their handles. the path is revalidated with the handle generations and the parent
+	 * links, a destroyed or reparented widget cuts the path at its parent. the nodes of the arranged tree are cached so
+	 * the arranged path is only looked up again when the window was arranged since, and then only from the first node
+	 * that moved. routing an event along an unchanged path doesn't rebuild it.
+	 */
+	class FWeakWidgetPath
+	{
+	public:
+		/* most paths are not deeper than this, they are kept without allocating */
+		static constexpr uint32_t NumInlineWidgets = 16;
+
+		FWeakWidgetPath();
+
+		explicit FWeakWidgetPath(const FWidgetPath& InWidgetPath);
+
+		bool IsEmpty() const { return m_Handles.empty(); }
+
+		int32_t Num() const { return static_cast<int32_t>(m_Handles.size()); }
+
+		/* the widget the path leads to, null when the path is empty or the widget is destroyed */
+		SWidget* GetLastWidget() const { return m_Handles.empty() ? nullptr : m_Handles.back().Resolve(); }
+
+		/* returns true if the widget is in the path, the path isn't revalidated */
+		bool ContainsWidget(const SWidget* Widget) const;
+
+		/*
+		 * cuts the path at the first widget that is destroyed or isn't the child of the previous widget anymore
+		 * @return the number of widgets left
+		 */
+		int32_t Revalidate();
+
+		/*
+		 * revalidates the path and brings the arranged path up to date with the last arrange of the window
+		 * InOutPath is the path filled by the last call, it's left as it is when nothing changed since
+		 * @return false when the path is empty, e.g. the window is destroyed
+		 */
+		bool UpdateWidgetPath(FWidgetPath& InOutPath);
+
+		void Empty();
+
+	private:
+		/* returns the node of the widget among the children of the parent node, INDEX_NONE when it isn't arranged */
+		static int32_t FindChildNode(const FArrangedWidgetTree& Tree, int32_t ParentNodeIndex, const SWidget* Widget);
+
+	private:
+		Weak<SWindow> m_Window;
+
+		/* the widgets from the window down, the window first */
+		TInlineVector<FWidgetHandle, NumInlineWidgets> m_Handles;
+
+		/* the node of each widget in the arranged tree of the window, INDEX_NONE when it isn't looked up yet */
+		TInlineVector<int32_t, NumInlineWidgets> m_NodeIndices;
+
+		/* the arrange of the tree the nodes were found in */
+		uint32_t m_ArrangeSerial;
+	};
+}
@@ -0,0 +1,110 @@
+#include "DamageRegion.h"
+
+namespace ZeroUI
+{
+	void FSlateDamageRegion::AddRect(const FSlateRect& Rect)
+	{
+		if (!m_bFull && !Rect.IsEmpty())
+		{
+			m_Rects.push_back(Rect);
+		}
+	}
+
+	void FSlateDamageRegion::Merge(const FSlateRect& WindowRect, int32_t MaxRects)
+	{
+		if (m_bFull)
+		{
+			m_Rects.clear();
+			return;
+		}
+
+		// clip to the window, the parts outside are never presented
+		m_Rects.erase(std::remove_if(m_Rects.begin(), m_Rects.end(), [&WindowRect](FSlateRect& Rect)
+		{
+			bool bOverlapping;
+			Rect = Rect.IntersectionWith(WindowRect, bOverlapping);
+			return !bOverlapping;
+		}), m_Rects.end());
+
+		// e.g. a layout change that moves every widget, the merged rectangles would cover the window anyway
+		const float FullRedrawArea = WindowRect.GetArea() * FullRedrawAreaRatio;
+		const bool bCoversWindow = std::any_of(m_Rects.begin(), m_Rects.end(), [FullRedrawArea](const FSlateRect& Rect) { return Rect.GetArea() >= FullRedrawArea; });
+		if (bCoversWindow || static_cast<int32_t>(m_Rects.size()) > MaxRectsToMerge)
+		{
+			m_Rects.clear();
+			m_bFull = true;
+			return;
+		}
+
+		// the overlapping rectangles would draw the same pixels twice
+		bool bMerged = true;
+		while (bMerged)
+		{
+			bMerged = false;
+			for (size_t IndexA = 0; IndexA < m_Rects.size() && !bMerged; ++IndexA)
+			{
+				for (size_t IndexB = IndexA + 1; IndexB < m_Rects.size(); ++IndexB)
+				{
+					if (FSlateRect::DoRectanglesIntersect(m_Rects[IndexA], m_Rects[IndexB]))
+					{
+						m_Rects[IndexA] = m_Rects[IndexA].Expand(m_Rects[IndexB]);
+						m_Rects.erase(m_Rects.begin() + IndexB);
+						bMerged = true;
+						break;
+					}
+				}
+			}
+		}
+
+		// merge the pairs that add the least area to the union until there are few enough rectangles
+		while (static_cast<int32_t>(m_Rects.size()) > std::max(MaxRects, 1))
+		{
+			size_t BestA = 0;
+			size_t BestB = 1;
+			float BestWaste = std::numeric_limits<float>::max();
+			for (size_t IndexA = 0; IndexA < m_Rects.size(); ++IndexA)
+			{
+				for (size_t IndexB = IndexA + 1; IndexB < m_Rects.size(); ++IndexB)
+				{
+					const float Waste = m_Rects[IndexA].Expand(m_Rects[IndexB]).GetArea() - m_Rects[IndexA].GetArea() - m_Rects[IndexB].GetArea();
+					if (Waste < BestWaste)
+					{
+						BestWaste = Waste;
+						BestA = IndexA;
+						BestB = IndexB;
+					}
+				}
+			}
+
+			m_Rects[BestA] = m_Rects[BestA].Expand(m_Rects[BestB]);
+			m_Rects.erase(m_Rects.begin() + BestB);
+		}
+
+		float DamagedArea = 0.0f;
+		for (const FSlateRect& Rect : m_Rects)
+		{
+			DamagedArea += Rect.GetArea();
+		}
+
+		if (DamagedArea >= FullRedrawArea)
+		{
+			m_Rects.clear();
+			m_bFull = true;
+		}
+	}
+
+	FSlateRect FSlateDamageRegion::GetBounds(const FSlateRect& WindowRect) const
+	{
+		if (m_bFull || m_Rects.empty())
+		{
+			return m_bFull ? WindowRect : FSlateRect(0.0f, 0.0f, 0.0f, 0.0f);
+		}
+
+		FSlateRect Bounds = m_Rects[0];
+		for (const FSlateRect& Rect : m_Rects)
+		{
+			Bounds = Bounds.Expand(Rect);
+		}
+		return Bounds;
+	}
+}
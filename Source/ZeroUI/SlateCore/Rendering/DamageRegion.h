@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Core.h"
+#include "Core/Containers/InlineVector.h"
+#include "SlateCore/Layout/SlteRect.h"
+
+namespace ZeroUI
+{
+	/*
+	 * the parts of a window that changed since the last frame, in window space
+	 * the rectangles of the changed widgets are accumulated during the frame, then merged into a few rectangles so the
+	 * renderer only has a few scissor rectangles to draw. when most of the window changed the whole window is redrawn.
+	 */
+	class FSlateDamageRegion
+	{
+	public:
+		/* the renderer draws each rectangle separately, more rectangles cost more draw passes */
+		static constexpr int32_t DefaultMaxRects = 4;
+
+		/* above this part of the window the whole window is redrawn */
+		static constexpr float FullRedrawAreaRatio = 0.75f;
+
+		/* the merge is quadratic in the rectangles, above this many the whole window is redrawn without merging them */
+		static constexpr int32_t MaxRectsToMerge = 64;
+
+		/* add a changed area, the empty rectangles are ignored */
+		void AddRect(const FSlateRect& Rect);
+
+		/* the whole window must be redrawn, e.g. after a resize or on the first frame */
+		void SetFull() { m_bFull = true; }
+
+		/*
+		 * clip the rectangles to the window and merge them, the overlapping rectangles are merged first then the
+		 * rectangles whose union wastes the least area until there are at most MaxRects
+		 * the whole window is damaged without merging when there are too many rectangles, or one of them covers most of it
+		 */
+		void Merge(const FSlateRect& WindowRect, int32_t MaxRects = DefaultMaxRects);
+
+		void Reset()
+		{
+			m_Rects.clear();
+			m_bFull = false;
+		}
+
+		/* nothing changed, the previous frame can be presented again */
+		bool IsEmpty() const { return !m_bFull && m_Rects.empty(); }
+
+		bool IsFull() const { return m_bFull; }
+
+		/* a frame usually changes a few widgets, their rectangles are accumulated without allocating */
+		using FRectArray = TInlineVector<FSlateRect, 16>;
+
+		/* the merged rectangles, empty when the whole window is damaged */
+		const FRectArray& GetRects() const { return m_Rects; }
+
+		/* the rectangle containing all the damaged rectangles */
+		FSlateRect GetBounds(const FSlateRect& WindowRect) const;
+
+	private:
+		FRectArray m_Rects;
+
+		bool m_bFull = false;
+	};
+}
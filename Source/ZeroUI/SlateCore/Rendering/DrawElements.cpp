@@ -0,0 +1,76 @@
+#include "DrawElements.h"
+
+namespace ZeroUI
+{
+	FSlateDrawElement& FSlateDrawElement::MakeBox(FSlateWindowElementList& ElementList, int32_t InLayer, const FPaintGeometry& PaintGeometry, const ZMath::FColor4& InTint)
+	{
+		FSlateDrawElement& Element = ElementList.AddUninitialized();
+		Element.Init(ElementList, EElementType::ET_Box, InLayer, PaintGeometry);
+		Element.m_Tint = InTint;
+		return Element;
+	}
+
+	FSlateDrawElement& FSlateDrawElement::MakeBox(FSlateWindowElementList& ElementList, int32_t InLayer, const FPaintGeometry& PaintGeometry, const FSlateBrush& InBrush, const ZMath::FColor4& InTint)
+	{
+		FSlateDrawElement& Element = ElementList.AddUninitialized();
+		Element.Init(ElementList, EElementType::ET_Box, InLayer, PaintGeometry);
+		Element.m_Tint = (InBrush.IsPlaceholder() ? FSlateBrush::GetPlaceholderColor() : InBrush.GetTint()) * InTint;
+		Element.m_ResourceProxy = InBrush.GetResourceProxy();
+		return Element;
+	}
+
+	FSlateDrawElement& FSlateDrawElement::MakeDebugQuad(FSlateWindowElementList& ElementList, int32_t InLayer, const FPaintGeometry& PaintGeometry)
+	{
+		FSlateDrawElement& Element = ElementList.AddUninitialized();
+		Element.Init(ElementList, EElementType::ET_DebugQuad, InLayer, PaintGeometry);
+		// debug quads are never clipped
+		Element.m_ClippingIndex = INDEX_NONE;
+		return Element;
+	}
+
+	void FSlateDrawElement::Init(FSlateWindowElementList& ElementList, EElementType InElementType, int32_t InLayer, const FPaintGeometry& PaintGeometry)
+	{
+		m_ElementType = InElementType;
+		m_LayerId = InLayer;
+		m_PaintGeometry = PaintGeometry;
+		m_PaintGeometry.CommitTransformsIfUsingLegacyConstructor();
+		m_ClippingIndex = ElementList.GetClippingIndex();
+		m_OwnerWidget = ElementList.GetPaintingWidget();
+	}
+
+	FSlateWindowElementList::FSlateWindowElementList()
+	{
+	}
+
+	FSlateDrawElement& FSlateWindowElementList::AddUninitialized()
+	{
+		return m_DrawElements.emplace_back();
+	}
+
+	int32_t FSlateWindowElementList::PushClip(const FSlateClippingZone& InClipZone)
+	{
+		return m_ClippingManager.PushClip(InClipZone);
+	}
+
+	void FSlateWindowElementList::PopClip()
+	{
+		m_ClippingManager.PopClip();
+	}
+
+	int32_t FSlateWindowElementList::GetClippingIndex() const
+	{
+		return m_ClippingManager.GetClippingIndex();
+	}
+
+	bool FSlateWindowElementList::IsCulled(const FSlateRect& AbsoluteBounds) const
+	{
+		return m_ClippingManager.IsCulled(AbsoluteBounds);
+	}
+
+	void FSlateWindowElementList::ResetElementList()
+	{
+		m_DrawElements.clear();
+		m_ClippingManager.ResetClippingState();
+		m_PaintingWidget = nullptr;
+	}
+}
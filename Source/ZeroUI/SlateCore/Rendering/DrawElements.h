@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Core.h"
+#include "SlateCore/Layout/Clipping.h"
+#include "SlateCore/Layout/PaintGeometry.h"
+#include "SlateCore/Styling/SlateBrush.h"
+#include "SlateCore/Textures/SlateShaderResource.h"
+
+namespace ZeroUI
+{
+	class SWidget;
+
+	/*
+	 * FSlateDrawElement is the building block for slate's rendering interface
+	 * slate describes its visual output as an ordered list of FSlateDrawElement s
+	 */
+	class FSlateDrawElement
+	{
+	public:
+		enum class EElementType : uint8_t
+		{
+			ET_Box,
+			ET_DebugQuad,
+		};
+
+		FSlateDrawElement()
+			: m_ElementType(EElementType::ET_Box)
+			, m_LayerId(0)
+			, m_ClippingIndex(INDEX_NONE)
+			, m_Tint(1.0f, 1.0f, 1.0f, 1.0f)
+		{
+		}
+
+		/*
+		 * creates a box element, the element inherits the active clipping state of the element list
+		 *
+		 * @param ElementList the list of elements to add to
+		 * @param InLayer the layer to draw the element on
+		 * @param PaintGeometry describes the space in which to draw the element
+		 * @param InTint the color to tint the element
+		 */
+		static FSlateDrawElement& MakeBox(class FSlateWindowElementList& ElementList, int32_t InLayer, const FPaintGeometry& PaintGeometry, const ZMath::FColor4& InTint = ZMath::FColor4(1.0f));
+
+		/*
+		 * creates a box element that draws the image of the brush, modulated by the brush tint and InTint
+		 * a brush whose image isn't loaded yet draws the placeholder color
+		 */
+		static FSlateDrawElement& MakeBox(class FSlateWindowElementList& ElementList, int32_t InLayer, const FPaintGeometry& PaintGeometry, const FSlateBrush& InBrush, const ZMath::FColor4& InTint = ZMath::FColor4(1.0f));
+
+		/* creates a quad used for debugging, it's not clipped */
+		static FSlateDrawElement& MakeDebugQuad(class FSlateWindowElementList& ElementList, int32_t InLayer, const FPaintGeometry& PaintGeometry);
+
+		EElementType GetElementType() const { return m_ElementType; }
+
+		int32_t GetLayer() const { return m_LayerId; }
+
+		int32_t GetClippingIndex() const { return m_ClippingIndex; }
+
+		const FPaintGeometry& GetPaintGeometry() const { return m_PaintGeometry; }
+
+		const ZMath::FColor4& GetTint() const { return m_Tint; }
+
+		/* the texture sampled by the element, elements sharing it can be batched together */
+		const FSlateShaderResourceProxy& GetResourceProxy() const { return m_ResourceProxy; }
+
+		/* the widget that painted the element, the batcher keeps its vertices until the widget is invalidated */
+		const SWidget* GetOwnerWidget() const { return m_OwnerWidget; }
+
+	private:
+		void Init(class FSlateWindowElementList& ElementList, EElementType InElementType, int32_t InLayer, const FPaintGeometry& PaintGeometry);
+
+	private:
+		FPaintGeometry m_PaintGeometry;
+
+		EElementType m_ElementType;
+
+		int32_t m_LayerId;
+
+		/* index of the clipping state in the FSlateClippingManager of the element list */
+		int32_t m_ClippingIndex;
+
+		ZMath::FColor4 m_Tint;
+
+		FSlateShaderResourceProxy m_ResourceProxy;
+
+		const SWidget* m_OwnerWidget = nullptr;
+	};
+
+	/*
+	 * represents a top level window and its draw elements
+	 * the element list also owns the clipping manager, widgets push their clipping zone on it while they paint
+	 */
+	class FSlateWindowElementList
+	{
+	public:
+		FSlateWindowElementList();
+
+		FSlateWindowElementList(const FSlateWindowElementList&) = delete;
+		FSlateWindowElementList& operator=(const FSlateWindowElementList&) = delete;
+
+		/* add a new uninitialized element to the list */
+		FSlateDrawElement& AddUninitialized();
+
+		const std::vector<FSlateDrawElement>& GetDrawElements() const { return m_DrawElements; }
+
+		/* push a clipping zone, see FSlateClippingManager::PushClip */
+		int32_t PushClip(const FSlateClippingZone& InClipZone);
+
+		/* pop the last clipping zone */
+		void PopClip();
+
+		/* index of the active clipping state */
+		int32_t GetClippingIndex() const;
+
+		/* the widget being painted, it owns the elements added until it's changed */
+		const SWidget* GetPaintingWidget() const { return m_PaintingWidget; }
+
+		void SetPaintingWidget(const SWidget* InWidget) { m_PaintingWidget = InWidget; }
+
+		/* returns true when the rectangle is outside of the active clipping state, the widget and its children can be skipped */
+		bool IsCulled(const FSlateRect& AbsoluteBounds) const;
+
+		const FSlateClippingManager& GetClippingManager() const { return m_ClippingManager; }
+
+		FSlateClippingManager& GetClippingManager() { return m_ClippingManager; }
+
+		/* remove all the elements and the clipping states, called before painting the window again */
+		void ResetElementList();
+
+	private:
+		/* the draw elements of the window, in paint order */
+		std::vector<FSlateDrawElement> m_DrawElements;
+
+		/* the clipping states pushed while painting */
+		FSlateClippingManager m_ClippingManager;
+
+		const SWidget* m_PaintingWidget = nullptr;
+	};
+}
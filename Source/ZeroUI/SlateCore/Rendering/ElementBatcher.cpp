@@ -0,0 +1,201 @@
+#include "ElementBatcher.h"
+#include "SlateCore/Textures/SlateAsyncImageLoader.h"
+#include "SlateCore/Widgets/SWidgets.h"
+
+namespace ZeroUI
+{
+	void FSlateElementBatcher::AddElements(FSlateBatchData& BatchData, const FSlateWindowElementList& ElementList, const FSlateInvalidatedWidgets& InvalidatedWidgets)
+	{
+		const std::vector<FSlateDrawElement>& DrawElements = ElementList.GetDrawElements();
+
+		UpdateRetainedVertices(BatchData, DrawElements, InvalidatedWidgets);
+
+		m_SortedElements.resize(DrawElements.size());
+		for (uint32_t ElementIndex = 0; ElementIndex < DrawElements.size(); ++ElementIndex)
+		{
+			m_SortedElements[ElementIndex] = ElementIndex;
+		}
+
+		// the paint order of a layer decides what overlaps, it must be kept
+		std::stable_sort(m_SortedElements.begin(), m_SortedElements.end(), [&DrawElements](uint32_t A, uint32_t B)
+		{
+			return DrawElements[A].GetLayer() < DrawElements[B].GetLayer();
+		});
+
+		BatchData.m_Indices.clear();
+		BatchData.m_RenderBatches.clear();
+		BatchData.m_Indices.reserve(DrawElements.size() * 6);
+
+		for (uint32_t ElementIndex : m_SortedElements)
+		{
+			AddQuadIndices(BatchData, DrawElements[ElementIndex], m_ElementFirstVertex[ElementIndex]);
+		}
+	}
+
+	void FSlateElementBatcher::UpdateRetainedVertices(FSlateBatchData& BatchData, const std::vector<FSlateDrawElement>& DrawElements, const FSlateInvalidatedWidgets& InvalidatedWidgets)
+	{
+		const uint64_t BatchIndex = ++BatchData.m_BatchIndex;
+
+		// a defragment moved the atlased textures, the retained UVs point to their old place
+		const uint32_t AtlasGeneration = FSlateAsyncImageLoader::Get().GetAtlas().GetGeneration();
+		const bool bAtlasMoved = BatchData.m_AtlasGeneration != AtlasGeneration;
+		BatchData.m_AtlasGeneration = AtlasGeneration;
+
+		// count the elements of every widget, an element is placed in the range of its widget by its paint order
+		m_ElementFirstVertex.resize(DrawElements.size());
+		m_ElementRanges.resize(DrawElements.size());
+		for (size_t ElementIndex = 0; ElementIndex < DrawElements.size(); ++ElementIndex)
+		{
+			const SWidget* OwnerWidget = DrawElements[ElementIndex].GetOwnerWidget();
+			FSlateBatchData::FWidgetVertexRange& Range = BatchData.m_WidgetRanges[OwnerWidget ? OwnerWidget->GetHandle() : FWidgetHandle()];
+			if (Range.BatchIndex != BatchIndex)
+			{
+				Range.BatchIndex = BatchIndex;
+				Range.NumElementsInBatch = 0;
+			}
+			m_ElementFirstVertex[ElementIndex] = Range.NumElementsInBatch++ * 4;
+			m_ElementRanges[ElementIndex] = &Range;
+		}
+
+		for (auto RangeIt = BatchData.m_WidgetRanges.begin(); RangeIt != BatchData.m_WidgetRanges.end();)
+		{
+			FSlateBatchData::FWidgetVertexRange& Range = RangeIt->second;
+
+			// the widget wasn't painted, it's removed or hidden
+			if (Range.BatchIndex != BatchIndex)
+			{
+				BatchData.m_NumDeadVertices += Range.Capacity;
+				RangeIt = BatchData.m_WidgetRanges.erase(RangeIt);
+				continue;
+			}
+
+			// the elements without a widget are never retained
+			Range.bRegenerate = bAtlasMoved
+				|| RangeIt->first.IsNull()
+				|| Range.NumElements != Range.NumElementsInBatch
+				|| InvalidatedWidgets.Contains(RangeIt->first);
+
+			const uint32_t NumVertices = Range.NumElementsInBatch * 4;
+			if (NumVertices > Range.Capacity)
+			{
+				BatchData.m_NumDeadVertices += Range.Capacity;
+				Range.VertexOffset = static_cast<uint32_t>(BatchData.m_Vertices.size());
+				Range.Capacity = NumVertices;
+				BatchData.m_Vertices.resize(BatchData.m_Vertices.size() + NumVertices);
+			}
+			else
+			{
+				// the tail of a range that shrunk is dead
+				BatchData.m_NumDeadVertices += Range.Capacity - NumVertices;
+				Range.Capacity = NumVertices;
+			}
+			Range.NumElements = Range.NumElementsInBatch;
+
+			++RangeIt;
+		}
+
+		const size_t NumLiveVertices = BatchData.m_Vertices.size() - BatchData.m_NumDeadVertices;
+		if (BatchData.m_NumDeadVertices >= MinDeadVerticesToCompact && BatchData.m_NumDeadVertices > NumLiveVertices)
+		{
+			CompactVertices(BatchData);
+		}
+
+		uint32_t NumGeneratedVertices = 0;
+		for (size_t ElementIndex = 0; ElementIndex < DrawElements.size(); ++ElementIndex)
+		{
+			const FSlateBatchData::FWidgetVertexRange& Range = *m_ElementRanges[ElementIndex];
+			m_ElementFirstVertex[ElementIndex] += Range.VertexOffset;
+			if (Range.bRegenerate)
+			{
+				WriteQuadVertices(&BatchData.m_Vertices[m_ElementFirstVertex[ElementIndex]], DrawElements[ElementIndex]);
+				NumGeneratedVertices += 4;
+			}
+		}
+		BatchData.m_NumGeneratedVertices = NumGeneratedVertices;
+	}
+
+	void FSlateElementBatcher::CompactVertices(FSlateBatchData& BatchData)
+	{
+		std::vector<FSlateBatchData::FWidgetVertexRange*> Ranges;
+		Ranges.reserve(BatchData.m_WidgetRanges.size());
+		for (auto& [Widget, Range] : BatchData.m_WidgetRanges)
+		{
+			Ranges.push_back(&Range);
+		}
+
+		// in buffer order every range moves towards the start, it never overwrites a range that isn't moved yet
+		std::sort(Ranges.begin(), Ranges.end(), [](const FSlateBatchData::FWidgetVertexRange* A, const FSlateBatchData::FWidgetVertexRange* B)
+		{
+			return A->VertexOffset < B->VertexOffset;
+		});
+
+		uint32_t WriteOffset = 0;
+		for (FSlateBatchData::FWidgetVertexRange* Range : Ranges)
+		{
+			if (Range->VertexOffset != WriteOffset && !Range->bRegenerate)
+			{
+				std::copy(BatchData.m_Vertices.begin() + Range->VertexOffset, BatchData.m_Vertices.begin() + Range->VertexOffset + Range->Capacity, BatchData.m_Vertices.begin() + WriteOffset);
+			}
+			Range->VertexOffset = WriteOffset;
+			WriteOffset += Range->Capacity;
+		}
+
+		BatchData.m_Vertices.resize(WriteOffset);
+		BatchData.m_NumDeadVertices = 0;
+	}
+
+	void FSlateElementBatcher::WriteQuadVertices(FSlateVertex* OutVertices, const FSlateDrawElement& DrawElement)
+	{
+		const FPaintGeometry& PaintGeometry = DrawElement.GetPaintGeometry();
+		const FSlateRenderTransform& RenderTransform = PaintGeometry.GetAccumulatedRenderTransform();
+		const ZMath::vec2& LocalSize = PaintGeometry.GetLocalSize();
+
+		const FSlateShaderResourceProxy& ResourceProxy = DrawElement.GetResourceProxy();
+		const ZMath::vec2& StartUV = ResourceProxy.StartUV;
+		const ZMath::vec2 EndUV = ResourceProxy.StartUV + ResourceProxy.SizeUV;
+		const ZMath::FColor4& Color = DrawElement.GetTint();
+
+		OutVertices[0] = FSlateVertex{ RenderTransform.TransformPoint(ZMath::vec2(0.0f, 0.0f)), StartUV, Color };
+		OutVertices[1] = FSlateVertex{ RenderTransform.TransformPoint(ZMath::vec2(LocalSize.x, 0.0f)), ZMath::vec2(EndUV.x, StartUV.y), Color };
+		OutVertices[2] = FSlateVertex{ RenderTransform.TransformPoint(ZMath::vec2(0.0f, LocalSize.y)), ZMath::vec2(StartUV.x, EndUV.y), Color };
+		OutVertices[3] = FSlateVertex{ RenderTransform.TransformPoint(LocalSize), EndUV, Color };
+	}
+
+	void FSlateElementBatcher::AddQuadIndices(FSlateBatchData& BatchData, const FSlateDrawElement& DrawElement, uint32_t FirstVertex)
+	{
+		FSlateRenderBatch& RenderBatch = FindOrCreateBatch(BatchData, DrawElement);
+
+		// 0 - 1
+		// | \ |
+		// 2 - 3
+		const uint32_t QuadIndices[6] = { 0, 1, 3, 0, 3, 2 };
+		for (uint32_t QuadIndex : QuadIndices)
+		{
+			BatchData.m_Indices.push_back(FirstVertex + QuadIndex);
+		}
+		RenderBatch.NumIndices += 6;
+	}
+
+	FSlateRenderBatch& FSlateElementBatcher::FindOrCreateBatch(FSlateBatchData& BatchData, const FSlateDrawElement& DrawElement)
+	{
+		const void* Resource = DrawElement.GetResourceProxy().Resource;
+		if (!BatchData.m_RenderBatches.empty())
+		{
+			FSlateRenderBatch& LastBatch = BatchData.m_RenderBatches.back();
+			if (LastBatch.LayerId == DrawElement.GetLayer()
+				&& LastBatch.ClippingIndex == DrawElement.GetClippingIndex()
+				&& LastBatch.Resource == Resource)
+			{
+				return LastBatch;
+			}
+		}
+
+		FSlateRenderBatch NewBatch;
+		NewBatch.LayerId = DrawElement.GetLayer();
+		NewBatch.ClippingIndex = DrawElement.GetClippingIndex();
+		NewBatch.Resource = Resource;
+		NewBatch.IndexOffset = static_cast<uint32_t>(BatchData.m_Indices.size());
+		NewBatch.NumIndices = 0;
+		return BatchData.m_RenderBatches.emplace_back(NewBatch);
+	}
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Core.h"
+#include "SlateCore/Rendering/DrawElements.h"
+#include "SlateCore/Widgets/WidgetHandle.h"
+
+namespace ZeroUI
+{
+	class SWidget;
+
+	struct FSlateVertex
+	{
+		ZMath::vec2 Position;
+		ZMath::vec2 TexCoords;
+		ZMath::FColor4 Color;
+	};
+
+	/* a range of indices drawn with the same state, one draw call for the renderer */
+	struct FSlateRenderBatch
+	{
+		int32_t LayerId;
+
+		/* index of the clipping state in the clipping manager of the element list */
+		int32_t ClippingIndex;
+
+		/* the texture of the batch, null for solid colors */
+		const void* Resource;
+
+		uint32_t IndexOffset;
+		uint32_t NumIndices;
+	};
+
+	/*
+	 * the widgets whose draw elements changed since the last batch of a window, their vertices are generated again
+	 * the widgets are kept by handle, a widget created at the address of a destroyed one doesn't match it
+	 */
+	class FSlateInvalidatedWidgets
+	{
+	public:
+		void Add(FWidgetHandle Widget) { m_Widgets.insert(Widget); }
+
+		/* every widget changed, e.g. the whole window is redrawn */
+		void InvalidateAll() { m_bAll = true; }
+
+		bool Contains(FWidgetHandle Widget) const { return m_bAll || m_Widgets.count(Widget) != 0; }
+
+		void Reset()
+		{
+			m_Widgets.clear();
+			m_bAll = false;
+		}
+
+	private:
+		std::unordered_set<FWidgetHandle> m_Widgets;
+
+		bool m_bAll = false;
+	};
+
+	/*
+	 * the vertices, indices and batches of a window
+	 * the vertices are retained between the batches: every widget owns a range of the vertex buffer, only the ranges of
+	 * the invalidated widgets are generated again. the indices and the batches are built again by every batch, they
+	 * depend on the layers of the whole window.
+	 */
+	class FSlateBatchData
+	{
+	public:
+		/* the vertex buffer, it contains the unused ranges of the removed widgets until it's compacted */
+		const std::vector<FSlateVertex>& GetVertices() const { return m_Vertices; }
+
+		const std::vector<uint32_t>& GetIndices() const { return m_Indices; }
+
+		const std::vector<FSlateRenderBatch>& GetRenderBatches() const { return m_RenderBatches; }
+
+		int32_t GetNumBatches() const { return static_cast<int32_t>(m_RenderBatches.size()); }
+
+		/* the number of vertices generated by the last batch, the others were kept */
+		uint32_t GetNumGeneratedVertices() const { return m_NumGeneratedVertices; }
+
+		/* the generation of the texture atlas when the vertices were generated, their UVs are stale once it changes */
+		uint32_t GetAtlasGeneration() const { return m_AtlasGeneration; }
+
+		/* drops the retained vertices, the next batch generates all of them */
+		void ResetData()
+		{
+			m_Vertices.clear();
+			m_Indices.clear();
+			m_RenderBatches.clear();
+			m_WidgetRanges.clear();
+			m_NumDeadVertices = 0;
+			m_NumGeneratedVertices = 0;
+		}
+
+	private:
+		friend class FSlateElementBatcher;
+
+		/* the vertices of the elements of a widget, 4 per element in paint order */
+		struct FWidgetVertexRange
+		{
+			uint32_t VertexOffset = 0;
+
+			/* the vertices reserved for the widget, the range moves to the end of the buffer when it grows */
+			uint32_t Capacity = 0;
+
+			uint32_t NumElements = 0;
+
+			/* the elements counted during the current batch */
+			uint32_t NumElementsInBatch = 0;
+
+			uint64_t BatchIndex = 0;
+
+			bool bRegenerate = false;
+		};
+
+		std::vector<FSlateVertex> m_Vertices;
+		std::vector<uint32_t> m_Indices;
+		std::vector<FSlateRenderBatch> m_RenderBatches;
+
+		/* the range of every painting widget, the elements without a widget share the range of the null handle */
+		std::unordered_map<FWidgetHandle, FWidgetVertexRange> m_WidgetRanges;
+
+		/* the vertices that no range uses anymore */
+		size_t m_NumDeadVertices = 0;
+
+		uint64_t m_BatchIndex = 0;
+
+		uint32_t m_NumGeneratedVertices = 0;
+
+		uint32_t m_AtlasGeneration = 0;
+	};
+
+	/*
+	 * turns the draw elements of a window into batches of quads
+	 * the elements are sorted by layer, the order of the elements of the same layer is kept.
+	 * consecutive elements with the same layer, clipping and texture share a batch, the brushes that live in the same
+	 * atlas page are merged even when they come from different widgets.
+	 */
+	class FSlateElementBatcher
+	{
+	public:
+		/* the buffer is compacted when the dead vertices outnumber the live ones, and are at least this many */
+		static constexpr size_t MinDeadVerticesToCompact = 1024;
+
+		/*
+		 * builds the batches of the element list, the indices and the batches of the last call are replaced
+		 * the vertices of the widgets that aren't invalidated are kept, the cost of the vertex generation is proportional
+		 * to the elements of the invalidated widgets. all of them are generated again when the texture atlas was
+		 * defragmented since the last batch.
+		 */
+		void AddElements(FSlateBatchData& BatchData, const FSlateWindowElementList& ElementList, const FSlateInvalidatedWidgets& InvalidatedWidgets);
+
+	private:
+		/* assigns the vertices of every element, and generates the vertices of the invalidated widgets */
+		void UpdateRetainedVertices(FSlateBatchData& BatchData, const std::vector<FSlateDrawElement>& DrawElements, const FSlateInvalidatedWidgets& InvalidatedWidgets);
+
+		/* moves the ranges to the start of the buffer, in buffer order, the dead vertices are dropped */
+		static void CompactVertices(FSlateBatchData& BatchData);
+
+		static void WriteQuadVertices(FSlateVertex* OutVertices, const FSlateDrawElement& DrawElement);
+
+		void AddQuadIndices(FSlateBatchData& BatchData, const FSlateDrawElement& DrawElement, uint32_t FirstVertex);
+
+		/* the batch for the element, the last batch when the state matches or a new one */
+		FSlateRenderBatch& FindOrCreateBatch(FSlateBatchData& BatchData, const FSlateDrawElement& DrawElement);
+
+	private:
+		/* indices of the elements sorted by layer, kept between frames to avoid the allocation */
+		std::vector<uint32_t> m_SortedElements;
+
+		/* the first vertex of every element, and the range of its widget */
+		std::vector<uint32_t> m_ElementFirstVertex;
+		std::vector<FSlateBatchData::FWidgetVertexRange*> m_ElementRanges;
+	};
+}
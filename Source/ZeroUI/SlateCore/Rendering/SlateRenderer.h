@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Core.h"
+
+namespace ZeroUI
+{
+	class SWindow;
+
+	/* abstract base class for the slate renderers, the renderer draws the batches built by the frame and presents the windows */
+	class FSlateRenderer
+	{
+	public:
+		virtual ~FSlateRenderer() {}
+
+		/*
+		 * draw the batch data of every window and present the back buffers
+		 * only the damage region of a window needs to be redrawn: each of its rectangles is drawn with a scissor rectangle
+		 * and only those rectangles are presented. the whole window is redrawn when the region is full, and the window
+		 * is not drawn at all when the region is empty.
+		 * the vertices are retained between the frames, the vertex buffer can contain ranges no index refers to.
+		 */
+		virtual void DrawWindows(const std::vector<Ref<SWindow>>& InWindows) = 0;
+	};
+}
@@ -1,4 +1,6 @@
 #include "SlotBase.h"
+#include "SlateCore/Layout/Children.h"
+#include "SlateCore/Widgets/SWidgets.h"
 
 namespace ZeroUI
 {
@@ -16,6 +18,8 @@ namespace ZeroUI
 
 	FSlotBase::~FSlotBase()
 	{
+		// the widget can outlive the slot, it's not in the tree of the parent anymore
+		DetachParentFromContent();
 	}
 
 	FSlotBase::FSlotBase(const Ref<SWidget>& InWidget)
@@ -42,8 +46,9 @@ namespace ZeroUI
 	{
 		if(m_Widget != nullptr)
 		{
-			m_Widget->ConditionallyDetachParentWidget(GetOwneridget());
+			m_Widget->ConditionallyDetachParentWidget(GetOwnerWidget());
 		}
+		return std::move(m_Widget);
 	}
 
 	void FSlotBase::DetachParentFromContent()
@@ -56,14 +61,23 @@ namespace ZeroUI
 
 	void FSlotBase::AfterContentOrOwnerAssigned()
 	{
-		if (SWidget* OwnerWidget = GetOwnerWidget())
+		SWidget* OwnerWidget = GetOwnerWidget();
+		if (OwnerWidget && m_Widget)
 		{
 			// TODO NDarnell I want to enable this, but too many places in the codebase
 			// have made assumptions about being able to freely reparent widgets, while they're
 			// still connected to an existing hierarchy.
 			//ensure(!Widget->IsParentValid());
-			m_Widget->AssignParentWidget(OwnerWidget->shared_from_this());
+			m_Widget->AssignParentWidget(*OwnerWidget);
 		}
 	}
+
+	void FSlotBase::Invalidate(EInvalidateWidgetReason InvalidateReason)
+	{
+		// deferred while the children are in a batch update, see FScopedChildrenUpdate
+		if (const FChildren* Children = GetOwner())
+		{
+			Children->InvalidateOwner(InvalidateReason);
+		}
 	}
 }
\ No newline at end of file
@@ -46,7 +46,7 @@ namespace ZeroUI
 
 		void AttachWidget(const Ref<SWidget>& InWidget)
 		{
-			detach_parent_from_content();
+			DetachParentFromContent();
 			m_Widget = InWidget;
 			AfterContentOrOwnerAssigned();
 		}
@@ -67,7 +67,7 @@ namespace ZeroUI
 		*/
 		const Ref<SWidget> DetachWidget();
 
-		/* invalidate the widget's owner */
+		/* invalidate the widget's owner, deferred while the children are in a batch update */
 		void Invalidate(EInvalidateWidgetReason InvalidateReason);
 	protected:
 		/*
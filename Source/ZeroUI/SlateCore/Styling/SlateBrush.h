@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Core.h"
+#include "SlateCore/Textures/SlateImageResource.h"
+#include "SlateCore/Textures/SlateShaderResource.h"
+
+namespace ZeroUI
+{
+	/*
+	 * a brush which contains information about how to draw a slate element
+	 * the image size is known up front so the layout doesn't change when an asynchronously loaded image arrives
+	 */
+	class FSlateBrush
+	{
+	public:
+		/* a brush without image, it's drawn as a solid box of the tint color */
+		FSlateBrush()
+			: m_ImageSize(0.0f, 0.0f)
+			, m_TintColor(1.0f, 1.0f, 1.0f, 1.0f)
+		{
+		}
+
+		FSlateBrush(Ref<FSlateImageResource> InResource, const ZMath::vec2& InImageSize, const ZMath::FColor4& InTintColor = ZMath::FColor4(1.0f))
+			: m_ImageSize(InImageSize)
+			, m_TintColor(InTintColor)
+			, m_Resource(std::move(InResource))
+		{
+		}
+
+		/* the size of the resource in slate units */
+		const ZMath::vec2& GetImageSize() const { return m_ImageSize; }
+
+		void SetImageSize(const ZMath::vec2& InImageSize) { m_ImageSize = InImageSize; }
+
+		const ZMath::FColor4& GetTint() const { return m_TintColor; }
+
+		void SetTint(const ZMath::FColor4& InTintColor) { m_TintColor = InTintColor; }
+
+		/* the path of the image, empty for a brush without image */
+		const std::string& GetResourceName() const
+		{
+			static const std::string NoResourceName;
+			return m_Resource ? m_Resource->GetPath() : NoResourceName;
+		}
+
+		const Ref<FSlateImageResource>& GetResource() const { return m_Resource; }
+
+		/* returns true if the brush has an image that isn't available yet */
+		bool IsPlaceholder() const { return m_Resource && m_Resource->IsPlaceholder(); }
+
+		/* the standalone texture to draw, null for a placeholder, a brush without image or an image in the atlas */
+		const FSlateTextureData* GetTextureData() const
+		{
+			return m_Resource ? m_Resource->GetTextureData().get() : nullptr;
+		}
+
+		/*
+		 * what the renderer samples for this brush, resolved when painting because the atlas can move the texture
+		 * a placeholder, or a brush without image, has no resource and is drawn as a solid color
+		 */
+		FSlateShaderResourceProxy GetResourceProxy() const
+		{
+			FSlateShaderResourceProxy Proxy;
+			if (m_Resource && !m_Resource->IsPlaceholder())
+			{
+				if (const Ref<FSlateAtlasEntry>& AtlasEntry = m_Resource->GetAtlasEntry())
+				{
+					Proxy.Resource = AtlasEntry->Page;
+					Proxy.StartUV = AtlasEntry->GetStartUV();
+					Proxy.SizeUV = AtlasEntry->GetSizeUV();
+				}
+				else
+				{
+					Proxy.Resource = m_Resource->GetTextureData().get();
+				}
+			}
+			return Proxy;
+		}
+
+		/* the color of a brush whose image isn't loaded yet */
+		static ZMath::FColor4 GetPlaceholderColor() { return ZMath::FColor4(0.5f, 0.5f, 0.5f, 0.25f); }
+
+	private:
+		ZMath::vec2 m_ImageSize;
+
+		ZMath::FColor4 m_TintColor;
+
+		/* the image shared with the other brushes of the same file */
+		Ref<FSlateImageResource> m_Resource;
+	};
+}
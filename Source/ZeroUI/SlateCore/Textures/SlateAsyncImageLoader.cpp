@@ -0,0 +1,220 @@
+#include "SlateAsyncImageLoader.h"
+#include "Core/Misc/MappedFile.h"
+#include "SlateCore/Widgets/SWidgets.h"
+#include "stb_image.h"
+
+namespace ZeroUI
+{
+	FSlateAsyncImageLoader& FSlateAsyncImageLoader::Get()
+	{
+		static FSlateAsyncImageLoader Instance;
+		return Instance;
+	}
+
+	FSlateAsyncImageLoader::FSlateAsyncImageLoader()
+		: m_ResidentBytes(0)
+	{
+		// the job system must outlive the loader, the pending jobs are waited on destruction
+		FJobSystem::Get();
+	}
+
+	FSlateAsyncImageLoader::~FSlateAsyncImageLoader()
+	{
+		FJobSystem::Get().Wait(m_PendingLoads);
+	}
+
+	FSlateBrush FSlateAsyncImageLoader::RequestBrush(const std::string& Path, const ZMath::vec2& ImageSize, const Ref<SWidget>& DependentWidget)
+	{
+		return FSlateBrush(RequestImage(Path, DependentWidget), ImageSize);
+	}
+
+	Ref<FSlateImageResource> FSlateAsyncImageLoader::RequestImage(const std::string& Path, const Ref<SWidget>& DependentWidget)
+	{
+		auto It = m_CachedImages.find(Path);
+		if (It == m_CachedImages.end())
+		{
+			m_LruList.push_front(Path);
+
+			FCachedImage NewImage;
+			NewImage.Resource = CreateRef<FSlateImageResource>(Path);
+			NewImage.LruIterator = m_LruList.begin();
+			It = m_CachedImages.emplace(Path, std::move(NewImage)).first;
+
+			const bool bMemoryMapFile = m_Settings.bMemoryMapFiles;
+			FJobSystem::Get().Dispatch(m_PendingLoads, [this, Path, bMemoryMapFile]()
+			{
+				FDecodedImage DecodedImage{ Path, DecodeImage(Path, bMemoryMapFile) };
+
+				std::lock_guard<std::mutex> Lock(m_DecodedImagesMutex);
+				m_DecodedImages.push_back(std::move(DecodedImage));
+			});
+		}
+		else
+		{
+			Touch(It->second);
+		}
+
+		const Ref<FSlateImageResource>& Resource = It->second.Resource;
+		if (DependentWidget)
+		{
+			Resource->AddDependentWidget(DependentWidget);
+		}
+		return Resource;
+	}
+
+	void FSlateAsyncImageLoader::Tick()
+	{
+		std::vector<FDecodedImage> DecodedImages;
+		{
+			std::lock_guard<std::mutex> Lock(m_DecodedImagesMutex);
+			DecodedImages.swap(m_DecodedImages);
+		}
+
+		for (FDecodedImage& DecodedImage : DecodedImages)
+		{
+			auto It = m_CachedImages.find(DecodedImage.Path);
+			if (It == m_CachedImages.end())
+			{
+				continue;
+			}
+
+			FCachedImage& CachedImage = It->second;
+			FSlateImageResource& Resource = *CachedImage.Resource;
+			if (DecodedImage.TextureData)
+			{
+				CachedImage.ResidentBytes = DecodedImage.TextureData->GetDataSize();
+				m_ResidentBytes += CachedImage.ResidentBytes;
+
+				// the pixels are copied in the atlas page, the decoded texture isn't needed anymore
+				Resource.m_AtlasEntry = m_Settings.bUseAtlas ? m_Atlas.AddTexture(*DecodedImage.TextureData) : nullptr;
+				if (!Resource.m_AtlasEntry)
+				{
+					Resource.m_TextureData = std::move(DecodedImage.TextureData);
+				}
+				Resource.m_LoadState = EImageLoadState::Loaded;
+			}
+			else
+			{
+				CORE_LOG_WARN("Failed to load image {0}", DecodedImage.Path);
+				Resource.m_LoadState = EImageLoadState::Failed;
+			}
+
+			// the brush size doesn't depend on the texture, only the paint changes
+			InvalidateDependentWidgets(Resource);
+			if (!Resource.m_AtlasEntry)
+			{
+				Resource.m_DependentWidgets.clear();
+			}
+		}
+
+		if (m_ResidentBytes > m_Settings.MaxResidentBytes)
+		{
+			EvictUnusedImages();
+		}
+
+		if (m_Atlas.ShouldDefragment())
+		{
+			m_Atlas.Defragment();
+
+			// the brushes read the new uv when they are painted again
+			for (auto& [Path, CachedImage] : m_CachedImages)
+			{
+				if (CachedImage.Resource->m_AtlasEntry)
+				{
+					InvalidateDependentWidgets(*CachedImage.Resource);
+				}
+			}
+		}
+	}
+
+	void FSlateAsyncImageLoader::InvalidateDependentWidgets(FSlateImageResource& Resource)
+	{
+		std::vector<Weak<SWidget>>& DependentWidgets = Resource.m_DependentWidgets;
+		for (const Weak<SWidget>& DependentWidget : DependentWidgets)
+		{
+			if (Ref<SWidget> Widget = DependentWidget.lock())
+			{
+				Widget->Invalidate(EInvalidateWidgetReason::Paint);
+			}
+		}
+
+		// the destroyed widgets are dropped, the list of an atlased texture lives as long as the texture
+		DependentWidgets.erase(std::remove_if(DependentWidgets.begin(), DependentWidgets.end(), [](const Weak<SWidget>& Widget)
+		{
+			return Widget.expired();
+		}), DependentWidgets.end());
+	}
+
+	void FSlateAsyncImageLoader::Flush()
+	{
+		FJobSystem::Get().Wait(m_PendingLoads);
+		Tick();
+	}
+
+	FSlateTextureDataPtr FSlateAsyncImageLoader::DecodeImage(const std::string& Path, bool bMemoryMapFile)
+	{
+		constexpr int BytesPerPixel = 4;
+
+		int Width = 0;
+		int Height = 0;
+		int FileChannels = 0;
+		stbi_uc* Pixels = nullptr;
+		if (bMemoryMapFile)
+		{
+			FMappedFile MappedFile;
+			if (!MappedFile.Open(Path) || MappedFile.GetSize() > static_cast<size_t>(std::numeric_limits<int>::max()))
+			{
+				return nullptr;
+			}
+			Pixels = stbi_load_from_memory(MappedFile.GetData(), static_cast<int>(MappedFile.GetSize()), &Width, &Height, &FileChannels, BytesPerPixel);
+		}
+		else
+		{
+			Pixels = stbi_load(Path.c_str(), &Width, &Height, &FileChannels, BytesPerPixel);
+		}
+
+		if (Pixels == nullptr)
+		{
+			return nullptr;
+		}
+
+		const size_t DataSize = static_cast<size_t>(Width) * static_cast<size_t>(Height) * BytesPerPixel;
+		std::vector<uint8_t> Bytes(Pixels, Pixels + DataSize);
+		stbi_image_free(Pixels);
+
+		return CreateRef<FSlateTextureData>(static_cast<uint32_t>(Width), static_cast<uint32_t>(Height), BytesPerPixel, std::move(Bytes));
+	}
+
+	void FSlateAsyncImageLoader::Touch(FCachedImage& CachedImage)
+	{
+		m_LruList.splice(m_LruList.begin(), m_LruList, CachedImage.LruIterator);
+	}
+
+	void FSlateAsyncImageLoader::EvictUnusedImages()
+	{
+		auto LruIt = m_LruList.end();
+		while (m_ResidentBytes > m_Settings.MaxResidentBytes && LruIt != m_LruList.begin())
+		{
+			--LruIt;
+
+			auto CacheIt = m_CachedImages.find(*LruIt);
+			const Ref<FSlateImageResource>& Resource = CacheIt->second.Resource;
+
+			// an image still used by a brush would go back to the placeholder, it stays resident.
+			// a loading image is needed by the decode result.
+			if (Resource.use_count() > 1 || Resource->GetLoadState() == EImageLoadState::Loading)
+			{
+				continue;
+			}
+
+			if (const Ref<FSlateAtlasEntry>& AtlasEntry = Resource->GetAtlasEntry())
+			{
+				m_Atlas.RemoveTexture(AtlasEntry);
+			}
+			m_ResidentBytes -= CacheIt->second.ResidentBytes;
+
+			m_CachedImages.erase(CacheIt);
+			LruIt = m_LruList.erase(LruIt);
+		}
+	}
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Core.h"
+#include "Core/Async/JobSystem.h"
+#include "SlateCore/Styling/SlateBrush.h"
+#include "SlateCore/Textures/SlateTextureAtlas.h"
+
+namespace ZeroUI
+{
+	class SWidget;
+
+	struct FSlateImageLoaderSettings
+	{
+		/* the decoded images that are not used by any brush are evicted, least recently requested first, above this budget */
+		uint64_t MaxResidentBytes = _64MB;
+
+		/* map the files in memory instead of reading them, the os pages the file in while it's decoded */
+		bool bMemoryMapFiles = false;
+
+		/* put the small images in the atlas, their draws can be batched across widgets */
+		bool bUseAtlas = true;
+	};
+
+	/*
+	 * loads the images on the job system
+	 * a request returns right away with a brush that draws a placeholder, the same file is only loaded once.
+	 * Tick, on the main thread, swaps the decoded textures in and invalidates the dependent widgets for paint.
+	 * the image size is given by the request so the layout never depends on the decoded texture.
+	 */
+	class FSlateAsyncImageLoader
+	{
+	public:
+		static FSlateAsyncImageLoader& Get();
+
+		FSlateAsyncImageLoader();
+		~FSlateAsyncImageLoader();
+
+		FSlateAsyncImageLoader(const FSlateAsyncImageLoader&) = delete;
+		FSlateAsyncImageLoader& operator=(const FSlateAsyncImageLoader&) = delete;
+
+		FSlateImageLoaderSettings& GetSettings() { return m_Settings; }
+
+		/*
+		 * returns a brush for the image, a placeholder until the image is decoded
+		 * @param Path the path of the image file, any format supported by stb_image
+		 * @param ImageSize the size of the brush in slate units
+		 * @param DependentWidget the widget to invalidate once the image is available, and when the atlas moves it, can be null
+		 */
+		FSlateBrush RequestBrush(const std::string& Path, const ZMath::vec2& ImageSize, const Ref<SWidget>& DependentWidget = nullptr);
+
+		/* returns the shared image of the file, starts loading it if needed */
+		Ref<FSlateImageResource> RequestImage(const std::string& Path, const Ref<SWidget>& DependentWidget = nullptr);
+
+		/* swap the decoded images in and evict the unused ones, called once per frame on the main thread */
+		void Tick();
+
+		/* block until all the requested images are decoded, then Tick */
+		void Flush();
+
+		/* the memory used by the decoded images */
+		uint64_t GetResidentBytes() const { return m_ResidentBytes; }
+
+		bool HasPendingLoads() const { return !m_PendingLoads.IsDone(); }
+
+		/* the atlas of the small images */
+		const FSlateTextureAtlas& GetAtlas() const { return m_Atlas; }
+
+	private:
+		struct FDecodedImage
+		{
+			std::string Path;
+			/* null when the image can't be read or decoded */
+			FSlateTextureDataPtr TextureData;
+		};
+
+		struct FCachedImage
+		{
+			Ref<FSlateImageResource> Resource;
+			/* position in the lru list */
+			std::list<std::string>::iterator LruIterator;
+			/* the memory used by the decoded image, in the atlas or not */
+			uint64_t ResidentBytes = 0;
+		};
+
+		/* runs on a worker, the decoded image is always RGBA8 */
+		static FSlateTextureDataPtr DecodeImage(const std::string& Path, bool bMemoryMapFile);
+
+		/* move the image at the front of the lru list */
+		void Touch(FCachedImage& CachedImage);
+
+		/* drop the decoded images that no brush uses until the resident bytes fit in the budget */
+		void EvictUnusedImages();
+
+		/* invalidate the paint of the widgets that draw the image */
+		static void InvalidateDependentWidgets(FSlateImageResource& Resource);
+
+	private:
+		FSlateImageLoaderSettings m_Settings;
+
+		/* every requested image, by path, so identical paths share the same resource */
+		std::unordered_map<std::string, FCachedImage> m_CachedImages;
+
+		/* paths of the cached images, most recently requested first */
+		std::list<std::string> m_LruList;
+
+		/* the decoded images waiting for the next Tick, filled by the workers */
+		std::mutex m_DecodedImagesMutex;
+		std::vector<FDecodedImage> m_DecodedImages;
+
+		FSlateTextureAtlas m_Atlas;
+
+		/* the decode jobs in flight */
+		FJobCounter m_PendingLoads;
+
+		uint64_t m_ResidentBytes;
+	};
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Core.h"
+#include "SlateCore/Textures/SlateTextureData.h"
+#include "SlateCore/Textures/SlateTextureAtlas.h"
+
+namespace ZeroUI
+{
+	class SWidget;
+
+	enum class EImageLoadState : uint8_t
+	{
+		/* the image isn't loaded yet */
+		Loading,
+		/* the texture data is available */
+		Loaded,
+		/* the file can't be read or decoded, the placeholder is used forever */
+		Failed,
+	};
+
+	/*
+	 * an image shared by all the brushes of the same file
+	 * the texture data is swapped in on the main thread once it's decoded, until then the brushes draw a placeholder
+	 */
+	class FSlateImageResource
+	{
+	public:
+		explicit FSlateImageResource(std::string InPath)
+			: m_Path(std::move(InPath))
+			, m_LoadState(EImageLoadState::Loading)
+		{
+		}
+
+		const std::string& GetPath() const { return m_Path; }
+
+		EImageLoadState GetLoadState() const { return m_LoadState; }
+
+		/* returns true while the texture isn't available, the brushes draw a placeholder */
+		bool IsPlaceholder() const { return m_LoadState != EImageLoadState::Loaded; }
+
+		/* the decoded texture, null while it's a placeholder or when the texture lives in the atlas */
+		const FSlateTextureDataPtr& GetTextureData() const { return m_TextureData; }
+
+		/* the place of the texture in the atlas, null when the texture isn't atlased */
+		const Ref<FSlateAtlasEntry>& GetAtlasEntry() const { return m_AtlasEntry; }
+
+		/*
+		 * the widget is invalidated for paint when the texture is swapped in
+		 * the widgets of an atlased texture are kept, they are invalidated again when the atlas moves the texture
+		 */
+		void AddDependentWidget(const Ref<SWidget>& InWidget)
+		{
+			if (IsPlaceholder() || m_AtlasEntry)
+			{
+				m_DependentWidgets.push_back(InWidget);
+			}
+		}
+
+	private:
+		friend class FSlateAsyncImageLoader;
+
+		std::string m_Path;
+
+		EImageLoadState m_LoadState;
+
+		FSlateTextureDataPtr m_TextureData;
+
+		Ref<FSlateAtlasEntry> m_AtlasEntry;
+
+		/* widgets waiting for the texture, or drawing the atlased texture */
+		std::vector<Weak<SWidget>> m_DependentWidgets;
+	};
+}
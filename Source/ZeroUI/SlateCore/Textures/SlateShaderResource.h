@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Core.h"
+
+namespace ZeroUI
+{
+	/*
+	 * the texture a draw element samples, and the part of it that is used
+	 * a texture in the atlas uses a sub rect of the page, the elements of the same page can be drawn in a single batch
+	 */
+	struct FSlateShaderResourceProxy
+	{
+		/* the atlas page or the standalone texture data, null to draw a solid color */
+		const void* Resource = nullptr;
+
+		/* the uv of the top left corner */
+		ZMath::vec2 StartUV = ZMath::vec2(0.0f, 0.0f);
+
+		/* the uv size of the used area */
+		ZMath::vec2 SizeUV = ZMath::vec2(1.0f, 1.0f);
+
+		bool operator==(const FSlateShaderResourceProxy& Other) const
+		{
+			return Resource == Other.Resource && StartUV == Other.StartUV && SizeUV == Other.SizeUV;
+		}
+	};
+}
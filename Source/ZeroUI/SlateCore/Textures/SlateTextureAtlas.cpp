@@ -0,0 +1,271 @@
+#include "SlateTextureAtlas.h"
+
+namespace ZeroUI
+{
+	namespace
+	{
+		constexpr uint32_t AtlasBytesPerPixel = 4;
+	}
+
+	ZMath::vec2 FSlateAtlasEntry::GetStartUV() const
+	{
+		return ZMath::vec2(static_cast<float>(X) / Page->GetWidth(), static_cast<float>(Y) / Page->GetHeight());
+	}
+
+	ZMath::vec2 FSlateAtlasEntry::GetSizeUV() const
+	{
+		return ZMath::vec2(static_cast<float>(Width) / Page->GetWidth(), static_cast<float>(Height) / Page->GetHeight());
+	}
+
+	FSlateTextureAtlasPage::FSlateTextureAtlasPage(uint32_t InWidth, uint32_t InHeight, uint32_t InPadding)
+		: m_Pixels(static_cast<size_t>(InWidth) * InHeight * AtlasBytesPerPixel, 0)
+		, m_UsedArea(0)
+		, m_Width(InWidth)
+		, m_Height(InHeight)
+		, m_Padding(InPadding)
+		, m_bNeedsUpdate(true)
+	{
+		m_Skyline.push_back(FSkylineNode{ 0, 0, m_Width });
+	}
+
+	bool FSlateTextureAtlasPage::AddTexture(const FSlateTextureData& TextureData, FSlateAtlasEntry& OutEntry)
+	{
+		assert(TextureData.GetBytesPerPixel() == AtlasBytesPerPixel);
+
+		const uint32_t RectWidth = TextureData.GetWidth() + m_Padding * 2;
+		const uint32_t RectHeight = TextureData.GetHeight() + m_Padding * 2;
+
+		// bottom-left rule, the rect that ends the lowest wins, then the one that wastes the narrowest segment
+		size_t BestNode = m_Skyline.size();
+		uint32_t BestBottom = std::numeric_limits<uint32_t>::max();
+		uint32_t BestWidth = std::numeric_limits<uint32_t>::max();
+		uint32_t BestY = 0;
+		for (size_t NodeIndex = 0; NodeIndex < m_Skyline.size(); ++NodeIndex)
+		{
+			uint32_t Y = 0;
+			if (FitRect(NodeIndex, RectWidth, RectHeight, Y))
+			{
+				const uint32_t Bottom = Y + RectHeight;
+				if (Bottom < BestBottom || (Bottom == BestBottom && m_Skyline[NodeIndex].Width < BestWidth))
+				{
+					BestNode = NodeIndex;
+					BestBottom = Bottom;
+					BestWidth = m_Skyline[NodeIndex].Width;
+					BestY = Y;
+				}
+			}
+		}
+
+		if (BestNode == m_Skyline.size())
+		{
+			return false;
+		}
+
+		const uint32_t X = m_Skyline[BestNode].X;
+		AddSkylineLevel(BestNode, X, BestY, RectWidth, RectHeight);
+		m_UsedArea += static_cast<uint64_t>(RectWidth) * RectHeight;
+
+		OutEntry.Page = this;
+		OutEntry.X = X + m_Padding;
+		OutEntry.Y = BestY + m_Padding;
+		OutEntry.Width = TextureData.GetWidth();
+		OutEntry.Height = TextureData.GetHeight();
+
+		CopyPixels(OutEntry.X, OutEntry.Y, OutEntry.Width, OutEntry.Height, TextureData.GetRawBytes().data(), OutEntry.Width * AtlasBytesPerPixel);
+		return true;
+	}
+
+	bool FSlateTextureAtlasPage::FitRect(size_t NodeIndex, uint32_t RectWidth, uint32_t RectHeight, uint32_t& OutY) const
+	{
+		if (m_Skyline[NodeIndex].X + RectWidth > m_Width)
+		{
+			return false;
+		}
+
+		// the rect rests on the highest node it spans
+		uint32_t Y = m_Skyline[NodeIndex].Y;
+		uint32_t WidthLeft = RectWidth;
+		for (size_t Index = NodeIndex; WidthLeft > 0; ++Index)
+		{
+			if (Index == m_Skyline.size())
+			{
+				return false;
+			}
+
+			Y = std::max(Y, m_Skyline[Index].Y);
+			if (Y + RectHeight > m_Height)
+			{
+				return false;
+			}
+			WidthLeft -= std::min(WidthLeft, m_Skyline[Index].Width);
+		}
+
+		OutY = Y;
+		return true;
+	}
+
+	void FSlateTextureAtlasPage::AddSkylineLevel(size_t NodeIndex, uint32_t X, uint32_t Y, uint32_t RectWidth, uint32_t RectHeight)
+	{
+		m_Skyline.insert(m_Skyline.begin() + NodeIndex, FSkylineNode{ X, Y + RectHeight, RectWidth });
+
+		// the nodes under the new one are shortened or removed
+		const uint32_t NewRight = X + RectWidth;
+		size_t Index = NodeIndex + 1;
+		while (Index < m_Skyline.size() && m_Skyline[Index].X < NewRight)
+		{
+			FSkylineNode& Node = m_Skyline[Index];
+			const uint32_t NodeRight = Node.X + Node.Width;
+			if (NodeRight <= NewRight)
+			{
+				m_Skyline.erase(m_Skyline.begin() + Index);
+				continue;
+			}
+
+			Node.Width = NodeRight - NewRight;
+			Node.X = NewRight;
+			break;
+		}
+
+		// merge the neighbours at the same height
+		for (size_t MergeIndex = 0; MergeIndex + 1 < m_Skyline.size();)
+		{
+			if (m_Skyline[MergeIndex].Y == m_Skyline[MergeIndex + 1].Y)
+			{
+				m_Skyline[MergeIndex].Width += m_Skyline[MergeIndex + 1].Width;
+				m_Skyline.erase(m_Skyline.begin() + MergeIndex + 1);
+			}
+			else
+			{
+				++MergeIndex;
+			}
+		}
+	}
+
+	void FSlateTextureAtlasPage::CopyPixels(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, const uint8_t* Source, uint32_t SourceStride)
+	{
+		const size_t PageStride = static_cast<size_t>(m_Width) * AtlasBytesPerPixel;
+		for (uint32_t Row = 0; Row < Height; ++Row)
+		{
+			uint8_t* Destination = m_Pixels.data() + (Y + Row) * PageStride + static_cast<size_t>(X) * AtlasBytesPerPixel;
+			std::memcpy(Destination, Source + static_cast<size_t>(Row) * SourceStride, static_cast<size_t>(Width) * AtlasBytesPerPixel);
+		}
+		m_bNeedsUpdate = true;
+	}
+
+	FSlateTextureAtlas::FSlateTextureAtlas(const FSlateTextureAtlasSettings& InSettings)
+		: m_Settings(InSettings)
+		, m_WastedArea(0)
+		, m_Generation(0)
+	{
+	}
+
+	bool FSlateTextureAtlas::CanAtlas(const FSlateTextureData& TextureData) const
+	{
+		return TextureData.GetBytesPerPixel() == AtlasBytesPerPixel
+			&& TextureData.GetWidth() <= m_Settings.MaxTextureSize
+			&& TextureData.GetHeight() <= m_Settings.MaxTextureSize
+			&& TextureData.GetWidth() + m_Settings.Padding * 2 <= m_Settings.PageSize
+			&& TextureData.GetHeight() + m_Settings.Padding * 2 <= m_Settings.PageSize;
+	}
+
+	Ref<FSlateAtlasEntry> FSlateTextureAtlas::AddTexture(const FSlateTextureData& TextureData)
+	{
+		if (!CanAtlas(TextureData))
+		{
+			return nullptr;
+		}
+
+		Ref<FSlateAtlasEntry> Entry = CreateRef<FSlateAtlasEntry>();
+		if (!AddTextureToPages(TextureData, *Entry))
+		{
+			return nullptr;
+		}
+
+		m_Entries.push_back(Entry);
+		return Entry;
+	}
+
+	void FSlateTextureAtlas::RemoveTexture(const Ref<FSlateAtlasEntry>& Entry)
+	{
+		auto It = std::find(m_Entries.begin(), m_Entries.end(), Entry);
+		if (It == m_Entries.end())
+		{
+			return;
+		}
+
+		const uint32_t Padding = m_Settings.Padding;
+		m_WastedArea += static_cast<uint64_t>(Entry->Width + Padding * 2) * (Entry->Height + Padding * 2);
+
+		// swap and pop, the order of the entries doesn't matter
+		*It = std::move(m_Entries.back());
+		m_Entries.pop_back();
+
+		Entry->Page = nullptr;
+	}
+
+	bool FSlateTextureAtlas::ShouldDefragment() const
+	{
+		uint64_t UsedArea = 0;
+		for (const Scope<FSlateTextureAtlasPage>& Page : m_Pages)
+		{
+			UsedArea += Page->GetUsedArea();
+		}
+		return UsedArea > 0 && static_cast<float>(m_WastedArea) / UsedArea > m_Settings.DefragmentThreshold;
+	}
+
+	void FSlateTextureAtlas::Defragment()
+	{
+		// copy the textures out of the pages before they are destroyed
+		std::vector<std::pair<Ref<FSlateAtlasEntry>, FSlateTextureData>> Textures;
+		Textures.reserve(m_Entries.size());
+		for (const Ref<FSlateAtlasEntry>& Entry : m_Entries)
+		{
+			const FSlateTextureAtlasPage& Page = *Entry->Page;
+			const size_t PageStride = static_cast<size_t>(Page.GetWidth()) * AtlasBytesPerPixel;
+			const size_t RowSize = static_cast<size_t>(Entry->Width) * AtlasBytesPerPixel;
+
+			std::vector<uint8_t> Bytes(RowSize * Entry->Height);
+			for (uint32_t Row = 0; Row < Entry->Height; ++Row)
+			{
+				const uint8_t* Source = Page.GetPixels().data() + (Entry->Y + Row) * PageStride + static_cast<size_t>(Entry->X) * AtlasBytesPerPixel;
+				std::memcpy(Bytes.data() + Row * RowSize, Source, RowSize);
+			}
+			Textures.emplace_back(Entry, FSlateTextureData(Entry->Width, Entry->Height, AtlasBytesPerPixel, std::move(Bytes)));
+		}
+
+		// the tallest textures first, the skyline stays flat
+		std::sort(Textures.begin(), Textures.end(), [](const auto& A, const auto& B)
+		{
+			if (A.second.GetHeight() != B.second.GetHeight())
+			{
+				return A.second.GetHeight() > B.second.GetHeight();
+			}
+			return A.second.GetWidth() > B.second.GetWidth();
+		});
+
+		m_Pages.clear();
+		m_WastedArea = 0;
+		for (auto& [Entry, TextureData] : Textures)
+		{
+			// the textures fit in a page on their own, they fitted before being packed again
+			[[maybe_unused]] const bool bAdded = AddTextureToPages(TextureData, *Entry);
+			assert(bAdded);
+		}
+
+		++m_Generation;
+	}
+
+	bool FSlateTextureAtlas::AddTextureToPages(const FSlateTextureData& TextureData, FSlateAtlasEntry& OutEntry)
+	{
+		for (const Scope<FSlateTextureAtlasPage>& Page : m_Pages)
+		{
+			if (Page->AddTexture(TextureData, OutEntry))
+			{
+				return true;
+			}
+		}
+
+		m_Pages.push_back(CreateScope<FSlateTextureAtlasPage>(m_Settings.PageSize, m_Settings.PageSize, m_Settings.Padding));
+		return m_Pages.back()->AddTexture(TextureData, OutEntry);
+	}
+}
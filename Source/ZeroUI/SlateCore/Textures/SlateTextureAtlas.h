@@ -0,0 +1,170 @@
+#pragma once
+
+#include "Core.h"
+#include "SlateCore/Textures/SlateTextureData.h"
+
+namespace ZeroUI
+{
+	/*
+	 * the place of a texture in an atlas
+	 * the entry is shared with the image that owns it, the atlas moves it when it's defragmented so the users must
+	 * read it when they draw and never cache it
+	 */
+	struct FSlateAtlasEntry
+	{
+		/* the page that contains the texture */
+		const class FSlateTextureAtlasPage* Page = nullptr;
+
+		/* the pixels of the texture in the page, the padding excluded */
+		uint32_t X = 0;
+		uint32_t Y = 0;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+
+		bool IsValid() const { return Page != nullptr; }
+
+		/* the uv of the top left corner of the texture */
+		ZMath::vec2 GetStartUV() const;
+
+		/* the uv size of the texture */
+		ZMath::vec2 GetSizeUV() const;
+	};
+
+	/*
+	 * a page of the atlas, the textures are placed with a skyline bottom-left packer
+	 * the skyline is the top contour of the packed textures, a new texture sits on the lowest segment it fits on
+	 */
+	class FSlateTextureAtlasPage
+	{
+	public:
+		FSlateTextureAtlasPage(uint32_t InWidth, uint32_t InHeight, uint32_t InPadding);
+
+		FSlateTextureAtlasPage(const FSlateTextureAtlasPage&) = delete;
+		FSlateTextureAtlasPage& operator=(const FSlateTextureAtlasPage&) = delete;
+
+		/*
+		 * find a place for a texture and copy its pixels
+		 * @return false if the page has no room for the texture
+		 */
+		bool AddTexture(const FSlateTextureData& TextureData, FSlateAtlasEntry& OutEntry);
+
+		uint32_t GetWidth() const { return m_Width; }
+
+		uint32_t GetHeight() const { return m_Height; }
+
+		/* the RGBA8 pixels of the page */
+		const std::vector<uint8_t>& GetPixels() const { return m_Pixels; }
+
+		/* returns true when the pixels changed since the last upload, the renderer clears it once it uploaded the page */
+		bool NeedsUpdate() const { return m_bNeedsUpdate; }
+
+		void MarkUpdated() { m_bNeedsUpdate = false; }
+
+		/* the area covered by the textures of the page, the padding included */
+		uint64_t GetUsedArea() const { return m_UsedArea; }
+
+	private:
+		friend class FSlateTextureAtlas;
+
+		struct FSkylineNode
+		{
+			uint32_t X;
+			uint32_t Y;
+			uint32_t Width;
+		};
+
+		/*
+		 * returns the height of the skyline under a rect starting at the node, or false when the rect doesn't fit there
+		 */
+		bool FitRect(size_t NodeIndex, uint32_t RectWidth, uint32_t RectHeight, uint32_t& OutY) const;
+
+		/* raise the skyline under the new rect */
+		void AddSkylineLevel(size_t NodeIndex, uint32_t X, uint32_t Y, uint32_t RectWidth, uint32_t RectHeight);
+
+		void CopyPixels(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, const uint8_t* Source, uint32_t SourceStride);
+
+	private:
+		std::vector<uint8_t> m_Pixels;
+
+		std::vector<FSkylineNode> m_Skyline;
+
+		uint64_t m_UsedArea;
+
+		uint32_t m_Width;
+		uint32_t m_Height;
+		uint32_t m_Padding;
+
+		uint8_t m_bNeedsUpdate : 1;
+	};
+
+	struct FSlateTextureAtlasSettings
+	{
+		uint32_t PageSize = 1024;
+
+		/* empty pixels around every texture, avoids the bleeding of the neighbours when the texture is filtered */
+		uint32_t Padding = 1;
+
+		/* the textures bigger than this are not atlased, they would waste a page */
+		uint32_t MaxTextureSize = 256;
+
+		/* Defragment is worth it when the removed textures cover more than this ratio of the used area */
+		float DefragmentThreshold = 0.3f;
+	};
+
+	/*
+	 * packs the small textures in shared pages, the draws that use the same page can be batched together
+	 * a texture is inserted in the first page with room for it, a new page is created otherwise.
+	 * the space of a removed texture is only reclaimed by Defragment, which packs the live textures again.
+	 */
+	class FSlateTextureAtlas
+	{
+	public:
+		explicit FSlateTextureAtlas(const FSlateTextureAtlasSettings& InSettings = FSlateTextureAtlasSettings());
+
+		FSlateTextureAtlas(const FSlateTextureAtlas&) = delete;
+		FSlateTextureAtlas& operator=(const FSlateTextureAtlas&) = delete;
+
+		/* returns true if the texture is small enough to be atlased */
+		bool CanAtlas(const FSlateTextureData& TextureData) const;
+
+		/* add a RGBA8 texture, returns null if it can't be atlased */
+		Ref<FSlateAtlasEntry> AddTexture(const FSlateTextureData& TextureData);
+
+		/* remove a texture, its space is wasted until the next Defragment */
+		void RemoveTexture(const Ref<FSlateAtlasEntry>& Entry);
+
+		/* returns true if the wasted space went above the threshold of the settings */
+		bool ShouldDefragment() const;
+
+		/*
+		 * pack all the textures again, biggest first, in as few pages as possible
+		 * the entries are updated in place, the pages may be destroyed
+		 */
+		void Defragment();
+
+		int32_t GetNumPages() const { return static_cast<int32_t>(m_Pages.size()); }
+
+		const FSlateTextureAtlasPage& GetPage(int32_t PageIndex) const { return *m_Pages[PageIndex]; }
+
+		/* incremented by Defragment, the users that keep uv around must refresh them when it changes */
+		uint32_t GetGeneration() const { return m_Generation; }
+
+		const FSlateTextureAtlasSettings& GetSettings() const { return m_Settings; }
+
+	private:
+		/* add the texture to the first page with room, or to a new page */
+		bool AddTextureToPages(const FSlateTextureData& TextureData, FSlateAtlasEntry& OutEntry);
+
+	private:
+		FSlateTextureAtlasSettings m_Settings;
+
+		std::vector<Scope<FSlateTextureAtlasPage>> m_Pages;
+
+		std::vector<Ref<FSlateAtlasEntry>> m_Entries;
+
+		/* the area of the removed textures, padding included */
+		uint64_t m_WastedArea;
+
+		uint32_t m_Generation;
+	};
+}
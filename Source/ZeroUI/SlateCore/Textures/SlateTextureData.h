@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Core.h"
+
+namespace ZeroUI
+{
+	/* holds the decoded pixels of a texture, the data can be shared between threads once it's built */
+	class FSlateTextureData
+	{
+	public:
+		FSlateTextureData(uint32_t InWidth, uint32_t InHeight, uint32_t InBytesPerPixel, std::vector<uint8_t>&& InBytes)
+			: m_Bytes(std::move(InBytes))
+			, m_Width(InWidth)
+			, m_Height(InHeight)
+			, m_BytesPerPixel(InBytesPerPixel)
+		{
+		}
+
+		uint32_t GetWidth() const { return m_Width; }
+
+		uint32_t GetHeight() const { return m_Height; }
+
+		uint32_t GetBytesPerPixel() const { return m_BytesPerPixel; }
+
+		const std::vector<uint8_t>& GetRawBytes() const { return m_Bytes; }
+
+		/* the memory used by the pixels */
+		size_t GetDataSize() const { return m_Bytes.size(); }
+
+	private:
+		/* raw uncompressed texture data */
+		std::vector<uint8_t> m_Bytes;
+
+		uint32_t m_Width;
+		uint32_t m_Height;
+		uint32_t m_BytesPerPixel;
+	};
+
+	using FSlateTextureDataPtr = Ref<FSlateTextureData>;
+}
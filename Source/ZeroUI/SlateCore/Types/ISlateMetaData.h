@@ -41,7 +41,7 @@ namespace ZeroUI
 	*	};
 	*/
 	#define SLATE_METADATA_TYPE(TYPE, BASE) \
-		static const std::string& GetTypeId() { static std::string Type(TEXT(#TYPE)); return Type; } \
+		static const std::string& GetTypeId() { static std::string Type(#TYPE); return Type; } \
 		virtual bool IsOfTypeImpl(const std::string& Type) const override { return GetTypeId() == Type || BASE::IsOfTypeImpl(Type); }
 
 	/**
@@ -0,0 +1,44 @@
+#include "SlateAttribute.h"
+#include "SlateCore/Widgets/SWidgets.h"
+#include "SlateCore/Debugging/SlateInvalidationTrace.h"
+
+namespace ZeroUI
+{
+	namespace SlateAttributePrivate
+	{
+#if ZERO_ENABLE_INVALIDATION_TRACE
+		namespace
+		{
+			/* the description of a member attribute, found with its offset in the widget */
+			const FSlateAttributeDescriptor::FAttribute* FindMemberAttribute(const SWidget& Widget, const FSlateAttributeBase& Attribute)
+			{
+				const std::ptrdiff_t Offset = reinterpret_cast<const uint8_t*>(&Attribute) - reinterpret_cast<const uint8_t*>(&Widget);
+				if (Offset < 0 || Offset > std::numeric_limits<FSlateAttributeDescriptor::OffsetType>::max())
+				{
+					return nullptr;
+				}
+				return Widget.GetWidgetClass().GetAttributeDescriptor().FindMemberAttribute(static_cast<FSlateAttributeDescriptor::OffsetType>(Offset));
+			}
+		}
+#endif
+
+		void FSlateAttributeImpl::ProtectedInvalidateWidget(SWidget& Widget, ESlateAttributeType AttributeType, EInvalidateWidgetReason InvalidationReason) const
+		{
+			const FSlateAttributeDescriptor::FAttribute* Attribute = nullptr;
+#if ZERO_ENABLE_INVALIDATION_TRACE
+			// the lookup is only paid while tracing, the managed attributes live outside of the widget and have no description
+			if (AttributeType == ESlateAttributeType::Member && FSlateInvalidationTrace::Get().IsEnabled())
+			{
+				Attribute = FindMemberAttribute(Widget, *this);
+			}
+#endif
+			Widget.InvalidateFromAttribute(InvalidationReason, Attribute);
+		}
+
+		void FSlateAttributeImpl::ProtectedInvalidateWidget(ISlateAttributeContainer& Container, ESlateAttributeType AttributeType, EInvalidateWidgetReason InvalidationReason) const
+		{
+			// the contained attributes are described per container, the invalidation is only traced with the widget
+			Container.GetContainerWidget().InvalidateFromAttribute(InvalidationReason, nullptr);
+		}
+	}
+}
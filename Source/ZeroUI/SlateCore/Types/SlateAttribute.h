@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Core.h"
+#include "Core/Delegate.h"
+#include "Core/Misc/Attribute.h"
+#include "Core/Misc/Name.h"
 #include "SlateCore/Widgets/InvalidateWidgetReason.h"
 
 namespace ZeroUI
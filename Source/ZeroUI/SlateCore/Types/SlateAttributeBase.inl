@@ -1,4 +1,4 @@
-#pragma onces
+#pragma once
 
 namespace SlateAttributePrivate
 {
@@ -19,10 +19,10 @@ namespace SlateAttributePrivate
 		using FComparePredicate = InComparePredicateType;
 
 		static EInvalidateWidgetReason GetInvalidationReason(const SWidget& Widget) { return FInvalidationReasonPredicate::GetInvalidationReason(Widget); }
-		static EInvalidateWidgetReason GetInvalidationReason(const ISlateAttributeContainer& Container) { return FInvalidationReasonPredicate::GetInvalidationReason(Container.GetContainer_Widget()); }
+		static EInvalidateWidgetReason GetInvalidationReason(const ISlateAttributeContainer& Container) { return FInvalidationReasonPredicate::GetInvalidationReason(Container.GetContainerWidget()); }
 		//use == to compare LHS and RHS
-		static bool IdenticalTo(const SWidget& Widget, const ObjectType& LHS, const ObjectType& RHS) { return FComparePredicate::Identical_To(Widget, LHS, RHS); }
-		static bool IdenticalTo(const ISlateAttributeContainer& Container, const ObjectType& LHS, const ObjectType& RHS) { return FComparePredicate::Identical_To(Container.GetContainerWidget(), LHS, RHS); }
+		static bool IdenticalTo(const SWidget& Widget, const ObjectType& LHS, const ObjectType& RHS) { return FComparePredicate::IdenticalTo(Widget, LHS, RHS); }
+		static bool IdenticalTo(const ISlateAttributeContainer& Container, const ObjectType& LHS, const ObjectType& RHS) { return FComparePredicate::IdenticalTo(Container.GetContainerWidget(), LHS, RHS); }
 	public:
 		TSlateAttributeBase()
 			: m_Value()
@@ -81,17 +81,18 @@ namespace SlateAttributePrivate
 		 */
 		bool Set(ContainerType& widget, ObjectType&& new_value)
 		{
-			const bool b_Is_Identical = Identical_To(widget, m_Value, new_value);//check equal
-			//todo:implement ProtectedUnregisterAttribute
+			const bool bIsIdentical = IdenticalTo(widget, m_Value, new_value);//check equal
+
 			//may be register some getter, need to unbind
-			protected_unregister_attribute(widget, InAttributeType);
-			if(!b_Is_Identical)
+			ProtectedUnregisterAttribute(widget, InAttributeType);
+
+			if(!bIsIdentical)
 			{
-				m_Value = std::move(m_Value);
-				//todo:implement Protected Invalidate Widget
+				m_Value = std::move(new_value);
+				ProtectedInvalidateWidget(widget, InAttributeType, GetInvalidationReason(widget));
 			}
 
-			return !b_Is_Identical;
+			return !bIsIdentical;
 		}
 
 		bool Assign(ContainerType& widget, const TAttribute<ObjectType>& OtherAttribute)
@@ -154,6 +155,7 @@ namespace SlateAttributePrivate
 
 		bool AssignBinding(ContainerType& widget, FGetter&& getter)
 		{
+			return AssignBinding(widget, static_cast<const FGetter&>(getter));
 		}
 
 		void ConstructWrapper(ContainerType& widget, const FGetter& getter)
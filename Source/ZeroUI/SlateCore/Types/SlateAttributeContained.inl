@@ -43,8 +43,8 @@ namespace SlateAttributePrivate
 		}
 
 		template<typename ContainerType, typename U = typename std::enable_if<std::is_base_of<ISlateAttributeContainer, ContainerType>::value>::type>
-		explicit TSlateContainedAttribute(ContainerType& Container, ObjectType&& InValue)
-			: Super(std::move(InValue))
+		explicit TSlateContainedAttribute(ContainerType& Container, const ObjectType& InValue)
+			: Super(InValue)
 		{
 			//todo:check address
 		}
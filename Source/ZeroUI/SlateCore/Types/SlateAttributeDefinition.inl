@@ -20,7 +20,7 @@ namespace SlateAttributePrivate
 	public:
 		virtual SWidget& GetContainerWidget() const = 0;
 
-		virtual std::string GetContainerName() const = 0;
+		virtual FName GetContainerName() const = 0;
 
 		virtual uint32_t GetContainerSortOrder() const = 0;
 
@@ -70,7 +70,7 @@ namespace SlateAttributePrivate
 
 		void ProtectedRegisterAttribute(SWidget& Widget, ESlateAttributeType AttributeType, Scope<ISlateAttributeGetter>&& Wrapper);
 
-		void ProtectedInvalidate_Widget(SWidget& Widget, ESlateAttributeType AttributeType, EInvalidateWidgetReason InvalidationReason) const;
+		void ProtectedInvalidateWidget(SWidget& Widget, ESlateAttributeType AttributeType, EInvalidateWidgetReason InvalidationReason) const;
 
 		bool ProtectedIsBound(const SWidget& Widget, ESlateAttributeType AttributeType) const;
 
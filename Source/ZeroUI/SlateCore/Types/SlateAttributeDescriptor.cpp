@@ -1,42 +1,66 @@
 #include "SlateAttributeDescriptor.h"
+#include "SlateAttribute.h"//ESlateAttributeType
 
 namespace ZeroUI
 {
 		
-	FSlateAttributeDescriptor::FAttribute::FAttribute(std::string Name, OffsetType Offset, FInvalidateWidgetReasonAttribute Reason)
+	FSlateAttributeDescriptor::FAttribute::FAttribute(FName Name, OffsetType Offset, FInvalidateWidgetReasonAttribute Reason)
 		: m_Name(Name)
 		, m_Offset(Offset)
 		, m_InvalidationReason(Reason)
 	{
 	}
 
-	FSlateAttributeDescriptor::FContainerInitializer::FAttributeEntry(
-		FSlateAttributeDescriptor& Descriptor, std::string ContainerName, int32_t AtttributeIndex)
+	FSlateAttributeDescriptor::FContainerInitializer::FContainerInitializer(FSlateAttributeDescriptor& InDescriptor, FName ContainerName)
+		: m_Descriptor(InDescriptor)
+		, m_ContainerName(ContainerName)
+	{
+	}
+
+	FSlateAttributeDescriptor::FContainerInitializer::FAttributeEntry::FAttributeEntry(
+		FSlateAttributeDescriptor& Descriptor, FName ContainerName, int32_t AtttributeIndex)
 		: m_Descriptor(Descriptor)
+		, m_ContainerName(ContainerName)
 		, m_AttributeIndex(AtttributeIndex)
 	{
 	}
 
+	FSlateAttributeDescriptor::FInitializer::FInitializer(FSlateAttributeDescriptor& InDescriptor)
+		: m_Descriptor(InDescriptor)
+	{
+	}
+
+	FSlateAttributeDescriptor::FInitializer::FInitializer(FSlateAttributeDescriptor& InDescriptor, const FSlateAttributeDescriptor& ParentDescriptor)
+		: m_Descriptor(InDescriptor)
+	{
+		// a widget class has the attributes of its parent class
+		m_Descriptor.m_Attributes = ParentDescriptor.m_Attributes;
+		m_Descriptor.m_Containers = ParentDescriptor.m_Containers;
+	}
+
 	FSlateAttributeDescriptor::FInitializer::~FInitializer()
 	{
 	}
 
-	FSlateAttributeDescriptor::FInitializer::FAttributeEntry FSlateAttributeDescriptor::FInitializer::AddMemberAttribute(std::string AttributeName, OffsetType Offset, const FInvalidateWidgetReasonAttribute& ReasonGetter)
+	FSlateAttributeDescriptor::FInitializer::FAttributeEntry FSlateAttributeDescriptor::FInitializer::AddMemberAttribute(FName AttributeName, OffsetType Offset, const FInvalidateWidgetReasonAttribute& ReasonGetter)
 	{
 		//call descriptor's private function
 		return m_Descriptor.AddMemberAttribute(AttributeName, Offset, ReasonGetter);
 	}
 
-	FSlateAttributeDescriptor::FInitializer::FAttributeEntry FSlateAttributeDescriptor::FInitializer::AddMemberAttribute(std::string AttributeName, OffsetType Offset, FInvalidateWidgetReasonAttribute&& ReasonGetter)
+	FSlateAttributeDescriptor::FInitializer::FAttributeEntry FSlateAttributeDescriptor::FInitializer::AddMemberAttribute(FName AttributeName, OffsetType Offset, FInvalidateWidgetReasonAttribute&& ReasonGetter)
 	{
 		return m_Descriptor.AddMemberAttribute(AttributeName, Offset, std::move(ReasonGetter));
 	}
 
-	FSlateAttributeDescriptor::FContainerInitializer FSlateAttributeDescriptor::FInitializer::AddContainer(std::string container_name, OffsetType Offset)
+	FSlateAttributeDescriptor::FContainerInitializer FSlateAttributeDescriptor::FInitializer::AddContainer(FName container_name, OffsetType Offset)
 	{
+		m_Descriptor.m_Containers.emplace_back(container_name, Offset);
+
+		return FContainerInitializer(m_Descriptor, container_name);
 	}
 
-	FSlateAttributeDescriptor::FInitializer::FAttributeEntry(FSlateAttributeDescriptor& Descriptor, int32_t InAttributeIndex)
+	FSlateAttributeDescriptor::FInitializer::FAttributeEntry::FAttributeEntry(FSlateAttributeDescriptor& Descriptor, int32_t InAttributeIndex)
 		:m_Descriptor(Descriptor)
 		, m_AttributeIndex(InAttributeIndex)
 	{
@@ -60,7 +84,7 @@ namespace ZeroUI
 		return Result;
 	}
 
-	FSlateAttributeDescriptor::FAttribute* FSlateAttributeDescriptor::FindAttribute(std::string AttributeName)
+	FSlateAttributeDescriptor::FAttribute* FSlateAttributeDescriptor::FindAttribute(FName AttributeName)
 	{
 		auto Iter = std::find_if(m_Attributes.begin(), m_Attributes.end(), [AttributeName](const FAttribute& Other) { return Other.m_Name == AttributeName; });
 
@@ -69,9 +93,9 @@ namespace ZeroUI
 		return &(*Iter);
 	}
 
-	FSlateAttributeDescriptor::FInitializer::FAttributeEntry FSlateAttributeDescriptor::AddMemberAttribute(std::string AttributeName, OffsetType Offset, FInvalidateWidgetReasonAttribute ReasonGetter)
+	FSlateAttributeDescriptor::FInitializer::FAttributeEntry FSlateAttributeDescriptor::AddMemberAttribute(FName AttributeName, OffsetType Offset, FInvalidateWidgetReasonAttribute ReasonGetter)
 	{
-		int32_t NewIndex = = 1;
+		int32_t NewIndex = INDEX_NONE;
 		FAttribute const* Attribute = FindAttribute(AttributeName);
 
 		m_Attributes.emplace_back(AttributeName, Offset, ReasonGetter);
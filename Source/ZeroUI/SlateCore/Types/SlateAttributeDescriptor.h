@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Core.h"
+#include "Core/Containers/InlineVector.h"
 #include "Core/Delegate.h"
+#include "Core/Misc/Name.h"
 #include "../Widgets/InvalidateWidgetReason.h"
 
 namespace ZeroUI
@@ -86,17 +88,17 @@ namespace ZeroUI
 		public:
 			FContainer() = default;
 
-			FContainer(std::string InName, OffsetType InOffset)
+			FContainer(FName InName, OffsetType InOffset)
 				: m_Name(InName), m_Offset(InOffset)
 			{
 			}
 
 			bool IsValid() const
 			{
-				return m_Name != "";
+				return !m_Name.IsNone();
 			}
 
-			std::string GetName() const
+			FName GetName() const
 			{
 				return m_Name;
 			}
@@ -106,7 +108,7 @@ namespace ZeroUI
 				return m_SortOrder;
 			}
 		private:
-			std::string m_Name;
+			FName m_Name;
 			OffsetType m_Offset = 0;
 			uint32_t m_SortOrder = 0;
 		};
@@ -116,9 +118,9 @@ namespace ZeroUI
 		public:
 			friend FSlateAttributeDescriptor;
 			//OffsetType = uint32_t
-			FAttribute(std::string Name, OffsetType Offset, FInvalidateWidgetReasonAttribute Reason);
-			FAttribute(std::string ContainerName, std::string Name, OffsetType Offset, FInvalidateWidgetReasonAttribute Reason);
-			std::string Get_Name() const
+			FAttribute(FName Name, OffsetType Offset, FInvalidateWidgetReasonAttribute Reason);
+			FAttribute(FName ContainerName, FName Name, OffsetType Offset, FInvalidateWidgetReasonAttribute Reason);
+			FName Get_Name() const
 			{
 				return m_Name;
 			}
@@ -150,11 +152,11 @@ namespace ZeroUI
 			}
 
 		private:
-			std::string m_Name;
+			FName m_Name;
 
 			OffsetType m_Offset;
 
-			std::string m_Perquisite;
+			FName m_Perquisite;
 
 			uint32_t m_SortOrder;
 
@@ -174,10 +176,10 @@ namespace ZeroUI
 		private:
 			friend FSlateAttributeDescriptor;
 
-			FContainerInitializer(FSlateAttributeDescriptor& InDescriptor, std::string ContainerName);
+			FContainerInitializer(FSlateAttributeDescriptor& InDescriptor, FName ContainerName);
 
 			//parent descriptor?
-			FContainerInitializer(FSlateAttributeDescriptor& InDescriptor, const FSlateAttributeDescriptor& ParentDescriptor, std::string ContainerName);
+			FContainerInitializer(FSlateAttributeDescriptor& InDescriptor, const FSlateAttributeDescriptor& ParentDescriptor, FName ContainerName);
 
 		public:
 			FContainerInitializer() = delete;
@@ -188,14 +190,14 @@ namespace ZeroUI
 
 			struct FAttributeEntry
 			{
-				FAttributeEntry(FSlateAttributeDescriptor& Descriptor, std::string ContainerName, int32_t AtttributeIndex);
+				FAttributeEntry(FSlateAttributeDescriptor& Descriptor, FName ContainerName, int32_t AtttributeIndex);
 
 				/*
 				 * update the attribute after the prerequisite
 				 * the order is guaranteed but other attributes may be updated in between
 				 * no order is guaranteed if the prerequisite or this property is updated manually
 				 */
-				FAttributeEntry& UpdatePrerequisite(std::string Prerequisite);
+				FAttributeEntry& UpdatePrerequisite(FName Prerequisite);
 
 				/*
 				 * notified when the attribute value changed
@@ -208,27 +210,27 @@ namespace ZeroUI
 
 			private:
 				FSlateAttributeDescriptor& m_Descriptor;
-				std::string m_ContainerName;
+				FName m_ContainerName;
 				int32_t m_AttributeIndex;
 			};
 
-			FAttributeEntry AddContainedAttribute(std::string AttributeName, OffsetType Offset, const FInvalidateWidgetReasonAttribute& ReasonGetter);
+			FAttributeEntry AddContainedAttribute(FName AttributeName, OffsetType Offset, const FInvalidateWidgetReasonAttribute& ReasonGetter);
 
-			FAttributeEntry AddContainedAttribute(std::string AttributeName, OffsetType Offset, FInvalidateWidgetReasonAttribute&& ReasonGetter);
+			FAttributeEntry AddContainedAttribute(FName AttributeName, OffsetType Offset, FInvalidateWidgetReasonAttribute&& ReasonGetter);
 
 		public:
 			//change the invalidation Reason of an attribute defined in a base class
-			void OverrideInvalidationReason(std::string AttributeName, const FInvalidateWidgetReasonAttribute& Reason);
+			void OverrideInvalidationReason(FName AttributeName, const FInvalidateWidgetReasonAttribute& Reason);
 
-			void OverrideInvalidationReason(std::string AttributeName, FInvalidateWidgetReasonAttribute&& Reason);
+			void OverrideInvalidationReason(FName AttributeName, FInvalidateWidgetReasonAttribute&& Reason);
 
 			//change the FAttributeValueChangedDelegate of an attribute defined in a base class
-			void OverrideOnValueChanged(std::string AttributeName, ECallbackOverrideType OverrideType, FAttributeValueChangedDelegate call_back);
+			void OverrideOnValueChanged(FName AttributeName, ECallbackOverrideType OverrideType, FAttributeValueChangedDelegate call_back);
 
 		private:
 			FSlateAttributeDescriptor& m_Descriptor;
 
-			std::string m_ContainerName;
+			FName m_ContainerName;
 		};
 		struct FInitializer
 		{
@@ -255,7 +257,7 @@ namespace ZeroUI
 				 * the order is guaranteed but other attributes may be updated in between
 				 * no order is guaranteed if the prerequisite or this property is updated manually
 				 */
-				FAttributeEntry& UpdatePrerequisite(std::string PreRequisite) {};
+				FAttributeEntry& UpdatePrerequisite(FName PreRequisite) { return *this; }
 
 				/*
 				 * the attribute affect the visibility of the widget
@@ -278,11 +280,11 @@ namespace ZeroUI
 				int32_t m_AttributeIndex;
 			};
 
-			FAttributeEntry AddMemberAttribute(std::string AttributeName, OffsetType Offset, const FInvalidateWidgetReasonAttribute& ReasonGetter);
+			FAttributeEntry AddMemberAttribute(FName AttributeName, OffsetType Offset, const FInvalidateWidgetReasonAttribute& ReasonGetter);
 
-			FAttributeEntry AddMemberAttribute(std::string AttributeName, OffsetType Offset, FInvalidateWidgetReasonAttribute&& ReasonGetter);
+			FAttributeEntry AddMemberAttribute(FName AttributeName, OffsetType Offset, FInvalidateWidgetReasonAttribute&& ReasonGetter);
 
-			FContainerInitializer AddContainer(std::string container_name, OffsetType Offset);
+			FContainerInitializer AddContainer(FName container_name, OffsetType Offset);
 
 		public:
 
@@ -293,14 +295,15 @@ namespace ZeroUI
 		/* returns the attribute of a slate attribute that have the corresponding memory Offset */
 		const FAttribute* FindMemberAttribute(OffsetType AttributeOffset) const;
 	private:
-		FAttribute* FindAttribute(std::string AttributeName);
+		FAttribute* FindAttribute(FName AttributeName);
 
-		FInitializer::FAttributeEntry AddMemberAttribute(std::string AttributeName, OffsetType Offset, FInvalidateWidgetReasonAttribute ReasonGetter);
+		FInitializer::FAttributeEntry AddMemberAttribute(FName AttributeName, OffsetType Offset, FInvalidateWidgetReasonAttribute ReasonGetter);
 	private:
 
-		std::vector<FAttribute> m_Attributes;
+		/* a widget class declares a few attributes, the attributes of its parent classes included */
+		TInlineVector<FAttribute, 8> m_Attributes;
 
-		std::vector<FContainer> m_Containers;
+		TInlineVector<FContainer, 2> m_Containers;
 	};
 	using FSlateAttributeInitializer = FSlateAttributeDescriptor::FInitializer;
 	//slot attribute initializer ? 
@@ -471,7 +471,7 @@ namespace ZeroUI
 	{
 		static Ref<WidgetType> PrivateAllocatedWidget()
 		{
-			return Ref<WidgetType>();
+			return CreateRef<WidgetType>();
 		}
 	};
 	/*
@@ -490,7 +490,7 @@ namespace ZeroUI
 			: _Widget(TWidgetAllocator<WidgetType>::PrivateAllocatedWidget())//this is for allocate a new swidget in the heap
 			, _RequiredArgs(InRequiredArgs)
 		{
-			// Debug
+			_Widget->CountWidgetClassInstance();
 		}
 
 		/**
@@ -1,25 +1,292 @@
 #include "SWidgets.h"
+#include "SlateCore/Rendering/DrawElements.h"
+#include "SlateCore/Layout/ArrangedWidget.h"
+#include "SlateCore/Layout/Children.h"
+#include "SlateCore/Layout/ParallelLayout.h"
+#include "SlateCore/Debugging/SlateInvalidationTrace.h"
 
 namespace ZeroUI
 {
+	namespace
+	{
+		/* the invalidations that make the cached desired sizes stale */
+		constexpr EInvalidateWidgetReason DesiredSizeInvalidationReasons = EInvalidateWidgetReason::Layout
+			| EInvalidateWidgetReason::Child_Order
+			| EInvalidateWidgetReason::Visibility
+			| EInvalidateWidgetReason::Prepass;
+
+		/* the members of SWidget are packed, the visibility, clipping and invalidation reasons are a byte each */
+		static_assert(sizeof(EVisibility) == 1 && sizeof(EWidgetClipping) == 1 && sizeof(EInvalidateWidgetReason) == 1, "the widget state must stay packed in bytes");
+		static_assert(sizeof(void*) != 8 || sizeof(SWidget) <= 88, "SWidget grew, every widget pays for a new member, see FSlateWidgetClassStatistics::DumpMemory");
+
+#if ZERO_ENABLE_WIDGET_CLASS_STATS
+		/* time spent painting the children of the widget being painted on this thread, excluded from its own paint time */
+		thread_local uint64_t t_ChildrenPaintNs = 0;
+#endif
+	}
+
+	SLATE_IMPLEMENT_WIDGET(SWidget)
+	void SWidget::PrivateRegisterAttributes(FSlateAttributeInitializer&)
+	{
+	}
+
+	SWidget::SWidget()
+		: m_Handle(FWidgetHandleTable::Get().Allocate(*this))
+		, m_bHasRegisteredSlateAttribute(false)
+		, m_bEnabledAttributesUpdate(true)
+		, m_bThreadSafeLayout(false)
+		, m_bSubtreeThreadSafeLayout(false)
+		, m_bLayoutScaleDependent(false)
+		, m_bDesiredSizeChanged(false)
+	{
+	}
+
 	SWidget::~SWidget()
 	{
+		FWidgetHandleTable::Get().Release(m_Handle);
+
+		if (m_CountedWidgetClass)
+		{
+			FSlateWidgetClassStats& Stats = m_CountedWidgetClass->GetStats();
+			Stats.LiveInstances.fetch_sub(1, std::memory_order_relaxed);
+			Stats.LiveBytes.fetch_sub(static_cast<int64_t>(m_CountedWidgetClass->GetInstanceSize()), std::memory_order_relaxed);
+		}
+	}
+
+	void SWidget::CountWidgetClassInstance()
+	{
+		assert(m_CountedWidgetClass == nullptr);
+		m_CountedWidgetClass = &GetWidgetClass();
+
+		FSlateWidgetClassStats& Stats = m_CountedWidgetClass->GetStats();
+		Stats.LiveInstances.fetch_add(1, std::memory_order_relaxed);
+		Stats.LiveBytes.fetch_add(static_cast<int64_t>(m_CountedWidgetClass->GetInstanceSize()), std::memory_order_relaxed);
+	}
+
+	void SWidget::AssignParentWidget(const SWidget& InParent)
+	{
+		m_ParentHandle = InParent.GetHandle();
 	}
 
-	void SWidget::AssignParentWidget(Ref<SWidget> InParent)
+	bool SWidget::ConditionallyDetachParentWidget(SWidget* InExpectedParent)
 	{
-		m_ParentWidgetPtr = InParent;
+		// a destroyed parent resolves to null, the widget is detached by a slot without owner
+		if (GetParentWidget() == InExpectedParent)
+		{
+			m_ParentHandle = FWidgetHandle();
+			return true;
+		}
+		return false;
 	}
 
 	ZMath::vec2 SWidget::GetDesiredSize() const
 	{
-		return ZMath::vec2(m_DesiredSize.value_or(ZMath::vec2(0.0f)));
+		return m_DesiredSizeCache.GetDesiredSize();
+	}
+
+	void SWidget::SetVisibility(EVisibility InVisibility)
+	{
+		if (m_Visibility == InVisibility)
+		{
+			return;
+		}
+
+		const bool bCollapsedChanged = (m_Visibility == EVisibility::Collapsed) != (InVisibility == EVisibility::Collapsed);
+		m_Visibility = InVisibility;
+		Invalidate(EInvalidateWidgetReason::Visibility);
+
+		// a collapsed widget takes no space, the parent has to be measured again
+		if (bCollapsedChanged)
+		{
+			if (SWidget* Parent = GetParentWidget())
+			{
+				Parent->Invalidate(EInvalidateWidgetReason::Layout);
+			}
+		}
 	}
 
 	void SWidget::CacheDesiredSize(float InLayoutScaleMultiplier)
 	{
+#if ZERO_ENABLE_WIDGET_CLASS_STATS
+		if (FSlateWidgetClassStatistics::IsEnabled())
+		{
+			FProfiler& Profiler = FProfiler::Get();
+			const uint64_t StartNs = Profiler.GetTimeNs();
+			SetDesiredSize(ComputeDesiredSize(InLayoutScaleMultiplier));
+
+			FSlateWidgetClassStats& Stats = GetWidgetClass().GetStats();
+			Stats.ComputeDesiredSizeCalls.fetch_add(1, std::memory_order_relaxed);
+			Stats.ComputeDesiredSizeNs.fetch_add(Profiler.GetTimeNs() - StartNs, std::memory_order_relaxed);
+			return;
+		}
+#endif
 		SetDesiredSize(ComputeDesiredSize(InLayoutScaleMultiplier));
 	}
 
+	void SWidget::Invalidate(EInvalidateWidgetReason InvalidateReason)
+	{
+		InvalidateFromAttribute(InvalidateReason, nullptr);
+	}
+
+	void SWidget::InvalidateFromAttribute(EInvalidateWidgetReason InvalidateReason, const FSlateAttributeDescriptor::FAttribute* SourceAttribute)
+	{
+		m_PendingInvalidation |= InvalidateReason;
+
+#if ZERO_ENABLE_INVALIDATION_TRACE
+		FSlateInvalidationTrace& InvalidationTrace = FSlateInvalidationTrace::Get();
+		if (InvalidationTrace.IsEnabled())
+		{
+			InvalidationTrace.Record(*this, SourceAttribute, InvalidateReason);
+		}
+#endif
+
+#if ZERO_ENABLE_WIDGET_CLASS_STATS
+		if (FSlateWidgetClassStatistics::IsEnabled())
+		{
+			GetWidgetClass().GetStats().AddInvalidation(InvalidateReason);
+		}
+#endif
+	}
+
+	void SWidget::SlatePrepass(float InLayoutScaleMultiplier)
+	{
+		FSubtreeLayoutStats ChildrenStats;
+		if (FChildren* MyChildren = GetChildren())
+		{
+			if (MyChildren->Num() > 0)
+			{
+				// the whole subtree is measured again
+				if (EnumHasAnyFlags(m_PendingInvalidation, EInvalidateWidgetReason::Prepass))
+				{
+					for (int32_t ChildIndex = 0; ChildIndex < MyChildren->Num(); ++ChildIndex)
+					{
+						MyChildren->GetChildAt(ChildIndex)->m_PendingInvalidation |= EInvalidateWidgetReason::Prepass;
+					}
+				}
+
+				ChildrenStats = FSlateParallelLayout::PrepassChildren(*this, *MyChildren, InLayoutScaleMultiplier);
+			}
+		}
+
+		m_SubtreeWidgetCount = 1 + ChildrenStats.WidgetCount;
+		m_bSubtreeThreadSafeLayout = m_bThreadSafeLayout && ChildrenStats.bThreadSafe;
+
+		UpdateDesiredSize(InLayoutScaleMultiplier, EnumHasAnyFlags(m_PendingInvalidation, DesiredSizeInvalidationReasons) || ChildrenStats.bDesiredSizeChanged);
+	}
+
+	void SWidget::UpdateDesiredSize(float InLayoutScaleMultiplier, bool bContentChanged)
+	{
+		if (bContentChanged)
+		{
+			m_DesiredSizeCache.InvalidateScales();
+		}
+
+		const bool bHadDesiredSize = m_DesiredSizeCache.HasDesiredSize();
+		const ZMath::vec2 PreviousDesiredSize = m_DesiredSizeCache.GetDesiredSize();
+
+		// the desired size of a widget that doesn't depend on the layout scale is the same at every scale
+		const float CachedLayoutScale = m_bLayoutScaleDependent ? InLayoutScaleMultiplier : 1.0f;
+		if (!m_DesiredSizeCache.Restore(CachedLayoutScale))
+		{
+			CacheDesiredSize(InLayoutScaleMultiplier);
+			m_DesiredSizeCache.Store(CachedLayoutScale);
+		}
+
+		m_bDesiredSizeChanged = !bHadDesiredSize || m_DesiredSizeCache.GetDesiredSize() != PreviousDesiredSize;
+	}
+
+	void SWidget::ArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
+	{
+		OnArrangeChildren(AllottedGeometry, ArrangedChildren);
+	}
+
+	int32_t SWidget::Paint(const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32_t LayerId) const
+	{
+		// nothing of this widget, or of its children, can be seen. skip the whole subtree.
+		if (IsChildWidgetCulled(MyCullingRect, AllottedGeometry))
+		{
+			return LayerId;
+		}
+
+		FSlateRect CullingBounds = MyCullingRect;
+
+		const bool bClipToBounds = ShouldBeClipped(AllottedGeometry);
+		if (bClipToBounds)
+		{
+			FSlateClippingZone ClippingZone(AllottedGeometry);
+			ClippingZone.SetShouldIntersectParent(m_Clipping != EWidgetClipping::ClipToBoundsWithoutIntersecting);
+			ClippingZone.SetAlwaysClip(m_Clipping == EWidgetClipping::ClipToBoundsAlways);
+			OutDrawElements.PushClip(ClippingZone);
+
+			// the children are culled against the new zone, rotated zones are culled with their bounding box
+			CullingBounds = ClippingZone.GetShouldIntersectParent()
+				? CullingBounds.IntersectionWith(ClippingZone.GetBoundingBox())
+				: ClippingZone.GetBoundingBox();
+		}
+
+		// the elements added by OnPaint belong to this widget, the children set themselves while they paint
+		const SWidget* ParentPaintingWidget = OutDrawElements.GetPaintingWidget();
+		OutDrawElements.SetPaintingWidget(this);
+
+#if ZERO_ENABLE_WIDGET_CLASS_STATS
+		int32_t NewLayerId;
+		if (FSlateWidgetClassStatistics::IsEnabled())
+		{
+			FProfiler& Profiler = FProfiler::Get();
+			const uint64_t ParentChildrenPaintNs = t_ChildrenPaintNs;
+			t_ChildrenPaintNs = 0;
+
+			const uint64_t StartNs = Profiler.GetTimeNs();
+			NewLayerId = OnPaint(AllottedGeometry, CullingBounds, OutDrawElements, LayerId);
+			const uint64_t ElapsedNs = Profiler.GetTimeNs() - StartNs;
+
+			FSlateWidgetClassStats& Stats = GetWidgetClass().GetStats();
+			Stats.PaintCalls.fetch_add(1, std::memory_order_relaxed);
+			Stats.PaintNs.fetch_add(ElapsedNs - std::min(t_ChildrenPaintNs, ElapsedNs), std::memory_order_relaxed);
+
+			// the whole subtree counts as children time for the parent
+			t_ChildrenPaintNs = ParentChildrenPaintNs + ElapsedNs;
+		}
+		else
+		{
+			NewLayerId = OnPaint(AllottedGeometry, CullingBounds, OutDrawElements, LayerId);
+		}
+#else
+		const int32_t NewLayerId = OnPaint(AllottedGeometry, CullingBounds, OutDrawElements, LayerId);
+#endif
+
+		OutDrawElements.SetPaintingWidget(ParentPaintingWidget);
+
+		if (bClipToBounds)
+		{
+			OutDrawElements.PopClip();
+		}
+
+		return NewLayerId;
+	}
+
+	bool SWidget::IsChildWidgetCulled(const FSlateRect& MyCullingRect, const FGeometry& ChildGeometry)
+	{
+		return !FSlateRect::DoRectanglesIntersect(MyCullingRect, ChildGeometry.GetRenderBoundingRect());
+	}
+
+	bool SWidget::ShouldBeClipped(const FGeometry& AllottedGeometry) const
+	{
+		switch (m_Clipping)
+		{
+		case EWidgetClipping::Inherit:
+			return false;
+		case EWidgetClipping::OnDemand:
+		{
+			// clip only when the content doesn't fit in the allotted geometry
+			const ZMath::vec2 DesiredSize = GetDesiredSize();
+			const ZMath::vec2& LocalSize = AllottedGeometry.GetLocalSize();
+			return DesiredSize.x > LocalSize.x || DesiredSize.y > LocalSize.y;
+		}
+		default:
+			return true;
+		}
+	}
+
 }
 
@@ -1,10 +1,29 @@
 #pragma once
 
 #include "Core.h"
+#include "Core/Containers/InlineVector.h"
 #include "SlateCore/Widgets/SlateControlledConstruction.h"
 #include "SlateCore/Types/ISlateMetaData.h"
+#include "SlateCore/Layout/Geometry.h"
+#include "SlateCore/Layout/Clipping.h"
+#include "SlateCore/Layout/Visibility.h"
+#include "SlateCore/Layout/DesiredSizeCache.h"
+#include "SlateCore/Widgets/InvalidateWidgetReason.h"
+#include "SlateCore/Widgets/WidgetHandle.h"
+
 namespace ZeroUI
-{ 
+{
+	namespace SlateAttributePrivate
+	{
+		struct FSlateAttributeImpl;
+	}
+
+	class FSlateWindowElementList;
+	class FChildren;
+	class FArrangedChildren;
+	struct FKeyEvent;
+	struct FPointerEvent;
+
 	/**
 	 * Abstract base class for Slate widgets.
 	 *
@@ -41,7 +60,9 @@ namespace ZeroUI
 
 		template<class WidgetType, typename RequiredArgsPayloadType>
 		friend struct TSlateDecl;
+		friend struct SlateAttributePrivate::FSlateAttributeImpl;
 	public:
+		SWidget();
 		virtual ~SWidget() override;
 
 		/** @return true if the widgets has any bound slate attribute. */
@@ -49,13 +70,173 @@ namespace ZeroUI
 		/** @return true if the widgets will update its registered slate attributes automatically or they need to be updated manually. */
 		bool IsAttributesUpdatesEnabled() const { return m_bEnabledAttributesUpdate; }
 
-		void AssignParentWidget(Ref<SWidget> InParent);
+		/** Sets the parent of the widget, the parent is referenced by its handle and isn't kept alive by the child. */
+		void AssignParentWidget(const SWidget& InParent);
+
+		/** Clears the parent of the widget when it's still the expected parent. @return true if the parent was cleared. */
+		bool ConditionallyDetachParentWidget(SWidget* InExpectedParent);
+
+		/** @return The parent widget, null for a root widget, a widget that is not in the widget tree or when the parent is destroyed. */
+		SWidget* GetParentWidget() const { return m_ParentHandle.Resolve(); }
+
+		/** @return The handle of the widget, it references the widget without keeping it alive, see FWidgetHandleTable. */
+		const FWidgetHandle& GetHandle() const { return m_Handle; }
 
 		ZMath::vec2 GetDesiredSize() const;
+
+		/** @return true if the last prepass changed the desired size, the parent has to be measured again. */
+		bool DidDesiredSizeChange() const { return m_bDesiredSizeChanged; }
+
+		/** @return true if the desired size depends on the layout scale, e.g. text measured at the DPI of the window. */
+		bool IsLayoutScaleDependent() const { return m_bLayoutScaleDependent; }
+
+		/**
+		 * Invalidates the widget, the reasons are accumulated until the next frame processes them.
+		 * Use Paint when only the look of the widget changed, it's much cheaper than Layout.
+		 */
+		void Invalidate(EInvalidateWidgetReason InvalidateReason);
+
+		/** @return The invalidation reasons accumulated since the last frame. */
+		EInvalidateWidgetReason GetPendingInvalidation() const { return m_PendingInvalidation; }
+
+		/** Called by the frame once the pending invalidation is processed. */
+		void ClearPendingInvalidation() { m_PendingInvalidation = EInvalidateWidgetReason::None; }
+
+		/** @return the visibility of the widget */
+		EVisibility GetVisibility() const { return m_Visibility; }
+
+		/** Sets the visibility of the widget, collapsing or showing it invalidates the layout of the parent. */
+		void SetVisibility(EVisibility InVisibility);
+
+		/** @return The children of a widget, widgets without children return FNoChildren. */
+		virtual FChildren* GetChildren() = 0;
+
+		/**
+		 * Descends to leaf-most widgets in the hierarchy and gathers desired sizes on the way up.
+		 * i.e. Caches the desired size of all of this widget's children recursively, then caches desired size for itself.
+		 * The big thread safe subtrees are measured on the job system, see FSlateParallelLayout.
+		 *
+		 * A widget is only measured again when its layout was invalidated, the desired size of a child changed, or the
+		 * layout scale changed and the widget is layout scale dependent. The sizes at the last scales are cached, going
+		 * back to a scale, e.g. moving the window back to the other monitor, doesn't measure the widget again.
+		 *
+		 * @param InLayoutScaleMultiplier  The layout scale of the widget.
+		 */
+		void SlatePrepass(float InLayoutScaleMultiplier = 1.0f);
+
+		/**
+		 * Non-virtual entry point for arrange children. Computes the geometry of the children given the allotted geometry.
+		 *
+		 * @param AllottedGeometry  The geometry allotted for this widget by its parent.
+		 * @param ArrangedChildren  The array to which to add the WidgetGeometries that represent the arranged children.
+		 */
+		void ArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const;
+
+		/** @return The layout scale of the child at ChildIndex relative to this widget. */
+		virtual float GetRelativeLayoutScale(int32_t ChildIndex, float LayoutScaleMultiplier) const { return 1.0f; }
+
+		/** @return true if ComputeDesiredSize and OnArrangeChildren of this widget can run on a worker thread. */
+		bool IsThreadSafeLayout() const { return m_bThreadSafeLayout; }
+
+		/** @return true if this widget and all of its descendants were thread safe during the last prepass. */
+		bool IsSubtreeThreadSafeLayout() const { return m_bSubtreeThreadSafeLayout; }
+
+		/** @return The number of visible widgets in the subtree, this widget included, counted during the last prepass. */
+		uint32_t GetSubtreeWidgetCount() const { return m_SubtreeWidgetCount; }
+
+		/**
+		 * Called to paint the widget and its children. The widget is culled, with its whole subtree, when its bounds
+		 * don't overlap the culling rect. When the widget clips, its clipping zone is pushed before OnPaint is called.
+		 *
+		 * @param AllottedGeometry  The FGeometry that describes an area in which the widget should appear.
+		 * @param MyCullingRect     The rectangle, in window space, outside of which nothing can be seen.
+		 * @param OutDrawElements   A list of FSlateDrawElements to populate with the output.
+		 * @param LayerId           The Layer onto which this widget should be rendered.
+		 *
+		 * @return The maximum layer ID attained by this widget or any of its children.
+		 */
+		int32_t Paint(const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32_t LayerId) const;
+
+		/** Sets the clipping to bounds rules for this widget. */
+		void SetClipping(EWidgetClipping InClipping) { m_Clipping = InClipping; }
+
+		/** @return The current clipping rules for this widget. */
+		EWidgetClipping GetClipping() const { return m_Clipping; }
+
+		/**
+		 * @return true if the child geometry is outside of the culling rect, the child and all of its descendants don't need to be painted.
+		 */
+		static bool IsChildWidgetCulled(const FSlateRect& MyCullingRect, const FGeometry& ChildGeometry);
+
+		/** @return true if the widget can take the keyboard focus, it's focused when it's clicked. */
+		virtual bool SupportsKeyboardFocus() const { return false; }
+
+		/**
+		 * Called when a key is pressed while the widget or one of its descendants has the focus.
+		 * The event bubbles from the focused widget up to the window until a widget handles it.
+		 *
+		 * @param MyGeometry  The geometry of the widget in the last arrange.
+		 * @param InKeyEvent  The key, the event path is the path of the focused widget.
+		 *
+		 * @return true if the event is handled, it isn't sent to the parent.
+		 */
+		virtual bool OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) { return false; }
+
+		/** Called when a key is released, see OnKeyDown. */
+		virtual bool OnKeyUp(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) { return false; }
+
+		/** Called when a character is typed, the character code of the event is the typed character. See OnKeyDown. */
+		virtual bool OnKeyChar(const FGeometry& MyGeometry, const FKeyEvent& InCharacterEvent) { return false; }
+
+		/**
+		 * Called when a mouse button is pressed over the widget. The event bubbles from the widget under the cursor up to the window.
+		 * @return true if the event is handled, it isn't sent to the parent.
+		 */
+		virtual bool OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) { return false; }
+
+		/** Called when a mouse button is released, the event is routed along the path of the mouse down. See OnMouseButtonDown. */
+		virtual bool OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) { return false; }
 	protected:
 		/**
-		 * The system calls this method. It performs a breadth-first traversal of every visible widget and asks
-		 * each widget to cache how big it needs to be in order to present all of its content.
+		 * The widget should respond by populating the OutDrawElements array with FDrawElements
+		 * that represent it and any of its children. Called by the non-virtual Paint method.
+		 *
+		 * @param AllottedGeometry  The FGeometry that describes an area in which the widget should appear.
+		 * @param MyCullingRect     The clipping rectangle allocated for this widget and its children.
+		 * @param OutDrawElements   A list of FDrawElements to populate with the output.
+		 * @param LayerId           The Layer onto which this widget should be rendered.
+		 *
+		 * @return The maximum layer ID attained by this widget or any of its children.
+		 */
+		virtual int32_t OnPaint(const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32_t LayerId) const = 0;
+
+		/**
+		 * Compute the Geometry of all the children and add populate the ArrangedChildren list with their values.
+		 * Each type of Layout panel should arrange children based on desired behavior.
+		 *
+		 * @param AllottedGeometry    The geometry allotted for this widget by its parent.
+		 * @param ArrangedChildren    The array to which to add the WidgetGeometries that represent the arranged children.
+		 */
+		virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const = 0;
+
+		/**
+		 * Declares that ComputeDesiredSize and OnArrangeChildren only read the state of this widget and the desired size of
+		 * its children, so the widget can be measured and arranged on a worker thread.
+		 */
+		void SetThreadSafeLayout(bool bInThreadSafeLayout) { m_bThreadSafeLayout = bInThreadSafeLayout; }
+
+		/**
+		 * Declares that ComputeDesiredSize uses its LayoutScaleMultiplier, e.g. to measure text or snap an image to pixels.
+		 * The other widgets, e.g. the panels, keep their desired size when only the layout scale changes.
+		 */
+		void SetLayoutScaleDependent(bool bInLayoutScaleDependent) { m_bLayoutScaleDependent = bInLayoutScaleDependent; }
+
+		/** @return true if the widget needs to clip its content when painted in the allotted geometry. */
+		bool ShouldBeClipped(const FGeometry& AllottedGeometry) const;
+
+		/**
+		 * The system calls this method from SlatePrepass, once the desired size of every visible child is cached,
+		 * and asks the widget to cache how big it needs to be in order to present all of its content.
 		 */
 		virtual void CacheDesiredSize(float InLayoutScaleMultiplier);
 
@@ -69,31 +250,76 @@ namespace ZeroUI
 		 * rule of resizing the bouncy ball simulation.
 		 *
 		 * @param  LayoutScaleMultiplier    This parameter is safe to ignore for almost all widgets; only really affects text measuring.
+		 *                                  The widgets that use it must call SetLayoutScaleDependent(true).
 		 *
 		 * @return The desired size.
 		 */
 		virtual ZMath::vec2 ComputeDesiredSize(float LayoutScaleMultiplier) const = 0;
 	private:
+		/** Invalidates the widget, the source attribute is recorded by the invalidation trace. */
+		void InvalidateFromAttribute(EInvalidateWidgetReason InvalidateReason, const FSlateAttributeDescriptor::FAttribute* SourceAttribute);
+
+		/** Counts the widget in the live instances of its class, called once the widget is allocated by SNew. */
+		void CountWidgetClassInstance();
+
+		/**
+		 * Restores the desired size cached for the layout scale, or measures the widget.
+		 *
+		 * @param bContentChanged  The layout of the widget or the desired size of a child changed, the cached sizes are stale.
+		 */
+		void UpdateDesiredSize(float InLayoutScaleMultiplier, bool bContentChanged);
+
 		/**
 		 * Explicitly set the desired size. This is highly advanced functionality that is meant
 		 * to be used in conjunction with overriding CacheDesiredSize. Use ComputeDesiredSize() instead.
 		 */
 		void SetDesiredSize(const ZMath::vec2& InDesiredSize)
 		{
-			m_DesiredSize = InDesiredSize;
+			m_DesiredSizeCache.SetDesiredSize(InDesiredSize);
 		}
 
 	private:
-		/** Metadata associated with this widget. */
-		std::vector<Ref<ISlateMetaData>> m_MetaData;
+		/**
+		 * The members are ordered by size so the widget has no padding, at a million widgets each byte is a megabyte.
+		 * The state that few widgets have, the metadata and the sizes at the other layout scales, is allocated on first use.
+		 */
+
+		/** Metadata associated with this widget, allocated when the first metadata is added. */
+		Scope<TInlineVector<Ref<ISlateMetaData>, 2>> m_MetaData;
+
+		/** The class the widget is counted in, its dynamic class is not known anymore in the destructor */
+		const FSlateWidgetClassData* m_CountedWidgetClass = nullptr;
+
+		/** The slot of the widget in the widget handle table, taken by the constructor and released by the destructor */
+		FWidgetHandle m_Handle;
+
+		/** The handle of the parent widget. If it is null this is a root widget or it is not in the widget tree. */
+		FWidgetHandle m_ParentHandle;
+
+		/* stores the ideal size this widget wants to be, and the sizes at the last layout scales */
+		FDesiredSizeCache m_DesiredSizeCache;
+
+		/** Number of visible widgets in the subtree, counted by the last prepass. Used to decide if the subtree is worth a task. */
+		uint32_t m_SubtreeWidgetCount = 1;
+
+		/** The invalidation reasons accumulated since the last frame */
+		EInvalidateWidgetReason m_PendingInvalidation = EInvalidateWidgetReason::None;
 
-		/** Pointer to this widgets parent widget.  If it is null this is a root widget or it is not in the widget tree */
-		Weak<SWidget> m_ParentWidgetPtr;
+		/** The visibility of the widget, stored in a byte */
+		EVisibility m_Visibility;
 
-		/* stores the ideal size this widget wants to be */
-		std::optional<ZMath::vec2> m_DesiredSize;
+		/** The clipping rules of the widget, see EWidgetClipping */
+		EWidgetClipping m_Clipping = EWidgetClipping::Inherit;
 		/** Is there at least one SlateAttribute currently registered. */
 		uint8_t m_bHasRegisteredSlateAttribute : 1;
 		uint8_t m_bEnabledAttributesUpdate : 1;
+		/** The widget can be measured and arranged on a worker thread. */
+		uint8_t m_bThreadSafeLayout : 1;
+		/** The widget and all of its descendants were thread safe during the last prepass. */
+		uint8_t m_bSubtreeThreadSafeLayout : 1;
+		/** The desired size depends on the layout scale. */
+		uint8_t m_bLayoutScaleDependent : 1;
+		/** The last prepass changed the desired size. */
+		uint8_t m_bDesiredSizeChanged : 1;
 	};
 }
\ No newline at end of file
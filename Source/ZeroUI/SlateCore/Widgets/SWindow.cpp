@@ -0,0 +1,136 @@
+#include "SWindow.h"
+#include "ApplicationCore/GenericPlatform/GenericWindow.h"
+#include "SlateCore/Layout/ArrangedWidget.h"
+#include "SlateCore/Textures/SlateAsyncImageLoader.h"
+
+namespace ZeroUI
+{
+	SWindow::SWindow()
+		: m_ChildSlot(this)
+		, m_SizeInScreen(0.0f, 0.0f)
+		, m_bFullDamagePending(true)
+	{
+		SetVisibility(EVisibility::SelfHitTestInvisible);
+	}
+
+	SWindow::~SWindow()
+	{
+	}
+
+	void SWindow::SetContent(const Ref<SWidget>& InContent)
+	{
+		m_ChildSlot.AttachWidget(InContent);
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+
+	Ref<SWidget> SWindow::GetContent() const
+	{
+		return m_ChildSlot.GetWidget();
+	}
+
+	void SWindow::Resize(const ZMath::vec2& InSizeInScreen)
+	{
+		if (m_SizeInScreen != InSizeInScreen)
+		{
+			m_SizeInScreen = InSizeInScreen;
+			m_bFullDamagePending = true;
+			Invalidate(EInvalidateWidgetReason::Layout);
+		}
+	}
+
+	float SWindow::GetDPIScaleFactor() const
+	{
+		return m_NativeWindow ? m_NativeWindow->GetDPIScaleFactor() : 1.0f;
+	}
+
+	FGeometry SWindow::GetWindowGeometryInWindow() const
+	{
+		const float DPIScale = GetDPIScaleFactor();
+		return FGeometry::MakeRoot(m_SizeInScreen / DPIScale, FSlateLayoutTransform(DPIScale, ZMath::vec2(0.0f, 0.0f)));
+	}
+
+	FSlateRect SWindow::GetClippingRectangleInWindow() const
+	{
+		return FSlateRect(ZMath::vec2(0.0f, 0.0f), m_SizeInScreen);
+	}
+
+	void SWindow::UpdateDamageRegion()
+	{
+		m_DamageRegion.Reset();
+		m_InvalidatedWidgets.Reset();
+		// the retained vertices of the atlased brushes have stale UVs since a defragment
+		if (m_bFullDamagePending || m_BatchData.GetAtlasGeneration() != FSlateAsyncImageLoader::Get().GetAtlas().GetGeneration())
+		{
+			m_DamageRegion.SetFull();
+			m_InvalidatedWidgets.InvalidateAll();
+			m_bFullDamagePending = false;
+		}
+
+		std::unordered_map<FWidgetHandle, FSlateRect> PaintedRects;
+		PaintedRects.reserve(m_ArrangedWidgets.Num());
+		for (const FArrangedWidgetNode& Node : m_ArrangedWidgets.GetNodes())
+		{
+			SWidget* Widget = Node.ArrangedWidget.GetWidgetPtr();
+			const FSlateRect Rect = Node.ArrangedWidget.GetGeometry().GetRenderBoundingRect();
+
+			auto OldRect = m_PaintedRects.find(Widget->GetHandle());
+			if (OldRect == m_PaintedRects.end())
+			{
+				// new, or visible again
+				m_DamageRegion.AddRect(Rect);
+				m_InvalidatedWidgets.Add(Widget->GetHandle());
+			}
+			else
+			{
+				if (Widget->GetPendingInvalidation() != EInvalidateWidgetReason::None || OldRect->second != Rect)
+				{
+					m_DamageRegion.AddRect(OldRect->second);
+					m_DamageRegion.AddRect(Rect);
+					m_InvalidatedWidgets.Add(Widget->GetHandle());
+				}
+				m_PaintedRects.erase(OldRect);
+			}
+
+			Widget->ClearPendingInvalidation();
+			PaintedRects.emplace(Widget->GetHandle(), Rect);
+		}
+
+		// removed, collapsed or moved to another window
+		for (const auto& [Handle, OldRect] : m_PaintedRects)
+		{
+			m_DamageRegion.AddRect(OldRect);
+		}
+
+		m_PaintedRects = std::move(PaintedRects);
+
+		m_DamageRegion.Merge(GetClippingRectangleInWindow());
+	}
+
+	int32_t SWindow::OnPaint(const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32_t LayerId) const
+	{
+		FArrangedChildren ArrangedChildren(EVisibility::Visible);
+		ArrangeChildren(AllottedGeometry, ArrangedChildren);
+
+		int32_t MaxLayerId = LayerId;
+		for (const FArrangedWidget& Child : ArrangedChildren)
+		{
+			MaxLayerId = std::max(MaxLayerId, Child.GetWidgetPtr()->Paint(Child.GetGeometry(), MyCullingRect, OutDrawElements, LayerId + 1));
+		}
+		return MaxLayerId;
+	}
+
+	void SWindow::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
+	{
+		// the content fills the window
+		if (Ref<SWidget> Content = GetContent())
+		{
+			ArrangedChildren.AddWidget(FArrangedWidget(Content, AllottedGeometry.MakeChild(ZMath::vec2(0.0f, 0.0f), AllottedGeometry.GetLocalSize())));
+		}
+	}
+
+	ZMath::vec2 SWindow::ComputeDesiredSize(float LayoutScaleMultiplier) const
+	{
+		Ref<SWidget> Content = GetContent();
+		return Content ? Content->GetDesiredSize() : ZMath::vec2(0.0f, 0.0f);
+	}
+}
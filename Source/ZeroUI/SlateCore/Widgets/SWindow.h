@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Core.h"
+#include "SlateCore/Widgets/SWidgets.h"
+#include "SlateCore/Layout/Children.h"
+#include "SlateCore/Layout/ParallelLayout.h"
+#include "SlateCore/Rendering/DrawElements.h"
+#include "SlateCore/Rendering/ElementBatcher.h"
+#include "SlateCore/Rendering/DamageRegion.h"
+
+namespace ZeroUI
+{
+	class FGenericWindow;
+
+	/**
+	 * The root of a widget tree, backed by a native window of the platform application.
+	 * The window keeps the output of its last frame: the arranged widgets used for the hit test, the draw elements and the batches.
+	 */
+	class SWindow : public SWidget
+	{
+	public:
+		SWindow();
+		virtual ~SWindow() override;
+
+		/** Sets the widget that fills the window. */
+		void SetContent(const Ref<SWidget>& InContent);
+
+		/** @return The widget that fills the window, can be null. */
+		Ref<SWidget> GetContent() const;
+
+		void SetNativeWindow(const Ref<FGenericWindow>& InNativeWindow) { m_NativeWindow = InNativeWindow; }
+
+		const Ref<FGenericWindow>& GetNativeWindow() const { return m_NativeWindow; }
+
+		/** Sets the size of the client area, in pixels. */
+		void Resize(const ZMath::vec2& InSizeInScreen);
+
+		/** @return The size of the client area, in pixels. */
+		const ZMath::vec2& GetSizeInScreen() const { return m_SizeInScreen; }
+
+		/** @return The DPI scale of the native window, 1 when the window has no native window. */
+		float GetDPIScaleFactor() const;
+
+		/** @return The geometry of the window in window space, the DPI scale is applied by the layout transform. */
+		FGeometry GetWindowGeometryInWindow() const;
+
+		/** @return The rectangle of the window in window space, in pixels. */
+		FSlateRect GetClippingRectangleInWindow() const;
+
+		FSlateWindowElementList& GetElementList() { return m_ElementList; }
+
+		FSlateBatchData& GetBatchData() { return m_BatchData; }
+
+		FArrangedWidgetTree& GetArrangedWidgets() { return m_ArrangedWidgets; }
+
+		/**
+		 * Computes the damage region of the frame from the arranged widgets, called after the arrange.
+		 * A widget damages its old and new rectangles when it was invalidated or moved, the widgets that disappeared damage their old rectangle.
+		 * The pending invalidations of the arranged widgets are consumed.
+		 * The whole window is damaged when the texture atlas was defragmented since its last batch.
+		 */
+		void UpdateDamageRegion();
+
+		/** The parts of the window that changed since the last frame, the renderer only needs to redraw and present them. */
+		const FSlateDamageRegion& GetDamageRegion() const { return m_DamageRegion; }
+
+		/** Redraw the whole window on the next frame. */
+		void InvalidateWholeWindow() { m_bFullDamagePending = true; }
+
+		/** The widgets that were invalidated, moved or added since the last frame, the batcher generates their vertices again. */
+		const FSlateInvalidatedWidgets& GetInvalidatedWidgets() const { return m_InvalidatedWidgets; }
+
+		virtual FChildren* GetChildren() override { return &m_ChildSlot; }
+
+	protected:
+		virtual int32_t OnPaint(const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32_t LayerId) const override;
+
+		virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
+
+		virtual ZMath::vec2 ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+	private:
+		FSingleWidgetChildrenWithSlot m_ChildSlot;
+
+		Ref<FGenericWindow> m_NativeWindow;
+
+		ZMath::vec2 m_SizeInScreen;
+
+		/** The draw elements of the last paint */
+		FSlateWindowElementList m_ElementList;
+
+		/** The batches built from the element list, consumed by the renderer */
+		FSlateBatchData m_BatchData;
+
+		/** The widgets arranged during the last frame, in paint order */
+		FArrangedWidgetTree m_ArrangedWidgets;
+
+		FSlateDamageRegion m_DamageRegion;
+
+		/** The rectangle of every widget painted during the last frame, in window space. A destroyed widget's handle never matches a new widget. */
+		std::unordered_map<FWidgetHandle, FSlateRect> m_PaintedRects;
+
+		FSlateInvalidatedWidgets m_InvalidatedWidgets;
+
+		/** Set by a resize, and for the first frame */
+		bool m_bFullDamagePending;
+	};
+}
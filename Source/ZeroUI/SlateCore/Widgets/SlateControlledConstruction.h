@@ -3,6 +3,7 @@
 #include "Core.h"
 #include "Core/Templates/Identity.h"
 #include "../Types/SlateAttributeDescriptor.h"
+#include "SlateCore/Widgets/WidgetClassStats.h"
 
 namespace ZeroUI
 {
@@ -14,8 +15,8 @@ namespace ZeroUI
 		using PrivateThisType = WidgetType;\
 		static const FSlateWidgetClassData& GetPrivateWidgetClass() \
 		{\
-			static FSlateWidgetClassData WidgetClassDataInstance = FSlateWidgetClassData(TIdentity<ParentType>(), #WidgetType, &WidgetType::PrivateRegisterAttributes);\
-			return Widget_Class_Data_Instance;\
+			static FSlateWidgetClassData WidgetClassDataInstance = FSlateWidgetClassData(TIdentity<ParentType>(), #WidgetType, sizeof(WidgetType), &WidgetType::PrivateRegisterAttributes);\
+			return WidgetClassDataInstance;\
 		}\
 		static void PrivateRegisterAttributes(FSlateAttributeInitializer&);\
 	public:\
@@ -32,28 +33,43 @@ namespace ZeroUI
 	private:
 		friend FSlateControlledConstruction;
 
-		FSlateWidgetClassData(std::string InWidgetTypeName)
+		FSlateWidgetClassData(FName InWidgetTypeName)
 			: WidgetType(InWidgetTypeName)
+			, InstanceSize(0)
 		{}
 
 	public:
 		template<typename InWidgetParentType>
-		FSlateWidgetClassData(TIdentity<InWidgetParentType>, std::string InWidgetTypeName, void(*AttributeInitializer)(FSlateAttributeInitializer&))
+		FSlateWidgetClassData(TIdentity<InWidgetParentType>, FName InWidgetTypeName, size_t InInstanceSize, void(*AttributeInitializer)(FSlateAttributeInitializer&))
 			: WidgetType(InWidgetTypeName)
+			, InstanceSize(InInstanceSize)
 		{
 			// Initialize the parent class if it's not already done
 			const FSlateWidgetClassData& ParentWidgetClassData = InWidgetParentType::StaticWidgetClass();
 			// Initialize the attribute descriptor
 			FSlateAttributeInitializer Initializer = { Descriptor, ParentWidgetClassData.GetAttributeDescriptor() };
 			(*AttributeInitializer)(Initializer);
+
+			FSlateWidgetClassStatistics::RegisterClass(*this);
 		}
 
+		FSlateWidgetClassData(const FSlateWidgetClassData&) = delete;
+		FSlateWidgetClassData& operator=(const FSlateWidgetClassData&) = delete;
+
 		const FSlateAttributeDescriptor& GetAttributeDescriptor() const { return Descriptor; };
-		std::string GetWidgetType() const { return WidgetType; }
+		FName GetWidgetType() const { return WidgetType; }
+
+		/** sizeof the widget class, the widgets that don't declare their own class are counted with their parent class */
+		size_t GetInstanceSize() const { return InstanceSize; }
+
+		/** the counters of the class, see FSlateWidgetClassStatistics to query them */
+		FSlateWidgetClassStats& GetStats() const { return Stats; }
 
 	private:
 		FSlateAttributeDescriptor Descriptor;
-		std::string WidgetType;
+		FName WidgetType;
+		size_t InstanceSize;
+		mutable FSlateWidgetClassStats Stats;
 	};
 
 	struct FSlateWidgetClassRegistration
@@ -0,0 +1,248 @@
+#include "WidgetClassStats.h"
+#include "SlateCore/Widgets/SlateControlledConstruction.h"
+#include "SlateCore/Widgets/SWidgets.h"
+
+namespace ZeroUI
+{
+	namespace
+	{
+		struct FRegisteredClasses
+		{
+			std::mutex Mutex;
+			std::vector<const FSlateWidgetClassData*> Classes;
+		};
+
+		/* function local, the classes are registered during the static initialization of the other translation units */
+		FRegisteredClasses& GetRegisteredClasses()
+		{
+			static FRegisteredClasses Instance;
+			return Instance;
+		}
+
+		/* the control block that make_shared allocates with the widget, a vtable pointer and the strong and weak counts */
+		constexpr size_t SharedControlBlockBytes = sizeof(void*) + 2 * sizeof(int32_t);
+
+		uint32_t GetReasonBitIndex(EInvalidateWidgetReason Reason)
+		{
+			const uint8_t Value = static_cast<uint8_t>(Reason);
+			uint32_t BitIndex = 0;
+			while (BitIndex < NumInvalidateWidgetReasons && (Value & (1 << BitIndex)) == 0)
+			{
+				++BitIndex;
+			}
+			return BitIndex;
+		}
+	}
+
+	std::atomic<bool> FSlateWidgetClassStatistics::s_bEnabled = false;
+
+	const char* GetInvalidateWidgetReasonName(uint32_t ReasonBit)
+	{
+		static const char* Names[NumInvalidateWidgetReasons] =
+		{
+			"Layout",
+			"Paint",
+			"Volatility",
+			"Child_Order",
+			"Render_Transform",
+			"Visibility",
+			"Attribute_Registration",
+			"Prepass",
+		};
+		return ReasonBit < NumInvalidateWidgetReasons ? Names[ReasonBit] : "None";
+	}
+
+	void FSlateWidgetClassStats::AddInvalidation(EInvalidateWidgetReason Reason)
+	{
+		const uint8_t Value = static_cast<uint8_t>(Reason);
+		for (uint32_t BitIndex = 0; BitIndex < NumInvalidateWidgetReasons; ++BitIndex)
+		{
+			if (Value & (1 << BitIndex))
+			{
+				Invalidations[BitIndex].fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	void FSlateWidgetClassStats::ResetCounters()
+	{
+		ComputeDesiredSizeCalls.store(0, std::memory_order_relaxed);
+		ComputeDesiredSizeNs.store(0, std::memory_order_relaxed);
+		PaintCalls.store(0, std::memory_order_relaxed);
+		PaintNs.store(0, std::memory_order_relaxed);
+		for (std::atomic<uint64_t>& Counter : Invalidations)
+		{
+			Counter.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	uint64_t FSlateWidgetClassStatsSnapshot::GetInvalidations(EInvalidateWidgetReason Reason) const
+	{
+		const uint32_t BitIndex = GetReasonBitIndex(Reason);
+		return BitIndex < NumInvalidateWidgetReasons ? Invalidations[BitIndex] : 0;
+	}
+
+	uint64_t FSlateWidgetClassStatsSnapshot::GetTotalInvalidations() const
+	{
+		uint64_t Total = 0;
+		for (uint64_t Count : Invalidations)
+		{
+			Total += Count;
+		}
+		return Total;
+	}
+
+	void FSlateWidgetClassStatistics::RegisterClass(const FSlateWidgetClassData& ClassData)
+	{
+		FRegisteredClasses& Registered = GetRegisteredClasses();
+		std::lock_guard<std::mutex> Lock(Registered.Mutex);
+		Registered.Classes.push_back(&ClassData);
+	}
+
+	FSlateWidgetClassStatsSnapshot FSlateWidgetClassStatistics::MakeSnapshot(const FSlateWidgetClassData& ClassData)
+	{
+		const FSlateWidgetClassStats& Stats = ClassData.GetStats();
+
+		FSlateWidgetClassStatsSnapshot Snapshot;
+		Snapshot.WidgetType = ClassData.GetWidgetType();
+		Snapshot.LiveInstances = Stats.LiveInstances.load(std::memory_order_relaxed);
+		Snapshot.LiveBytes = Stats.LiveBytes.load(std::memory_order_relaxed);
+		Snapshot.InstanceSize = ClassData.GetInstanceSize();
+		Snapshot.ComputeDesiredSizeCalls = Stats.ComputeDesiredSizeCalls.load(std::memory_order_relaxed);
+		Snapshot.ComputeDesiredSizeMs = static_cast<double>(Stats.ComputeDesiredSizeNs.load(std::memory_order_relaxed)) * 1e-6;
+		Snapshot.PaintCalls = Stats.PaintCalls.load(std::memory_order_relaxed);
+		Snapshot.PaintMs = static_cast<double>(Stats.PaintNs.load(std::memory_order_relaxed)) * 1e-6;
+		for (uint32_t BitIndex = 0; BitIndex < NumInvalidateWidgetReasons; ++BitIndex)
+		{
+			Snapshot.Invalidations[BitIndex] = Stats.Invalidations[BitIndex].load(std::memory_order_relaxed);
+		}
+		return Snapshot;
+	}
+
+	std::vector<FSlateWidgetClassStatsSnapshot> FSlateWidgetClassStatistics::GetSnapshots(EWidgetClassStatsSort Sort)
+	{
+		std::vector<FSlateWidgetClassStatsSnapshot> Snapshots;
+		{
+			FRegisteredClasses& Registered = GetRegisteredClasses();
+			std::lock_guard<std::mutex> Lock(Registered.Mutex);
+			Snapshots.reserve(Registered.Classes.size());
+			for (const FSlateWidgetClassData* ClassData : Registered.Classes)
+			{
+				Snapshots.push_back(MakeSnapshot(*ClassData));
+			}
+		}
+
+		std::stable_sort(Snapshots.begin(), Snapshots.end(), [Sort](const FSlateWidgetClassStatsSnapshot& A, const FSlateWidgetClassStatsSnapshot& B)
+		{
+			switch (Sort)
+			{
+			case EWidgetClassStatsSort::ComputeDesiredSizeTime:	return A.ComputeDesiredSizeMs > B.ComputeDesiredSizeMs;
+			case EWidgetClassStatsSort::LiveBytes:				return A.LiveBytes > B.LiveBytes;
+			case EWidgetClassStatsSort::Invalidations:			return A.GetTotalInvalidations() > B.GetTotalInvalidations();
+			default:											return A.PaintMs > B.PaintMs;
+			}
+		});
+		return Snapshots;
+	}
+
+	bool FSlateWidgetClassStatistics::FindSnapshot(FName WidgetType, FSlateWidgetClassStatsSnapshot& OutSnapshot)
+	{
+		FRegisteredClasses& Registered = GetRegisteredClasses();
+		std::lock_guard<std::mutex> Lock(Registered.Mutex);
+		for (const FSlateWidgetClassData* ClassData : Registered.Classes)
+		{
+			if (ClassData->GetWidgetType() == WidgetType)
+			{
+				OutSnapshot = MakeSnapshot(*ClassData);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	std::string FSlateWidgetClassStatistics::DumpToString(EWidgetClassStatsSort Sort)
+	{
+		std::ostringstream Stream;
+		Stream.setf(std::ios::fixed);
+		Stream.precision(3);
+
+		Stream << "WidgetType, LiveInstances, LiveBytes, ComputeDesiredSizeCalls, ComputeDesiredSizeMs, PaintCalls, PaintMs";
+		for (uint32_t BitIndex = 0; BitIndex < NumInvalidateWidgetReasons; ++BitIndex)
+		{
+			Stream << ", " << GetInvalidateWidgetReasonName(BitIndex);
+		}
+		Stream << "\n";
+
+		for (const FSlateWidgetClassStatsSnapshot& Snapshot : GetSnapshots(Sort))
+		{
+			Stream << Snapshot.WidgetType
+				<< ", " << Snapshot.LiveInstances
+				<< ", " << Snapshot.LiveBytes
+				<< ", " << Snapshot.ComputeDesiredSizeCalls
+				<< ", " << Snapshot.ComputeDesiredSizeMs
+				<< ", " << Snapshot.PaintCalls
+				<< ", " << Snapshot.PaintMs;
+			for (uint64_t Count : Snapshot.Invalidations)
+			{
+				Stream << ", " << Count;
+			}
+			Stream << "\n";
+		}
+		return Stream.str();
+	}
+
+	void FSlateWidgetClassStatistics::Dump(EWidgetClassStatsSort Sort)
+	{
+		CORE_LOG_INFO("Widget class stats:\n{0}", DumpToString(Sort));
+	}
+
+	std::string FSlateWidgetClassStatistics::DumpMemoryToString()
+	{
+		std::ostringstream Stream;
+		Stream.setf(std::ios::fixed);
+		Stream.precision(1);
+
+		Stream << "SWidget base: " << sizeof(SWidget) << " bytes, shared pointer control block: " << SharedControlBlockBytes << " bytes\n";
+		Stream << "WidgetType, LiveInstances, InstanceBytes, AllocatedBytesPerWidget, LiveAllocatedBytes\n";
+
+		int64_t TotalInstances = 0;
+		int64_t TotalBytes = 0;
+		for (const FSlateWidgetClassStatsSnapshot& Snapshot : GetSnapshots(EWidgetClassStatsSort::LiveBytes))
+		{
+			if (Snapshot.LiveInstances <= 0)
+			{
+				continue;
+			}
+
+			const int64_t BytesPerWidget = static_cast<int64_t>(Snapshot.InstanceSize + SharedControlBlockBytes);
+			Stream << Snapshot.WidgetType
+				<< ", " << Snapshot.LiveInstances
+				<< ", " << Snapshot.InstanceSize
+				<< ", " << BytesPerWidget
+				<< ", " << Snapshot.LiveInstances * BytesPerWidget
+				<< "\n";
+
+			TotalInstances += Snapshot.LiveInstances;
+			TotalBytes += Snapshot.LiveInstances * BytesPerWidget;
+		}
+
+		const double AverageBytes = TotalInstances > 0 ? static_cast<double>(TotalBytes) / static_cast<double>(TotalInstances) : 0.0;
+		Stream << "Total, " << TotalInstances << ", , " << AverageBytes << ", " << TotalBytes << "\n";
+		return Stream.str();
+	}
+
+	void FSlateWidgetClassStatistics::DumpMemory()
+	{
+		CORE_LOG_INFO("Widget memory:\n{0}", DumpMemoryToString());
+	}
+
+	void FSlateWidgetClassStatistics::ResetCounters()
+	{
+		FRegisteredClasses& Registered = GetRegisteredClasses();
+		std::lock_guard<std::mutex> Lock(Registered.Mutex);
+		for (const FSlateWidgetClassData* ClassData : Registered.Classes)
+		{
+			ClassData->GetStats().ResetCounters();
+		}
+	}
+}
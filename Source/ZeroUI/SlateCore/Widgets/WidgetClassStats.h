@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Core.h"
+#include "Core/Misc/Name.h"
+#include "Core/Profiling/Profiler.h"
+#include "SlateCore/Widgets/InvalidateWidgetReason.h"
+#include <atomic>
+
+/* the counters of the widget classes are part of the profiling build, the live instances are always counted */
+#ifndef ZERO_ENABLE_WIDGET_CLASS_STATS
+#define ZERO_ENABLE_WIDGET_CLASS_STATS ZERO_ENABLE_PROFILER
+#endif
+
+namespace ZeroUI
+{
+	class FSlateWidgetClassData;
+
+	/* one counter per bit of EInvalidateWidgetReason */
+	static constexpr uint32_t NumInvalidateWidgetReasons = 8;
+
+	const char* GetInvalidateWidgetReasonName(uint32_t ReasonBit);
+
+	/*
+	 * the counters of a widget class
+	 * they are updated by the game thread and by the layout tasks, so they are all atomics
+	 */
+	struct FSlateWidgetClassStats
+	{
+		/* the widgets allocated by SNew that are still alive */
+		std::atomic<int64_t> LiveInstances = 0;
+		std::atomic<int64_t> LiveBytes = 0;
+
+		std::atomic<uint64_t> ComputeDesiredSizeCalls = 0;
+		std::atomic<uint64_t> ComputeDesiredSizeNs = 0;
+
+		/* the paint time excludes the time spent painting the children */
+		std::atomic<uint64_t> PaintCalls = 0;
+		std::atomic<uint64_t> PaintNs = 0;
+
+		std::array<std::atomic<uint64_t>, NumInvalidateWidgetReasons> Invalidations{};
+
+		void AddInvalidation(EInvalidateWidgetReason Reason);
+
+		/* reset the call counters and the timings, the live counters are kept */
+		void ResetCounters();
+	};
+
+	/* a copy of the counters of a class */
+	struct FSlateWidgetClassStatsSnapshot
+	{
+		FName WidgetType;
+
+		int64_t LiveInstances = 0;
+		int64_t LiveBytes = 0;
+
+		/* sizeof the class, the shared pointer reference counts allocated with the widget are not included */
+		size_t InstanceSize = 0;
+
+		uint64_t ComputeDesiredSizeCalls = 0;
+		double ComputeDesiredSizeMs = 0.0;
+
+		uint64_t PaintCalls = 0;
+		double PaintMs = 0.0;
+
+		std::array<uint64_t, NumInvalidateWidgetReasons> Invalidations{};
+
+		/* the invalidations of a single reason, the combined reasons(e.g. Paint_And_Volatility) are not counted as such */
+		uint64_t GetInvalidations(EInvalidateWidgetReason Reason) const;
+
+		uint64_t GetTotalInvalidations() const;
+	};
+
+	enum class EWidgetClassStatsSort : uint8_t
+	{
+		PaintTime,
+		ComputeDesiredSizeTime,
+		LiveBytes,
+		Invalidations,
+	};
+
+	/*
+	 * query the counters of all the widget classes
+	 * every FSlateWidgetClassData registers itself when it's created, i.e. the first time the class is used
+	 */
+	class FSlateWidgetClassStatistics
+	{
+	public:
+		/*
+		 * the calls, timings and invalidations are only counted when enabled, a measure costs two clock reads per call
+		 * the live instances are always counted
+		 */
+		static void SetEnabled(bool bInEnabled) { s_bEnabled.store(bInEnabled, std::memory_order_relaxed); }
+
+		static bool IsEnabled() { return ZERO_ENABLE_WIDGET_CLASS_STATS && s_bEnabled.load(std::memory_order_relaxed); }
+
+		/* the counters of every registered class, the most expensive first */
+		static std::vector<FSlateWidgetClassStatsSnapshot> GetSnapshots(EWidgetClassStatsSort Sort = EWidgetClassStatsSort::PaintTime);
+
+		/* returns false when no class with this name is registered */
+		static bool FindSnapshot(FName WidgetType, FSlateWidgetClassStatsSnapshot& OutSnapshot);
+
+		/* a table of the counters, one class per line */
+		static std::string DumpToString(EWidgetClassStatsSort Sort = EWidgetClassStatsSort::PaintTime);
+
+		/* write the table in the core log */
+		static void Dump(EWidgetClassStatsSort Sort = EWidgetClassStatsSort::PaintTime);
+
+		/*
+		 * a table of the bytes per widget of the classes with live instances, the biggest first, and their total
+		 * a widget allocated by SNew also holds the reference counts of its shared pointer, they are counted in the
+		 * allocated bytes. the memory allocated by the widgets themselves, e.g. their children, is not counted.
+		 */
+		static std::string DumpMemoryToString();
+
+		/* write the memory table in the core log */
+		static void DumpMemory();
+
+		/* reset the call counters and timings of all the classes, e.g. at the start of a capture */
+		static void ResetCounters();
+
+	private:
+		friend class FSlateWidgetClassData;
+
+		static void RegisterClass(const FSlateWidgetClassData& ClassData);
+
+		static FSlateWidgetClassStatsSnapshot MakeSnapshot(const FSlateWidgetClassData& ClassData);
+
+		static std::atomic<bool> s_bEnabled;
+	};
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Core.h"
+#include "Core/Delegate.h"
+#include "SlateCore/Widgets/WidgetHandle.h"
+
+namespace ZeroUI
+{
+	/*
+	 * a delegate to a member function of a widget, the widget is referenced by its handle
+	 * the delegate doesn't keep the widget alive and does nothing once it's destroyed, instead of calling a dangling pointer
+	 */
+	template<class TWidgetType, class TReturn, typename ...ParamTypes>
+	class FWidgetDelegate : public FDelegateBase<TReturn, ParamTypes...>
+	{
+	public:
+		FWidgetDelegate(const TWidgetType& Widget, TReturn(TWidgetType::* Function)(ParamTypes ...))
+			: m_Widget(Widget.GetHandle())
+			, m_Function(Function)
+		{}
+
+		virtual TReturn Execute(ParamTypes ...Params)
+		{
+			if (SWidget* Widget = m_Widget.Resolve())
+			{
+				return (static_cast<TWidgetType*>(Widget)->*m_Function)(Params...);
+			}
+			return TReturn();
+		}
+
+		/* returns false once the widget is destroyed */
+		bool IsTargetAlive() const { return m_Widget.IsValid(); }
+
+	private:
+		FWidgetHandle m_Widget;
+		TReturn(TWidgetType::* m_Function)(ParamTypes...);
+	};
+
+	/* binds the delegate to a member function of the widget, see FWidgetDelegate */
+	template<class TWidgetType, class TReturn, typename ...ParamTypes>
+	void BindWidget(FDelegate<TReturn, ParamTypes...>& Delegate, TWidgetType& Widget, TReturn(TWidgetType::* Function)(ParamTypes ...))
+	{
+		Delegate.BindDelegateInstance(new FWidgetDelegate<TWidgetType, TReturn, ParamTypes...>(Widget, Function));
+	}
+}
@@ -0,0 +1,59 @@
+#include "WidgetHandle.h"
+
+namespace ZeroUI
+{
+	FWidgetHandleTable& FWidgetHandleTable::Get()
+	{
+		// never destroyed, the widgets held by other singletons are destroyed after the static objects of this file
+		static FWidgetHandleTable* Instance = new FWidgetHandleTable();
+		return *Instance;
+	}
+
+	FWidgetHandle FWidgetHandleTable::Allocate(SWidget& Widget)
+	{
+		std::lock_guard<std::mutex> Lock(m_Mutex);
+
+		uint32_t Index = m_FirstFree;
+		if (Index != FWidgetHandle::InvalidIndex)
+		{
+			m_FirstFree = m_Chunks[Index / SlotsPerChunk][Index % SlotsPerChunk].NextFree;
+		}
+		else
+		{
+			Index = m_NumSlots++;
+			const uint32_t ChunkIndex = Index / SlotsPerChunk;
+			if (ChunkIndex >= MaxChunks)
+			{
+				// the chunks don't grow, the slot would be written out of the table
+				CORE_LOG_FATAL("FWidgetHandleTable: the table is full, it holds {0} live widgets", MaxChunks * SlotsPerChunk);
+				FLog::Flush();
+				std::abort();
+			}
+			if (!m_Chunks[ChunkIndex])
+			{
+				m_Chunks[ChunkIndex] = CreateScope<FSlot[]>(SlotsPerChunk);
+			}
+		}
+
+		FSlot& Slot = m_Chunks[Index / SlotsPerChunk][Index % SlotsPerChunk];
+		Slot.Widget = &Widget;
+		Slot.NextFree = FWidgetHandle::InvalidIndex;
+		++Slot.Generation;
+		++m_NumLiveHandles;
+
+		return FWidgetHandle{ Index, Slot.Generation };
+	}
+
+	void FWidgetHandleTable::Release(FWidgetHandle Handle)
+	{
+		std::lock_guard<std::mutex> Lock(m_Mutex);
+
+		assert(Resolve(Handle) != nullptr && "the widget handle was already released");
+		FSlot& Slot = m_Chunks[Handle.Index / SlotsPerChunk][Handle.Index % SlotsPerChunk];
+		Slot.Widget = nullptr;
+		++Slot.Generation;
+		Slot.NextFree = m_FirstFree;
+		m_FirstFree = Handle.Index;
+		--m_NumLiveHandles;
+	}
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Core.h"
+
+namespace ZeroUI
+{
+	class SWidget;
+
+	/*
+	 * a weak reference to a widget that doesn't count references, the index of the widget in the handle table and the
+	 * generation of its slot. a destroyed widget releases its slot, the slot is reused with the next generation so the
+	 * handles to the destroyed widget resolve to null.
+	 * resolving a handle is a table lookup and a compare, there is no atomic operation as with a Weak<SWidget>::lock
+	 */
+	struct FWidgetHandle
+	{
+		static constexpr uint32_t InvalidIndex = ~0u;
+
+		uint32_t Index = InvalidIndex;
+
+		uint32_t Generation = 0;
+
+		/* returns true for the handle of no widget, a handle to a destroyed widget isn't null but doesn't resolve */
+		bool IsNull() const { return Index == InvalidIndex; }
+
+		/* returns the widget, null when it's destroyed */
+		SWidget* Resolve() const;
+
+		bool IsValid() const { return Resolve() != nullptr; }
+
+		bool operator==(const FWidgetHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+
+		bool operator!=(const FWidgetHandle& Other) const { return !(*this == Other); }
+	};
+
+	/*
+	 * the slots of the live widgets, every widget takes a slot in its constructor and releases it in its destructor
+	 * the slots are allocated in chunks that never move, a handle is resolved without locking. the widgets are created
+	 * and destroyed on the game thread, the layout tasks only resolve the handles of a tree that doesn't change.
+	 */
+	class FWidgetHandleTable
+	{
+	public:
+		static constexpr uint32_t SlotsPerChunk = 4096;
+
+		/* the table holds up to 16M live widgets */
+		static constexpr uint32_t MaxChunks = 4096;
+
+		static FWidgetHandleTable& Get();
+
+		/* takes a free slot for the widget, the released slots are reused first */
+		FWidgetHandle Allocate(SWidget& Widget);
+
+		/* frees the slot, the handles to it don't resolve anymore */
+		void Release(FWidgetHandle Handle);
+
+		SWidget* Resolve(FWidgetHandle Handle) const
+		{
+			const uint32_t ChunkIndex = Handle.Index / SlotsPerChunk;
+			if (ChunkIndex >= MaxChunks || !m_Chunks[ChunkIndex])
+			{
+				return nullptr;
+			}
+
+			const FSlot& Slot = m_Chunks[ChunkIndex][Handle.Index % SlotsPerChunk];
+			return Slot.Generation == Handle.Generation ? Slot.Widget : nullptr;
+		}
+
+		uint32_t GetNumLiveHandles() const { return m_NumLiveHandles; }
+
+	private:
+		struct FSlot
+		{
+			SWidget* Widget = nullptr;
+
+			/* odd while the slot holds a widget, a handle of a free slot never resolves */
+			uint32_t Generation = 0;
+
+			/* the next free slot, while the slot is free */
+			uint32_t NextFree = FWidgetHandle::InvalidIndex;
+		};
+
+		std::array<Scope<FSlot[]>, MaxChunks> m_Chunks;
+
+		std::mutex m_Mutex;
+
+		uint32_t m_NumSlots = 0;
+
+		uint32_t m_FirstFree = FWidgetHandle::InvalidIndex;
+
+		uint32_t m_NumLiveHandles = 0;
+	};
+
+	inline SWidget* FWidgetHandle::Resolve() const
+	{
+		return FWidgetHandleTable::Get().Resolve(*this);
+	}
+}
+
+template<>
+struct std::hash<ZeroUI::FWidgetHandle>
+{
+	size_t operator()(ZeroUI::FWidgetHandle Handle) const noexcept
+	{
+		return (static_cast<size_t>(Handle.Generation) << 32) ^ Handle.Index;
+	}
+};